@@ -47,6 +47,7 @@
 #include "extprofile.h"
 #include "strings.h"
 #include "database_schema.h"
+#include "database/database_async_pool.h"
 #include "http/httplib.h"
 #include "http/uri.h"
 
@@ -2460,3 +2461,64 @@ void Database::SourceSqlFromUrl(std::string url)
 		LogError("URI parser error [{}]", iae.what());
 	}
 }
+
+bool Database::StartAsyncPool(uint32 connections)
+{
+	if (!m_async_pool) {
+		m_async_pool = std::make_unique<DatabaseAsyncPool>();
+	}
+
+	return m_async_pool->Start(*this, connections);
+}
+
+void Database::StopAsyncPool()
+{
+	if (m_async_pool) {
+		m_async_pool->Stop();
+	}
+}
+
+bool Database::IsAsyncPoolRunning() const
+{
+	return m_async_pool && m_async_pool->IsRunning();
+}
+
+// runs the query on a pooled connection, callback is invoked on the event loop
+// queries sharing a non-zero ordering_key (ex: a character id) are executed in order
+void Database::QueryDatabaseAsync(
+	const std::string &query,
+	std::function<void(MySQLRequestResult &)> callback,
+	uint64 ordering_key
+)
+{
+	auto results = std::make_shared<MySQLRequestResult>();
+
+	std::function<void()> done = nullptr;
+	if (callback) {
+		done = [callback, results]() { callback(*results); };
+	}
+
+	RunAsync(
+		[query, results](Database &db) {
+			*results = db.QueryDatabase(query);
+		},
+		done,
+		ordering_key
+	);
+}
+
+// runs work against a pooled connection (repositories accept it as Database &)
+// falls back to running inline on this connection when the pool is not running
+void Database::RunAsync(std::function<void(Database &)> work, std::function<void()> done, uint64 ordering_key)
+{
+	if (!IsAsyncPoolRunning()) {
+		work(*this);
+		if (done) {
+			done();
+		}
+
+		return;
+	}
+
+	m_async_pool->Enqueue(ordering_key, std::move(work), std::move(done));
+}
@@ -30,6 +30,8 @@
 #include "eq_packet_structs.h"
 
 #include <cmath>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 #include <map>
@@ -37,6 +39,7 @@
 
 class MySQLRequestResult;
 class Client;
+class DatabaseAsyncPool;
 
 namespace EQ
 {
@@ -265,11 +268,29 @@ public:
 	void SourceDatabaseTableFromUrl(std::string table_name, std::string url);
 	void SourceSqlFromUrl(std::string url);
 
+	/* Async Queries */
+
+	bool StartAsyncPool(uint32 connections);
+	void StopAsyncPool();
+	bool IsAsyncPoolRunning() const;
+	void QueryDatabaseAsync(
+		const std::string &query,
+		std::function<void(MySQLRequestResult &)> callback = nullptr,
+		uint64 ordering_key = 0
+	);
+	void RunAsync(
+		std::function<void(Database &)> work,
+		std::function<void()> done = nullptr,
+		uint64 ordering_key = 0
+	);
+
 private:
 
 	Mutex Mvarcache;
 	VarCache_Struct varcache;
 
+	std::unique_ptr<DatabaseAsyncPool> m_async_pool;
+
 	/* Groups, utility methods. */
 	void    ClearAllGroupLeaders();
 	void    ClearAllGroups();
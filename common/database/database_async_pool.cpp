@@ -0,0 +1,183 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2020 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+#include "database_async_pool.h"
+#include "../database.h"
+#include "../eqemu_logsys.h"
+#include "../event/event_loop.h"
+
+DatabaseAsyncPool::DatabaseAsyncPool()
+{
+	m_next_worker     = 0;
+	m_pending         = 0;
+	m_completed_count = 0;
+	m_async           = nullptr;
+	m_running         = false;
+}
+
+DatabaseAsyncPool::~DatabaseAsyncPool()
+{
+	Stop();
+}
+
+bool DatabaseAsyncPool::Start(const Database &source, uint32 connections)
+{
+	if (m_running || connections == 0) {
+		return false;
+	}
+
+	for (uint32 i = 0; i < connections; ++i) {
+		auto w = std::make_unique<Worker>();
+		w->connection = std::make_unique<Database>();
+		if (!w->connection->CloneConnection(source)) {
+			LogError("Async database pool failed to open connection [{}] of [{}]", i + 1, connections);
+			m_workers.clear();
+			return false;
+		}
+
+		m_workers.emplace_back(std::move(w));
+	}
+
+	m_async       = new uv_async_t;
+	m_async->data = this;
+	uv_async_init(
+		EQ::EventLoop::Get().Handle(), m_async, [](uv_async_t *handle) {
+			static_cast<DatabaseAsyncPool *>(handle->data)->ProcessCompleted();
+		}
+	);
+
+	// completions should never be the only thing keeping the loop alive
+	uv_unref(reinterpret_cast<uv_handle_t *>(m_async));
+
+	for (auto &w : m_workers) {
+		w->thread = std::thread(&DatabaseAsyncPool::ProcessWork, this, w.get());
+	}
+
+	m_running = true;
+
+	LogInfo("Async database pool started with [{}] connection(s)", connections);
+
+	return true;
+}
+
+void DatabaseAsyncPool::Stop()
+{
+	if (!m_running) {
+		return;
+	}
+
+	// workers drain whatever is already queued before exiting so no writes are dropped
+	for (auto &w : m_workers) {
+		{
+			std::unique_lock<std::mutex> lock(w->lock);
+			w->running = false;
+		}
+
+		w->cv.notify_all();
+	}
+
+	for (auto &w : m_workers) {
+		if (w->thread.joinable()) {
+			w->thread.join();
+		}
+	}
+
+	m_running = false;
+
+	ProcessCompleted();
+
+	uv_close(
+		reinterpret_cast<uv_handle_t *>(m_async), [](uv_handle_t *handle) {
+			delete reinterpret_cast<uv_async_t *>(handle);
+		}
+	);
+
+	m_async = nullptr;
+	m_workers.clear();
+
+	LogInfo("Async database pool stopped");
+}
+
+void DatabaseAsyncPool::Enqueue(uint64 ordering_key, WorkFn work, DoneFn done)
+{
+	if (!m_running || m_workers.empty()) {
+		return;
+	}
+
+	const uint64 index = ordering_key ? ordering_key : m_next_worker++;
+	auto         &w    = m_workers[index % m_workers.size()];
+
+	++m_pending;
+
+	{
+		std::unique_lock<std::mutex> lock(w->lock);
+		w->jobs.push(Job{std::move(work), std::move(done)});
+	}
+
+	w->cv.notify_one();
+}
+
+void DatabaseAsyncPool::ProcessWork(Worker *w)
+{
+	for (;;) {
+		Job job;
+
+		{
+			std::unique_lock<std::mutex> lock(w->lock);
+			w->cv.wait(lock, [w] { return !w->running || !w->jobs.empty(); });
+
+			if (w->jobs.empty()) {
+				return;
+			}
+
+			job = std::move(w->jobs.front());
+			w->jobs.pop();
+		}
+
+		job.work(*w->connection);
+
+		--m_pending;
+
+		if (job.done) {
+			{
+				std::unique_lock<std::mutex> lock(m_completed_lock);
+				m_completed.emplace_back(std::move(job.done));
+			}
+
+			uv_async_send(m_async);
+		}
+	}
+}
+
+void DatabaseAsyncPool::ProcessCompleted()
+{
+	std::vector<DoneFn> completed;
+
+	{
+		std::unique_lock<std::mutex> lock(m_completed_lock);
+		completed.swap(m_completed);
+	}
+
+	for (auto &done : completed) {
+		done();
+	}
+
+	m_completed_count += completed.size();
+}
@@ -0,0 +1,92 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2020 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+#ifndef EQEMU_DATABASE_ASYNC_POOL_H
+#define EQEMU_DATABASE_ASYNC_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include <uv.h>
+
+#include "../types.h"
+
+class Database;
+
+/**
+ * Pool of worker threads that each own a dedicated database connection
+ *
+ * Work is run on a pooled connection and its completion callback is handed back to the
+ * event loop of the thread that started the pool. Jobs sharing a non-zero ordering key
+ * always land on the same worker, so they execute in the order they were enqueued
+ */
+class DatabaseAsyncPool {
+public:
+	typedef std::function<void(Database &)> WorkFn;
+	typedef std::function<void()>           DoneFn;
+
+	DatabaseAsyncPool();
+	~DatabaseAsyncPool();
+
+	bool Start(const Database &source, uint32 connections);
+	void Stop();
+
+	void Enqueue(uint64 ordering_key, WorkFn work, DoneFn done);
+
+	inline bool IsRunning() const { return m_running; }
+	inline uint32 GetConnectionCount() const { return static_cast<uint32>(m_workers.size()); }
+	inline uint64 GetPendingCount() const { return m_pending; }
+	inline uint64 GetCompletedCount() const { return m_completed_count; }
+
+private:
+	struct Job {
+		WorkFn work;
+		DoneFn done;
+	};
+
+	struct Worker {
+		std::unique_ptr<Database> connection;
+		std::thread               thread;
+		std::mutex                lock;
+		std::condition_variable   cv;
+		std::queue<Job>           jobs;
+		bool                      running = true;
+	};
+
+	void ProcessWork(Worker *w);
+	void ProcessCompleted();
+
+	std::vector<std::unique_ptr<Worker>> m_workers;
+	std::atomic<uint32>                  m_next_worker;
+	std::atomic<uint64>                  m_pending;
+	std::atomic<uint64>                  m_completed_count;
+
+	std::mutex          m_completed_lock;
+	std::vector<DoneFn> m_completed;
+	uv_async_t          *m_async;
+	bool                m_running;
+};
+
+#endif //EQEMU_DATABASE_ASYNC_POOL_H
@@ -54,6 +54,8 @@ DBcore::~DBcore()
 	 * are re-using the default database connection pointer when we dont have an
 	 * external configuration setup ex: (content_database)
 	 */
+	ClearPreparedStatements();
+
 	if (mysqlOwner) {
 		mysql_close(mysql);
 	}
@@ -243,6 +245,7 @@ bool DBcore::Open(uint32 *errnum, char *errbuf)
 		return true;
 	}
 	if (GetStatus() == Error) {
+		ClearPreparedStatements(); // statements die with the connection
 		mysql_close(mysql);
 		mysql_init(mysql);        // Initialize structure again
 	}
@@ -307,6 +310,103 @@ void DBcore::SetMutex(Mutex *mutex)
 	DBcore::m_mutex = mutex;
 }
 
+bool DBcore::CloneConnection(const DBcore &o)
+{
+	if (!o.pHost) {
+		return false;
+	}
+
+	m_prepared_statements_enabled = o.m_prepared_statements_enabled;
+
+	return Open(o.pHost, o.pUser, o.pPassword, o.pDatabase, o.pPort, nullptr, nullptr, o.pCompress, o.pSSL);
+}
+
+// executes a cached prepared statement bound to a single integer parameter and binds the
+// first row into binder. returns 1 when a row was bound, 0 when there were no rows and -1 on
+// any statement error, in which case the caller should fall back to the text protocol
+int DBcore::QueryPreparedRow(const std::string &query, int64 param, MySQLStmtBinder &binder)
+{
+	BenchTimer timer;
+	timer.reset();
+
+	LockMutex lock(m_mutex);
+
+	if (pStatus != Connected) {
+		return -1;
+	}
+
+	// the server turned this query down before, it would again
+	if (m_failed_prepares.find(query) != m_failed_prepares.end()) {
+		return -1;
+	}
+
+	MYSQL_STMT *stmt = nullptr;
+
+	auto it = m_prepared_statements.find(query);
+	if (it != m_prepared_statements.end()) {
+		stmt = it->second;
+	}
+	else {
+		stmt = mysql_stmt_init(mysql);
+		if (!stmt) {
+			return -1;
+		}
+
+		if (mysql_stmt_prepare(stmt, query.c_str(), query.length()) != 0) {
+			auto error_number = mysql_stmt_errno(stmt);
+			LogMySQLError("[{}] [{}]\n[{}]", error_number, mysql_stmt_error(stmt), query);
+			mysql_stmt_close(stmt);
+
+			// a lost connection is worth preparing again once reconnected, anything else is the query
+			if (error_number != CR_SERVER_LOST && error_number != CR_SERVER_GONE_ERROR) {
+				m_failed_prepares.insert(query);
+			}
+
+			return -1;
+		}
+
+		m_prepared_statements[query] = stmt;
+	}
+
+	MYSQL_BIND param_bind{};
+	param_bind.buffer_type = MYSQL_TYPE_LONGLONG;
+	param_bind.buffer      = &param;
+
+	if (mysql_stmt_param_count(stmt) != 1 || mysql_stmt_bind_param(stmt, &param_bind) != 0 ||
+		mysql_stmt_execute(stmt) != 0) {
+		LogMySQLError("[{}] [{}]\n[{}]", mysql_stmt_errno(stmt), mysql_stmt_error(stmt), query);
+
+		// drop the statement, it is re-prepared on the next call (ex: after a reconnect)
+		mysql_stmt_close(stmt);
+		m_prepared_statements.erase(query);
+		return -1;
+	}
+
+	int status = binder.Fetch(stmt);
+
+	mysql_stmt_free_result(stmt);
+
+	LogMySQLQuery(
+		"{0} -- [prepared] ({1}) ({2} row{3} returned) ({4}s)",
+		query,
+		param,
+		status > 0 ? 1 : 0,
+		status == 1 ? "" : "s",
+		std::to_string(timer.elapsed())
+	);
+
+	return status;
+}
+
+void DBcore::ClearPreparedStatements()
+{
+	for (auto &e : m_prepared_statements) {
+		mysql_stmt_close(e.second);
+	}
+
+	m_prepared_statements.clear();
+}
+
 // executes multiple statements in one query
 // do not use this in application logic
 // this was built and maintained for database migrations only
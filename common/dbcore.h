@@ -8,11 +8,14 @@
 
 #include "../common/mutex.h"
 #include "../common/mysql_request_result.h"
+#include "../common/mysql_stmt_binder.h"
 #include "../common/types.h"
 
 #include <mysql.h>
 #include <string.h>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 class DBcore {
 public:
@@ -45,6 +48,15 @@ public:
 	}
 	void SetMutex(Mutex *mutex);
 
+	// opens a new, independently owned connection using the credentials of another connection
+	bool CloneConnection(const DBcore &o);
+
+	// server side prepared statements (binary protocol), callers fall back to text queries on -1
+	inline void SetPreparedStatementsEnabled(bool enabled) { m_prepared_statements_enabled = enabled; }
+	inline bool IsPreparedStatementsEnabled() const { return m_prepared_statements_enabled; }
+	int QueryPreparedRow(const std::string &query, int64 param, MySQLStmtBinder &binder);
+	void ClearPreparedStatements();
+
 protected:
 	bool Open(
 		const char *iHost,
@@ -68,6 +80,10 @@ private:
 
 	std::mutex m_query_lock{};
 
+	bool                                          m_prepared_statements_enabled = false;
+	std::unordered_map<std::string, MYSQL_STMT *> m_prepared_statements;
+	std::unordered_set<std::string>               m_failed_prepares;
+
 	std::string origin_host;
 
 	char   *pHost;
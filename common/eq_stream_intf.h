@@ -4,6 +4,7 @@
 //this is the only part of an EQStream that is seen by the application.
 
 #include <string>
+#include <vector>
 #include "emu_versions.h"
 #include "eq_packet.h"
 #include "net/daybreak_connection.h"
@@ -18,6 +19,7 @@ typedef enum {
 
 class EQApplicationPacket;
 class OpcodeManager;
+class EncodedPacketCache;
 
 struct EQStreamManagerInterfaceOptions
 {
@@ -81,12 +83,17 @@ public:
 	struct Stats
 	{
 		EQ::Net::DaybreakConnectionStats DaybreakStats;
+		EQ::Net::DaybreakSocketStats SocketStats;
+		std::vector<std::pair<uint8_t, EQ::Net::DaybreakCompressionStats>> CompressionStats; //opcodes that have been compressed
+		std::vector<std::pair<uint8_t, EQ::Net::DaybreakCompressionStats>> DecompressionStats; //opcodes that have been decompressed
 		int RecvCount[_maxEmuOpcode];
 		int SentCount[_maxEmuOpcode];
 	};
 
 	virtual void QueuePacket(const EQApplicationPacket *p, bool ack_req=true) = 0;
 	virtual void FastQueuePacket(EQApplicationPacket **p, bool ack_req=true) = 0;
+	//for a packet going to many streams, streams that encode per client version can reuse work through the cache
+	virtual void QueueBroadcastPacket(const EQApplicationPacket *p, bool ack_req, EncodedPacketCache &cache) { QueuePacket(p, ack_req); }
 	virtual EQApplicationPacket *PopPacket() = 0;
 	virtual void Close() = 0;
 	virtual void ReleaseFromUse() = 0;
@@ -5,6 +5,83 @@
 #include "eqemu_logsys.h"
 #include "opcodemgr.h"
 
+namespace {
+	//stands in for the destination stream while a struct strategy encodes into an EncodedPacketCache
+	class EncodeCaptureStream : public EQStreamInterface {
+	public:
+		EncodeCaptureStream() : m_target(nullptr) { }
+
+		void SetTarget(std::vector<EncodedPacketCache::Encoded> *target) { m_target = target; }
+
+		virtual void QueuePacket(const EQApplicationPacket *p, bool ack_req = true) {
+			m_target->push_back({ std::shared_ptr<EQApplicationPacket>(p->Copy()), ack_req });
+		}
+
+		virtual void FastQueuePacket(EQApplicationPacket **p, bool ack_req = true) {
+			m_target->push_back({ std::shared_ptr<EQApplicationPacket>(*p), ack_req });
+			*p = nullptr;
+		}
+
+		virtual EQApplicationPacket *PopPacket() { return nullptr; }
+		virtual void Close() { }
+		virtual void ReleaseFromUse() { }
+		virtual void RemoveData() { }
+		virtual std::string GetRemoteAddr() const { return std::string(); }
+		virtual uint32 GetRemoteIP() const { return 0; }
+		virtual uint16 GetRemotePort() const { return 0; }
+		virtual bool CheckState(EQStreamState state) { return state == ESTABLISHED; }
+		virtual std::string Describe() const { return "Encode Capture"; }
+		virtual EQStreamState GetState() { return ESTABLISHED; }
+		virtual void SetOpcodeManager(OpcodeManager **opm) { }
+		virtual OpcodeManager *GetOpcodeManager() const { return nullptr; }
+		virtual Stats GetStats() const { return Stats(); }
+		virtual void ResetStats() { }
+		virtual EQStreamManagerInterface *GetManager() const { return nullptr; }
+
+	private:
+		std::vector<EncodedPacketCache::Encoded> *m_target;
+	};
+}
+
+EncodedPacketCache::EncodedPacketCache(const EQApplicationPacket *app)
+:	m_app(app),
+	m_encodes(0),
+	m_reuses(0)
+{
+}
+
+EncodedPacketCache::~EncodedPacketCache() {
+}
+
+const std::vector<EncodedPacketCache::Encoded> &EncodedPacketCache::Get(const StructStrategy *structs, bool ack_req) {
+	for (auto &e : m_entries) {
+		if (e.structs == structs && e.ack_req == ack_req) {
+			m_reuses++;
+			return e.packets;
+		}
+	}
+
+	if (!m_capture) {
+		m_capture = std::make_shared<EncodeCaptureStream>();
+	}
+
+	m_entries.push_back({ structs, ack_req, { } });
+	auto &entry = m_entries.back();
+
+	auto capture = static_cast<EncodeCaptureStream *>(m_capture.get());
+	capture->SetTarget(&entry.packets);
+
+	//the strategy takes ownership of the copy the same way it does in QueuePacket
+	EQApplicationPacket *copy = m_app->Copy();
+	structs->Encode(&copy, m_capture, ack_req);
+	safe_delete(copy);
+
+	capture->SetTarget(nullptr);
+	m_encodes++;
+
+	return entry.packets;
+}
+
 
 EQStreamProxy::EQStreamProxy(std::shared_ptr<EQStreamInterface> &stream, const StructStrategy *structs, OpcodeManager **opcodes)
 :	m_stream(stream),
@@ -46,6 +123,17 @@ void EQStreamProxy::QueuePacket(const EQApplicationPacket *p, bool ack_req) {
 	FastQueuePacket(&newp, ack_req);
 }
 
+void EQStreamProxy::QueueBroadcastPacket(const EQApplicationPacket *p, bool ack_req, EncodedPacketCache &cache) {
+	if (p == nullptr) {
+		return;
+	}
+
+	//the underlying stream serializes from a const packet so the shared encode is never copied
+	for (auto &e : cache.Get(m_structs, ack_req)) {
+		m_stream->QueuePacket(e.packet.get(), e.ack_req);
+	}
+}
+
 void EQStreamProxy::FastQueuePacket(EQApplicationPacket **p, bool ack_req) {
 	if(p == nullptr || *p == nullptr)
 		return;
@@ -5,11 +5,54 @@
 #include "types.h"
 #include "eq_stream_intf.h"
 #include <memory>
+#include <vector>
 
 class StructStrategy;
 class OpcodeManager;
 class EQApplicationPacket;
 
+/**
+ * Encoded copies of one broadcast packet, one set per client version
+ *
+ * The first recipient on a version runs its struct strategy into the cache, later recipients on the same
+ * version queue the shared result instead of copying and encoding it again. Only valid while the source
+ * packet is unchanged so keep it on the stack for the length of a single broadcast
+ */
+class EncodedPacketCache {
+public:
+	struct Encoded
+	{
+		std::shared_ptr<EQApplicationPacket> packet;
+		bool ack_req;
+	};
+
+	EncodedPacketCache(const EQApplicationPacket *app);
+	~EncodedPacketCache();
+
+	EncodedPacketCache(const EncodedPacketCache &) = delete;
+	EncodedPacketCache &operator=(const EncodedPacketCache &) = delete;
+
+	//wire packets for structs, encoding the source the first time a version asks for it
+	const std::vector<Encoded> &Get(const StructStrategy *structs, bool ack_req);
+
+	uint32 GetEncodes() const { return m_encodes; }
+	uint32 GetReuses() const { return m_reuses; }
+
+private:
+	struct Entry
+	{
+		const StructStrategy *structs;
+		bool ack_req;
+		std::vector<Encoded> packets;
+	};
+
+	const EQApplicationPacket *m_app;
+	std::vector<Entry> m_entries;
+	std::shared_ptr<EQStreamInterface> m_capture;
+	uint32 m_encodes;
+	uint32 m_reuses;
+};
+
 class EQStreamProxy : public EQStreamInterface {
 public:
 	//takes ownership of the stream.
@@ -19,6 +62,7 @@ public:
 	//EQStreamInterface:
 	virtual void QueuePacket(const EQApplicationPacket *p, bool ack_req=true);
 	virtual void FastQueuePacket(EQApplicationPacket **p, bool ack_req=true);
+	virtual void QueueBroadcastPacket(const EQApplicationPacket *p, bool ack_req, EncodedPacketCache &cache);
 	virtual EQApplicationPacket *PopPacket();
 	virtual void Close();
 	virtual std::string GetRemoteAddr() const;
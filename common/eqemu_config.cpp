@@ -128,6 +128,12 @@ void EQEmuConfig::parse_config()
 	DatabasePort     = Strings::ToUnsignedInt(_root["server"]["database"].get("port", "3306").asString());
 	DatabaseDB       = _root["server"]["database"].get("db", "eq").asString();
 
+	// pooled connections used for async queries, 0 keeps every query on the calling thread
+	DatabaseAsyncConnections = Strings::ToUnsignedInt(_root["server"]["database"].get("async_connections", "0").asString());
+
+	// generated repositories bind FindOne rows through server side prepared statements
+	DatabasePreparedStatements = _root["server"]["database"].get("prepared_statements", "false").asString() == "true";
+
 	/**
 	 * Content Database
 	 */
@@ -178,6 +184,11 @@ void EQEmuConfig::parse_config()
 	LogPrefix = _root["server"]["launcher"].get("logprefix", "logs/zone-").asString();
 	LogSuffix = _root["server"]["launcher"].get("logsuffix", ".log").asString();
 
+	// console and file output handed to a background writer, full policy is either "drop" or "block"
+	LogAsyncWriter        = _root["server"]["logging"].get("async", "false").asString() == "true";
+	LogAsyncQueueSize     = Strings::ToUnsignedInt(_root["server"]["logging"].get("async_queue_size", "16384").asString());
+	LogAsyncBlockWhenFull = _root["server"]["logging"].get("async_full_policy", "drop").asString() == "block";
+
 	/**
 	 * Launcher
 	 */
@@ -272,6 +283,12 @@ std::string EQEmuConfig::GetByName(const std::string &var_name) const
 	if (var_name == "DatabasePort") {
 		return (itoa(DatabasePort));
 	}
+	if (var_name == "DatabaseAsyncConnections") {
+		return (itoa(DatabaseAsyncConnections));
+	}
+	if (var_name == "DatabasePreparedStatements") {
+		return (DatabasePreparedStatements ? "true" : "false");
+	}
 	if (var_name == "QSDatabaseHost") {
 		return (QSDatabaseHost);
 	}
@@ -326,6 +343,15 @@ std::string EQEmuConfig::GetByName(const std::string &var_name) const
 	if (var_name == "LogSuffix") {
 		return (LogSuffix);
 	}
+	if (var_name == "LogAsyncWriter") {
+		return (LogAsyncWriter ? "true" : "false");
+	}
+	if (var_name == "LogAsyncQueueSize") {
+		return (itoa(LogAsyncQueueSize));
+	}
+	if (var_name == "LogAsyncBlockWhenFull") {
+		return (LogAsyncBlockWhenFull ? "true" : "false");
+	}
 	if (var_name == "ZoneExe") {
 		return (ZoneExe);
 	}
@@ -76,6 +76,8 @@ class EQEmuConfig
 		std::string DatabasePassword;
 		std::string DatabaseDB;
 		uint16 DatabasePort;
+		uint32 DatabaseAsyncConnections;
+		bool DatabasePreparedStatements;
 
 		// From <content_database/>
 		std::string ContentDbHost;
@@ -106,6 +108,11 @@ class EQEmuConfig
 		std::string SharedMemDir;
 		std::string LogDir;
 
+		// From <logging/>
+		bool   LogAsyncWriter;
+		uint32 LogAsyncQueueSize;
+		bool   LogAsyncBlockWhenFull;
+
 		// From <launcher/>
 		std::string LogPrefix;
 		std::string LogSuffix;
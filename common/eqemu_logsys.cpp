@@ -19,6 +19,7 @@
 */
 
 #include "eqemu_logsys.h"
+#include "mpsc_ring_buffer.h"
 #include "rulesys.h"
 #include "platform.h"
 #include "strings.h"
@@ -26,13 +27,52 @@
 #include "repositories/logsys_categories_repository.h"
 #include "termcolor/rang.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <time.h>
 #include <sys/stat.h>
 
 std::ofstream process_log;
 
+// the async writer thread and the main thread both open, write and close the process log
+std::mutex process_log_lock;
+
+// records the async writer drains per pass before flushing the file
+constexpr uint32 ASYNC_WRITER_BATCH_SIZE = 256;
+
+struct EQEmuLogSys::AsyncRecord {
+	uint16          log_category = 0;
+	bool            to_console   = false;
+	bool            to_file      = false;
+	std::string     message;
+	std::string     file_message;
+	const char      *file        = "";
+	const char      *func        = "";
+	int             line         = 0;
+	time_t          time         = 0;
+	OriginationInfo origin;
+};
+
+struct EQEmuLogSys::AsyncWriter {
+	explicit AsyncWriter(uint32 queue_size) : queue(queue_size) {}
+
+	MPSCRingBuffer<AsyncRecord> queue;
+	std::thread                 thread;
+	std::mutex                  wake_lock;
+	std::condition_variable     wake;
+	std::atomic<bool>           running{true};
+	std::atomic<bool>           idle{false};
+	std::atomic<uint64>         pending{0};
+	std::atomic<uint64>         dropped{0};
+	std::atomic<uint64>         written{0};
+	bool                        block_when_full = false;
+};
+
 #include <filesystem>
 
 #ifdef _WINDOWS
@@ -62,7 +102,10 @@ EQEmuLogSys::EQEmuLogSys()
 /**
  * EQEmuLogSys Deconstructor
  */
-EQEmuLogSys::~EQEmuLogSys() = default;
+EQEmuLogSys::~EQEmuLogSys()
+{
+	StopAsyncWriter();
+}
 
 EQEmuLogSys *EQEmuLogSys::LoadLogSettingsDefaults()
 {
@@ -173,6 +216,7 @@ void EQEmuLogSys::ProcessLogWrite(
 		crash_log.close();
 	}
 
+	std::lock_guard<std::mutex> lock(process_log_lock);
 	if (process_log) {
 		char time_stamp[80];
 		EQEmuLogSys::SetCurrentTimeStamp(time_stamp);
@@ -216,7 +260,8 @@ void EQEmuLogSys::ProcessConsoleMessage(
 	const std::string &message,
 	const char *file,
 	const char *func,
-	int line
+	int line,
+	const OriginationInfo &origin
 )
 {
 	bool is_error   = (
@@ -384,7 +429,7 @@ void EQEmuLogSys::ProcessConsoleMessage(
 			<< " ";
 	}
 
-	if (!origination_info.zone_short_name.empty()) {
+	if (!origin.zone_short_name.empty()) {
 		(!is_error ? std::cout : std::cerr)
 			<<
 			rang::fgB::black
@@ -393,15 +438,13 @@ void EQEmuLogSys::ProcessConsoleMessage(
 			<<
 			fmt::format(
 				"[{}] ({}) inst_id [{}]",
-				origination_info.zone_short_name,
-				origination_info.zone_long_name,
-				origination_info.instance_id
+				origin.zone_short_name,
+				origin.zone_long_name,
+				origin.instance_id
 			);
 	}
 
 	(!is_error ? std::cout : std::cerr) << rang::style::reset << std::endl;
-
-	m_on_log_console_hook(log_category, message);
 }
 
 /**
@@ -462,24 +505,76 @@ void EQEmuLogSys::Out(
 		va_end(args);
 	}
 
-	if (l.log_to_console_enabled) {
-		EQEmuLogSys::ProcessConsoleMessage(
-			log_category,
-			output_message,
-			file,
-			func,
-			line
-		);
+	if (m_async_writer && log_category != Logs::Crash && (l.log_to_console_enabled || l.log_to_file_enabled)) {
+		auto &w = *m_async_writer;
+
+		AsyncRecord r;
+		r.log_category = log_category;
+		r.to_console   = l.log_to_console_enabled;
+		r.to_file      = l.log_to_file_enabled;
+		r.file         = file;
+		r.func         = func;
+		r.line         = line;
+		r.time         = time(nullptr);
+
+		if (r.to_console) {
+			r.message = output_message;
+			r.origin  = origination_info;
+		}
+		if (r.to_file) {
+			r.file_message = fmt::format(
+				"[{}] [{}] {}",
+				GetPlatformName(),
+				Logs::LogCategoryName[log_category],
+				prefix + output_message
+			);
+		}
+
+		++w.pending;
+
+		bool queued = w.queue.TryPush(std::move(r));
+		while (!queued && w.block_when_full) {
+			w.wake.notify_one();
+			std::this_thread::yield();
+			queued = w.queue.TryPush(std::move(r));
+		}
+
+		if (!queued) {
+			--w.pending;
+			++w.dropped;
+		}
+		else if (w.idle.load(std::memory_order_relaxed)) {
+			// a missed wakeup only delays the line until the writer's poll timeout
+			w.wake.notify_one();
+		}
+
+		if (l.log_to_console_enabled) {
+			m_on_log_console_hook(log_category, output_message);
+		}
+	}
+	else {
+		if (l.log_to_console_enabled) {
+			EQEmuLogSys::ProcessConsoleMessage(
+				log_category,
+				output_message,
+				file,
+				func,
+				line,
+				origination_info
+			);
+			m_on_log_console_hook(log_category, output_message);
+		}
+		if (l.log_to_file_enabled) {
+			EQEmuLogSys::ProcessLogWrite(
+				log_category,
+				fmt::format("[{}] [{}] {}", GetPlatformName(), Logs::LogCategoryName[log_category], prefix + output_message)
+			);
+		}
 	}
+
 	if (l.log_to_gmsay_enabled) {
 		m_on_log_gmsay_hook(log_category, func, output_message);
 	}
-	if (l.log_to_file_enabled) {
-		EQEmuLogSys::ProcessLogWrite(
-			log_category,
-			fmt::format("[{}] [{}] {}", GetPlatformName(), Logs::LogCategoryName[log_category], prefix + output_message)
-		);
-	}
 	if (l.log_to_discord_enabled && m_on_log_discord_hook) {
 		m_on_log_discord_hook(log_category, log_settings[log_category].discord_webhook_id, output_message);
 	}
@@ -518,6 +613,9 @@ void EQEmuLogSys::MakeDirectory(const std::string &directory_name)
 
 void EQEmuLogSys::CloseFileLogs()
 {
+	FlushAsyncWriter();
+
+	std::lock_guard<std::mutex> lock(process_log_lock);
 	if (process_log.is_open()) {
 		process_log.close();
 	}
@@ -555,6 +653,7 @@ void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 		EQEmuLogSys::MakeDirectory(fmt::format("{}/zone", GetLogPath()));
 
 		// Open file pointer
+		std::lock_guard<std::mutex> lock(process_log_lock);
 		process_log.open(
 			fmt::format("{}/zone/{}_{}.log", GetLogPath(), m_platform_file_name, getpid()),
 			std::ios_base::app | std::ios_base::out
@@ -570,6 +669,7 @@ void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 		LogInfo("Starting File Log [{}/{}_{}.log]", GetLogPath(), m_platform_file_name.c_str(), getpid());
 
 		// Open file pointer
+		std::lock_guard<std::mutex> lock(process_log_lock);
 		process_log.open(
 			fmt::format("{}/{}_{}.log", GetLogPath(), m_platform_file_name.c_str(), getpid()),
 			std::ios_base::app | std::ios_base::out
@@ -812,3 +912,160 @@ void EQEmuLogSys::EnableMySQLErrorLogs()
 	log_settings[Logs::MySQLError].log_to_console = 1;
 	log_settings[Logs::MySQLError].log_to_gmsay   = 1;
 }
+
+EQEmuLogSys *EQEmuLogSys::StartAsyncWriter(uint32 queue_size, bool block_when_full)
+{
+	if (m_async_writer || queue_size == 0) {
+		return this;
+	}
+
+	m_async_writer                  = std::make_unique<AsyncWriter>(queue_size);
+	m_async_writer->block_when_full = block_when_full;
+	m_async_writer->thread          = std::thread(&EQEmuLogSys::ProcessAsyncWriter, this);
+
+	LogInfo(
+		"Async log writer started queue size [{}] full policy [{}]",
+		m_async_writer->queue.GetCapacity(),
+		block_when_full ? "block" : "drop"
+	);
+
+	return this;
+}
+
+void EQEmuLogSys::StopAsyncWriter()
+{
+	if (!m_async_writer) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_async_writer->wake_lock);
+		m_async_writer->running = false;
+	}
+
+	m_async_writer->wake.notify_one();
+
+	if (m_async_writer->thread.joinable()) {
+		m_async_writer->thread.join();
+	}
+
+	// anything logged from here on goes back to the synchronous path
+	m_async_writer.reset();
+}
+
+void EQEmuLogSys::FlushAsyncWriter()
+{
+	if (!m_async_writer) {
+		return;
+	}
+
+	while (m_async_writer->pending > 0) {
+		m_async_writer->wake.notify_one();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+bool EQEmuLogSys::IsAsyncWriterRunning() const
+{
+	return m_async_writer != nullptr;
+}
+
+uint64 EQEmuLogSys::GetAsyncDroppedCount() const
+{
+	return m_async_writer ? m_async_writer->dropped.load() : 0;
+}
+
+uint64 EQEmuLogSys::GetAsyncWrittenCount() const
+{
+	return m_async_writer ? m_async_writer->written.load() : 0;
+}
+
+void EQEmuLogSys::ProcessAsyncWriter()
+{
+	auto        &w = *m_async_writer;
+	AsyncRecord r;
+	std::string file_batch;
+	uint64      reported_dropped = 0;
+	time_t      stamp_time       = 0;
+	char        time_stamp[80]   = {};
+
+	for (;;) {
+		uint32 count = 0;
+		while (count < ASYNC_WRITER_BATCH_SIZE && w.queue.TryPop(r)) {
+			if (r.to_console) {
+				ProcessConsoleMessage(r.log_category, r.message, r.file, r.func, r.line, r.origin);
+			}
+
+			if (r.to_file) {
+				// lines in a batch mostly share a second, only re-format the stamp when it changes
+				if (r.time != stamp_time) {
+					stamp_time = r.time;
+					strftime(time_stamp, sizeof(time_stamp), "[%m-%d-%Y %H:%M:%S]", localtime(&stamp_time));
+				}
+
+				file_batch += time_stamp;
+				file_batch += " ";
+				file_batch += r.file_message;
+				file_batch += "\n";
+			}
+
+			++count;
+		}
+
+		const uint64 dropped = w.dropped.load();
+		if (dropped != reported_dropped) {
+			const auto message = fmt::format(
+				"[{}] [{}] Async log queue full, dropped [{}] line(s)",
+				GetPlatformName(),
+				Logs::LogCategoryName[Logs::Warning],
+				dropped - reported_dropped
+			);
+
+			std::cerr << message << std::endl;
+
+			char now_stamp[80];
+			EQEmuLogSys::SetCurrentTimeStamp(now_stamp);
+			file_batch += now_stamp;
+			file_batch += " ";
+			file_batch += message;
+			file_batch += "\n";
+
+			reported_dropped = dropped;
+		}
+
+		if (!file_batch.empty()) {
+			std::lock_guard<std::mutex> lock(process_log_lock);
+			if (process_log) {
+				process_log << file_batch;
+				process_log.flush();
+			}
+
+			file_batch.clear();
+		}
+
+		if (count > 0) {
+			w.written += count;
+			w.pending -= count;
+			continue;
+		}
+
+		if (!w.running) {
+			// a producer may have claimed a slot but not published it yet
+			if (w.queue.IsEmpty()) {
+				return;
+			}
+
+			std::this_thread::yield();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(w.wake_lock);
+		w.idle = true;
+		w.wake.wait_for(
+			lock, std::chrono::milliseconds(50), [&w] {
+				return !w.running || !w.queue.IsEmpty();
+			}
+		);
+		w.idle = false;
+	}
+}
@@ -26,6 +26,7 @@
 #include <cstdio>
 #include <functional>
 #include <algorithm>
+#include <memory>
 
 #ifdef _WIN32
 #ifdef utf16_to_utf8
@@ -384,7 +385,27 @@ public:
 	void DisableMySQLErrorLogs();
 	void EnableMySQLErrorLogs();
 
+	/**
+	 * Hands console and file output to a background writer thread
+	 *
+	 * Out() only formats the line and pushes it into a bounded lock-free ring. When the ring
+	 * is full the line is dropped and counted, or the caller waits for room when
+	 * block_when_full is set. GM say, discord and console hooks still run on the calling
+	 * thread since they touch process state. Crash logs are always written synchronously
+	 *
+	 * @param queue_size
+	 * @param block_when_full
+	 */
+	EQEmuLogSys *StartAsyncWriter(uint32 queue_size, bool block_when_full);
+	void StopAsyncWriter();
+	void FlushAsyncWriter();
+	bool IsAsyncWriterRunning() const;
+	uint64 GetAsyncDroppedCount() const;
+	uint64 GetAsyncWrittenCount() const;
+
 private:
+	struct AsyncRecord;
+	struct AsyncWriter;
 
 	// reference to database
 	Database                                                                        *m_database;
@@ -396,14 +417,17 @@ private:
 	int                                                                             m_log_platform      = 0;
 	std::string                                                                     m_platform_file_name;
 	std::string                                                                     m_log_path;
+	std::unique_ptr<AsyncWriter>                                                    m_async_writer;
 
 	void ProcessConsoleMessage(
 		uint16 log_category,
 		const std::string &message,
 		const char *file,
 		const char *func,
-		int line
+		int line,
+		const OriginationInfo &origin
 	);
+	void ProcessAsyncWriter();
 	void ProcessLogWrite(uint16 log_category, const std::string &message);
 	void InjectTablesIfNotExist();
 };
@@ -0,0 +1,222 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace EQ
+{
+	namespace Event
+	{
+		/**
+		 * Fork/join pool for data parallel loops run from the main thread
+		 *
+		 * ParallelFor splits [0, count) into one contiguous range per thread, the calling thread
+		 * included. Each thread pops indexes off the front of its own range and once it runs dry
+		 * steals the back half of another thread's range, so a few slow items do not leave the
+		 * rest of the pool idle. Ranges are packed begin/end pairs in a single atomic so pops and
+		 * steals are one compare and swap each.
+		 *
+		 * The callback must not throw and must only touch state that is safe to share
+		 */
+		class WorkStealingPool
+		{
+		public:
+			WorkStealingPool(size_t threads) : _running(true), _generation(0), _active(0), _fn(nullptr), _steals(0)
+			{
+				_slot_count = threads + 1;
+				_slots.reset(new Slot[_slot_count]);
+
+				for (size_t i = 0; i < threads; ++i) {
+					_threads.emplace_back(std::thread(std::bind(&WorkStealingPool::ProcessWork, this, i)));
+				}
+			}
+
+			~WorkStealingPool() {
+				{
+					std::unique_lock<std::mutex> lock(_lock);
+					_running = false;
+				}
+
+				_cv.notify_all();
+
+				for (auto &t : _threads) {
+					t.join();
+				}
+			}
+
+			WorkStealingPool(const WorkStealingPool &) = delete;
+			WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+			size_t GetThreadCount() const { return _threads.size(); }
+			uint64_t GetSteals() const { return _steals.load(std::memory_order_relaxed); }
+
+			// one more than GetThreadCount, the thread calling ParallelFor works too
+			size_t GetWorkerCount() const { return _slot_count; }
+
+			// blocks until fn has been called once for every index in [0, count)
+			void ParallelFor(uint32_t count, const std::function<void(uint32_t)> &fn) {
+				ParallelForWithWorker(
+					count,
+					[&fn](uint32_t index, size_t) {
+						fn(index);
+					}
+				);
+			}
+
+			// as ParallelFor, also passes the worker in [0, GetWorkerCount()) running the index so
+			// callers can keep per worker scratch state without locking
+			void ParallelForWithWorker(uint32_t count, const std::function<void(uint32_t, size_t)> &fn) {
+				if (count == 0) {
+					return;
+				}
+
+				if (_threads.empty() || count == 1) {
+					for (uint32_t i = 0; i < count; ++i) {
+						fn(i, _slot_count - 1);
+					}
+					return;
+				}
+
+				const uint32_t per_slot = count / static_cast<uint32_t>(_slot_count);
+				const uint32_t extra    = count % static_cast<uint32_t>(_slot_count);
+
+				uint32_t begin = 0;
+				for (size_t i = 0; i < _slot_count; ++i) {
+					const uint32_t end = begin + per_slot + (i < extra ? 1 : 0);
+					_slots[i].range.store(Pack(begin, end), std::memory_order_relaxed);
+					begin = end;
+				}
+
+				{
+					std::unique_lock<std::mutex> lock(_lock);
+					_fn     = &fn;
+					_active = _threads.size();
+					_generation++;
+				}
+
+				_cv.notify_all();
+
+				RunSlot(_slot_count - 1);
+
+				std::unique_lock<std::mutex> lock(_lock);
+				_done_cv.wait(lock, [this] { return _active == 0; });
+				_fn = nullptr;
+			}
+
+		private:
+			struct alignas(64) Slot
+			{
+				std::atomic<uint64_t> range{0};
+			};
+
+			static uint64_t Pack(uint32_t begin, uint32_t end) {
+				return (static_cast<uint64_t>(begin) << 32) | end;
+			}
+
+			static uint32_t Begin(uint64_t range) { return static_cast<uint32_t>(range >> 32); }
+			static uint32_t End(uint64_t range) { return static_cast<uint32_t>(range); }
+
+			bool Pop(Slot &slot, uint32_t &index) {
+				uint64_t range = slot.range.load(std::memory_order_acquire);
+				for (;;) {
+					const uint32_t begin = Begin(range);
+					const uint32_t end   = End(range);
+					if (begin >= end) {
+						return false;
+					}
+
+					if (slot.range.compare_exchange_weak(range, Pack(begin + 1, end), std::memory_order_acq_rel)) {
+						index = begin;
+						return true;
+					}
+				}
+			}
+
+			// an index is only ever in one range so a range value cannot come back and fool a stale compare
+			bool Steal(size_t thief, uint32_t &begin, uint32_t &end) {
+				for (size_t n = 1; n < _slot_count; ++n) {
+					Slot &victim = _slots[(thief + n) % _slot_count];
+
+					uint64_t range = victim.range.load(std::memory_order_acquire);
+					for (;;) {
+						const uint32_t b = Begin(range);
+						const uint32_t e = End(range);
+						if (b >= e) {
+							break;
+						}
+
+						const uint32_t mid = b + (e - b) / 2;
+						if (victim.range.compare_exchange_weak(range, Pack(b, mid), std::memory_order_acq_rel)) {
+							begin = mid;
+							end   = e;
+							_steals.fetch_add(1, std::memory_order_relaxed);
+							return true;
+						}
+					}
+				}
+
+				return false;
+			}
+
+			void RunSlot(size_t index) {
+				Slot &slot = _slots[index];
+				const std::function<void(uint32_t, size_t)> &fn = *_fn;
+
+				for (;;) {
+					uint32_t i;
+					while (Pop(slot, i)) {
+						fn(i, index);
+					}
+
+					uint32_t begin, end;
+					if (!Steal(index, begin, end)) {
+						return;
+					}
+
+					slot.range.store(Pack(begin, end), std::memory_order_release);
+				}
+			}
+
+			void ProcessWork(size_t index) {
+				uint64_t seen = 0;
+
+				for (;;) {
+					{
+						std::unique_lock<std::mutex> lock(_lock);
+						_cv.wait(lock, [&] { return !_running || _generation != seen; });
+
+						if (!_running) {
+							return;
+						}
+
+						seen = _generation;
+					}
+
+					RunSlot(index);
+
+					std::unique_lock<std::mutex> lock(_lock);
+					if (--_active == 0) {
+						_done_cv.notify_one();
+					}
+				}
+			}
+
+			std::vector<std::thread>                      _threads;
+			std::unique_ptr<Slot[]>                       _slots;
+			size_t                                        _slot_count;
+			std::mutex                                    _lock;
+			std::condition_variable                       _cv;
+			std::condition_variable                       _done_cv;
+			bool                                          _running;
+			uint64_t                                      _generation;
+			size_t                                        _active;
+			const std::function<void(uint32_t, size_t)>   *_fn;
+			std::atomic<uint64_t>                         _steals;
+		};
+	}
+}
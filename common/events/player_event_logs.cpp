@@ -3,6 +3,7 @@
 #include "player_event_discord_formatter.h"
 #include "../platform.h"
 #include "../rulesys.h"
+#include "../util/memory_stream.h"
 
 const uint32 PROCESS_RETENTION_TRUNCATION_TIMER_INTERVAL = 60 * 60 * 1000; // 1 hour
 
@@ -119,19 +120,40 @@ void PlayerEventLogs::ProcessBatchQueue()
 		return;
 	}
 
-	BenchTimer benchmark;
+	// hand the batch off to a pooled connection when one is available
+	// a fixed ordering key keeps batches inserted in the order they were queued
+	constexpr uint64 batch_ordering_key = 1;
 
-	// flush many
-	PlayerEventLogsRepository::InsertMany(*m_database, m_record_batch_queue);
-	LogPlayerEventsDetail(
-		"Processing batch player event log queue of [{}] took [{}]",
-		m_record_batch_queue.size(),
-		benchmark.elapsed()
+	auto batch = std::make_shared<std::vector<PlayerEventLogsRepository::PlayerEventLogs>>(
+		std::move(m_record_batch_queue)
 	);
 
 	// empty
 	m_record_batch_queue = {};
 	m_batch_queue_lock.unlock();
+
+	const size_t max_query_bytes = static_cast<size_t>(RuleI(Logging, BatchPlayerEventInsertBytes));
+
+	m_database->RunAsync(
+		[batch, max_query_bytes](Database &db) {
+			BenchTimer benchmark;
+
+			// json is only rendered here, off the main thread
+			for (auto &e: *batch) {
+				e.event_data = GetEventDataJson(e.event_type_id, e.event_data);
+			}
+
+			// flush many
+			PlayerEventLogsRepository::InsertManyByBytes(db, *batch, max_query_bytes);
+			LogPlayerEventsDetail(
+				"Processing batch player event log queue of [{}] took [{}]",
+				batch->size(),
+				benchmark.elapsed()
+			);
+		},
+		nullptr,
+		batch_ordering_key
+	);
 }
 
 // adds a player event to the queue
@@ -262,74 +284,154 @@ std::string PlayerEventLogs::GetDiscordWebhookUrlFromEventType(int32_t event_typ
 // BANDOLIER_SWAP       | [] Implemented Formatter
 // DISCOVER_ITEM        | [X] Implemented Formatter
 
+// decodes the binary event data built by RecordEvent
+template<typename T>
+static T DecodeEventData(const std::string &event_data)
+{
+	T e{};
+	if (event_data.empty()) {
+		return e;
+	}
+
+	EQ::Util::MemoryStreamReader ss(const_cast<char *>(event_data.data()), event_data.size());
+	cereal::BinaryInputArchive   ar(ss);
+	e.serialize(ar);
+
+	return e;
+}
+
+template<typename T>
+static std::string RenderEventDataJson(const std::string &event_data)
+{
+	auto e = DecodeEventData<T>(event_data);
+
+	std::stringstream ss;
+	{
+		cereal::JSONOutputArchiveSingleLine ar(ss);
+		e.serialize(ar);
+	}
+
+	return ss.str();
+}
+
+std::string PlayerEventLogs::GetEventDataJson(int32_t event_type_id, const std::string &event_data)
+{
+	// events with no extra data
+	if (event_data.empty()) {
+		return "{}";
+	}
+
+	try {
+		switch (event_type_id) {
+			case PlayerEvent::GM_COMMAND:
+				return RenderEventDataJson<PlayerEvent::GMCommandEvent>(event_data);
+			case PlayerEvent::ZONING:
+				return RenderEventDataJson<PlayerEvent::ZoningEvent>(event_data);
+			case PlayerEvent::AA_GAIN:
+				return RenderEventDataJson<PlayerEvent::AAGainedEvent>(event_data);
+			case PlayerEvent::AA_PURCHASE:
+				return RenderEventDataJson<PlayerEvent::AAPurchasedEvent>(event_data);
+			case PlayerEvent::FORAGE_SUCCESS:
+				return RenderEventDataJson<PlayerEvent::ForageSuccessEvent>(event_data);
+			case PlayerEvent::FISH_SUCCESS:
+				return RenderEventDataJson<PlayerEvent::FishSuccessEvent>(event_data);
+			case PlayerEvent::ITEM_DESTROY:
+				return RenderEventDataJson<PlayerEvent::DestroyItemEvent>(event_data);
+			case PlayerEvent::LEVEL_GAIN:
+				return RenderEventDataJson<PlayerEvent::LevelGainedEvent>(event_data);
+			case PlayerEvent::LEVEL_LOSS:
+				return RenderEventDataJson<PlayerEvent::LevelLostEvent>(event_data);
+			case PlayerEvent::LOOT_ITEM:
+				return RenderEventDataJson<PlayerEvent::LootItemEvent>(event_data);
+			case PlayerEvent::MERCHANT_PURCHASE:
+				return RenderEventDataJson<PlayerEvent::MerchantPurchaseEvent>(event_data);
+			case PlayerEvent::MERCHANT_SELL:
+				return RenderEventDataJson<PlayerEvent::MerchantSellEvent>(event_data);
+			case PlayerEvent::GROUNDSPAWN_PICKUP:
+				return RenderEventDataJson<PlayerEvent::GroundSpawnPickupEvent>(event_data);
+			case PlayerEvent::NPC_HANDIN:
+				return RenderEventDataJson<PlayerEvent::HandinEvent>(event_data);
+			case PlayerEvent::SKILL_UP:
+				return RenderEventDataJson<PlayerEvent::SkillUpEvent>(event_data);
+			case PlayerEvent::TASK_ACCEPT:
+				return RenderEventDataJson<PlayerEvent::TaskAcceptEvent>(event_data);
+			case PlayerEvent::TASK_UPDATE:
+				return RenderEventDataJson<PlayerEvent::TaskUpdateEvent>(event_data);
+			case PlayerEvent::TASK_COMPLETE:
+				return RenderEventDataJson<PlayerEvent::TaskCompleteEvent>(event_data);
+			case PlayerEvent::TRADE:
+				return RenderEventDataJson<PlayerEvent::TradeEvent>(event_data);
+			case PlayerEvent::SAY:
+				return RenderEventDataJson<PlayerEvent::SayEvent>(event_data);
+			case PlayerEvent::REZ_ACCEPTED:
+				return RenderEventDataJson<PlayerEvent::ResurrectAcceptEvent>(event_data);
+			case PlayerEvent::DEATH:
+				return RenderEventDataJson<PlayerEvent::DeathEvent>(event_data);
+			case PlayerEvent::COMBINE_FAILURE:
+			case PlayerEvent::COMBINE_SUCCESS:
+				return RenderEventDataJson<PlayerEvent::CombineEvent>(event_data);
+			case PlayerEvent::DROPPED_ITEM:
+				return RenderEventDataJson<PlayerEvent::DroppedItemEvent>(event_data);
+			case PlayerEvent::SPLIT_MONEY:
+				return RenderEventDataJson<PlayerEvent::SplitMoneyEvent>(event_data);
+			case PlayerEvent::TRADER_PURCHASE:
+				return RenderEventDataJson<PlayerEvent::TraderPurchaseEvent>(event_data);
+			case PlayerEvent::TRADER_SELL:
+				return RenderEventDataJson<PlayerEvent::TraderSellEvent>(event_data);
+			case PlayerEvent::DISCOVER_ITEM:
+				return RenderEventDataJson<PlayerEvent::DiscoverItemEvent>(event_data);
+			case PlayerEvent::POSSIBLE_HACK:
+				return RenderEventDataJson<PlayerEvent::PossibleHackEvent>(event_data);
+			case PlayerEvent::KILLED_NPC:
+			case PlayerEvent::KILLED_NAMED_NPC:
+			case PlayerEvent::KILLED_RAID_NPC:
+				return RenderEventDataJson<PlayerEvent::KilledNPCEvent>(event_data);
+			case PlayerEvent::ITEM_CREATION:
+				return RenderEventDataJson<PlayerEvent::ItemCreationEvent>(event_data);
+			default:
+				LogPlayerEvents("No event data renderer for event type [{}]", event_type_id);
+				break;
+		}
+	}
+	catch (const std::exception &ex) {
+		LogError("Failed to render event data for event type [{}] error [{}]", event_type_id, ex.what());
+	}
+
+	return "{}";
+}
+
 std::string PlayerEventLogs::GetDiscordPayloadFromEvent(const PlayerEvent::PlayerEventContainer &e)
 {
 	std::string payload;
 	switch (e.player_event_log.event_type_id) {
 		case PlayerEvent::AA_GAIN: {
-			PlayerEvent::AAGainedEvent n{};
-			std::stringstream          ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::AAGainedEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatAAGainedEvent(e, n);
 			break;
 		}
 		case PlayerEvent::AA_PURCHASE: {
-			PlayerEvent::AAPurchasedEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::AAPurchasedEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatAAPurchasedEvent(e, n);
 			break;
 		}
 		case PlayerEvent::COMBINE_FAILURE:
 		case PlayerEvent::COMBINE_SUCCESS: {
-			PlayerEvent::CombineEvent n{};
-			std::stringstream         ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::CombineEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatCombineEvent(e, n);
 			break;
 		}
 		case PlayerEvent::DEATH: {
-			PlayerEvent::DeathEvent n{};
-			std::stringstream       ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::DeathEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatDeathEvent(e, n);
 			break;
 		}
 		case PlayerEvent::DISCOVER_ITEM: {
-			PlayerEvent::DiscoverItemEvent n{};
-			std::stringstream              ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::DiscoverItemEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatDiscoverItemEvent(e, n);
 			break;
 		}
 		case PlayerEvent::DROPPED_ITEM: {
-			PlayerEvent::DroppedItemEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::DroppedItemEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatDroppedItemEvent(e, n);
 			break;
 		}
@@ -341,246 +443,114 @@ std::string PlayerEventLogs::GetDiscordPayloadFromEvent(const PlayerEvent::Playe
 			break;
 		}
 		case PlayerEvent::FISH_SUCCESS: {
-			PlayerEvent::FishSuccessEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::FishSuccessEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatFishSuccessEvent(e, n);
 			break;
 		}
 		case PlayerEvent::FORAGE_SUCCESS: {
-			PlayerEvent::ForageSuccessEvent n{};
-			std::stringstream               ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::ForageSuccessEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatForageSuccessEvent(e, n);
 			break;
 		}
 		case PlayerEvent::ITEM_DESTROY: {
-			PlayerEvent::DestroyItemEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::DestroyItemEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatDestroyItemEvent(e, n);
 			break;
 		}
 		case PlayerEvent::LEVEL_GAIN: {
-			PlayerEvent::LevelGainedEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::LevelGainedEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatLevelGainedEvent(e, n);
 			break;
 		}
 		case PlayerEvent::LEVEL_LOSS: {
-			PlayerEvent::LevelLostEvent n{};
-			std::stringstream           ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::LevelLostEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatLevelLostEvent(e, n);
 			break;
 		}
 		case PlayerEvent::LOOT_ITEM: {
-			PlayerEvent::LootItemEvent n{};
-			std::stringstream          ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::LootItemEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatLootItemEvent(e, n);
 			break;
 		}
 		case PlayerEvent::GROUNDSPAWN_PICKUP: {
-			PlayerEvent::GroundSpawnPickupEvent n{};
-			std::stringstream                   ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::GroundSpawnPickupEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatGroundSpawnPickupEvent(e, n);
 			break;
 		}
 		case PlayerEvent::NPC_HANDIN: {
-			PlayerEvent::HandinEvent n{};
-			std::stringstream        ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::HandinEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatNPCHandinEvent(e, n);
 			break;
 		}
 		case PlayerEvent::SAY: {
-			PlayerEvent::SayEvent n{};
-			std::stringstream     ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::SayEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatEventSay(e, n);
 			break;
 		}
 		case PlayerEvent::GM_COMMAND: {
-			PlayerEvent::GMCommandEvent n{};
-			std::stringstream           ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::GMCommandEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatGMCommand(e, n);
 			break;
 		}
 		case PlayerEvent::SKILL_UP: {
-			PlayerEvent::SkillUpEvent n{};
-			std::stringstream         ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::SkillUpEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatSkillUpEvent(e, n);
 			break;
 		}
 		case PlayerEvent::SPLIT_MONEY: {
-			PlayerEvent::SplitMoneyEvent n{};
-			std::stringstream            ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::SplitMoneyEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatSplitMoneyEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TASK_ACCEPT: {
-			PlayerEvent::TaskAcceptEvent n{};
-			std::stringstream            ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::TaskAcceptEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatTaskAcceptEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TASK_COMPLETE: {
-			PlayerEvent::TaskCompleteEvent n{};
-			std::stringstream              ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::TaskCompleteEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatTaskCompleteEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TASK_UPDATE: {
-			PlayerEvent::TaskUpdateEvent n{};
-			std::stringstream            ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::TaskUpdateEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatTaskUpdateEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TRADE: {
-			PlayerEvent::TradeEvent n{};
-			std::stringstream       ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::TradeEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatTradeEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TRADER_PURCHASE: {
-			PlayerEvent::TraderPurchaseEvent n{};
-			std::stringstream                ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::TraderPurchaseEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatTraderPurchaseEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TRADER_SELL: {
-			PlayerEvent::TraderSellEvent n{};
-			std::stringstream            ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::TraderSellEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatTraderSellEvent(e, n);
 			break;
 		}
 		case PlayerEvent::REZ_ACCEPTED: {
-			PlayerEvent::ResurrectAcceptEvent n{};
-			std::stringstream                 ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::ResurrectAcceptEvent>(e.player_event_log.event_data);
 			payload = PlayerEventDiscordFormatter::FormatResurrectAcceptEvent(e, n);
 			break;
 		}
 		case PlayerEvent::MERCHANT_PURCHASE: {
-			PlayerEvent::MerchantPurchaseEvent n{};
-			std::stringstream                  ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::MerchantPurchaseEvent>(e.player_event_log.event_data);
 
 			payload = PlayerEventDiscordFormatter::FormatMerchantPurchaseEvent(e, n);
 			break;
 		}
 		case PlayerEvent::MERCHANT_SELL: {
-			PlayerEvent::MerchantSellEvent n{};
-			std::stringstream              ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::MerchantSellEvent>(e.player_event_log.event_data);
 
 			payload = PlayerEventDiscordFormatter::FormatMerchantSellEvent(e, n);
 			break;
 		}
 		case PlayerEvent::ZONING: {
-			PlayerEvent::ZoningEvent n{};
-			std::stringstream        ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			auto n = DecodeEventData<PlayerEvent::ZoningEvent>(e.player_event_log.event_data);
 
 			payload = PlayerEventDiscordFormatter::FormatZoningEvent(e, n);
 			break;
@@ -7,8 +7,10 @@
 #include "../repositories/player_event_logs_repository.h"
 #include "../timer.h"
 #include "../json/json_archive_single_line.h"
+#include <cereal/archives/binary.hpp>
 #include <cereal/archives/json.hpp>
 #include <mutex>
+#include <type_traits>
 
 class PlayerEventLogs {
 public:
@@ -36,14 +38,18 @@ public:
 		FillPlayerEvent(p, n);
 		n.event_type_id = t;
 
-		std::stringstream ss;
-		{
-			cereal::JSONOutputArchiveSingleLine ar(ss);
-			e.serialize(ar);
+		// event data travels as compact binary, it is rendered to json by GetEventDataJson when the batch is written
+		if constexpr (!std::is_same<T, PlayerEvent::EmptyEvent>::value) {
+			std::stringstream ss;
+			{
+				cereal::BinaryOutputArchive ar(ss);
+				e.serialize(ar);
+			}
+
+			n.event_data = ss.str();
 		}
 
 		n.event_type_name = PlayerEvent::EventName[t];
-		n.event_data      = Strings::Contains(ss.str(), "noop") ? "{}" : ss.str();
 		n.created_at      = std::time(nullptr);
 
 		auto c = PlayerEvent::PlayerEventContainer{
@@ -59,6 +65,9 @@ public:
 	std::string GetDiscordWebhookUrlFromEventType(int32_t event_type_id);
 
 	static std::string GetDiscordPayloadFromEvent(const PlayerEvent::PlayerEventContainer &e);
+
+	// renders the binary event data built by RecordEvent as the json stored in player_event_logs
+	static std::string GetEventDataJson(int32_t event_type_id, const std::string &event_data);
 private:
 	Database                                                 *m_database; // reference to database
 	PlayerEventLogSettingsRepository::PlayerEventLogSettings m_settings[PlayerEvent::EventType::MAX]{};
@@ -56,11 +56,16 @@ struct LootDropEntries_Struct {
 	uint16 npc_min_level;
 	uint16 npc_max_level;
 	uint8  multiplier;
+	float  cumulative_chance; // running total of chance through this entry, compiled by shared memory
 };
 
 struct LootDrop_Struct {
 	uint32                 NumEntries;
 	ContentFlags           content_flags;
+	float                  total_chance;   // sum of every entry chance
+	float                  no_loot_chance; // odds that no entry under 100 percent would drop by itself
+	uint8                  roll_bypass;    // an entry has a chance of 100 or more
+	uint8                  level_limited;  // an entry has npc level requirements, its table is narrowed per npc
 	LootDropEntries_Struct Entries[0];
 };
 #pragma pack()
@@ -0,0 +1,123 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2020 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+#ifndef EQEMU_MPSC_RING_BUFFER_H
+#define EQEMU_MPSC_RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/**
+ * Bounded lock-free ring for many producers and a single consumer
+ *
+ * Each slot carries a sequence number that tells producers and the consumer whether the
+ * slot is free for the current lap, so neither side ever takes a lock. Capacity is rounded
+ * up to a power of two. TryPush fails instead of waiting when the ring is full
+ */
+template<typename T>
+class MPSCRingBuffer {
+public:
+	explicit MPSCRingBuffer(size_t capacity)
+	{
+		size_t size = 2;
+		while (size < capacity) {
+			size <<= 1;
+		}
+
+		m_mask  = size - 1;
+		m_slots = std::make_unique<Slot[]>(size);
+
+		for (size_t i = 0; i < size; ++i) {
+			m_slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		m_head.store(0, std::memory_order_relaxed);
+		m_tail.store(0, std::memory_order_relaxed);
+	}
+
+	MPSCRingBuffer(const MPSCRingBuffer &) = delete;
+	MPSCRingBuffer &operator=(const MPSCRingBuffer &) = delete;
+
+	bool TryPush(T &&value)
+	{
+		size_t pos = m_head.load(std::memory_order_relaxed);
+		for (;;) {
+			auto   &slot = m_slots[pos & m_mask];
+			size_t seq   = slot.sequence.load(std::memory_order_acquire);
+			auto   diff  = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+			if (diff == 0) {
+				if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					slot.value = std::move(value);
+					slot.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0) {
+				return false;
+			}
+			else {
+				pos = m_head.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// consumer side, must only be called from a single thread
+	bool TryPop(T &out)
+	{
+		size_t pos  = m_tail.load(std::memory_order_relaxed);
+		auto   &slot = m_slots[pos & m_mask];
+		size_t seq  = slot.sequence.load(std::memory_order_acquire);
+
+		if (static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1) < 0) {
+			return false;
+		}
+
+		out = std::move(slot.value);
+		slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+		m_tail.store(pos + 1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	inline size_t GetCapacity() const { return m_mask + 1; }
+
+	inline bool IsEmpty() const
+	{
+		return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+	}
+
+private:
+	struct Slot {
+		std::atomic<size_t> sequence;
+		T                   value;
+	};
+
+	std::unique_ptr<Slot[]> m_slots;
+	size_t                  m_mask;
+
+	// producers and consumer hammer different indexes, keep them off the same cache line
+	alignas(64) std::atomic<size_t> m_head;
+	alignas(64) std::atomic<size_t> m_tail;
+};
+
+#endif //EQEMU_MPSC_RING_BUFFER_H
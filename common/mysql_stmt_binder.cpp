@@ -0,0 +1,100 @@
+#include "mysql_stmt_binder.h"
+
+#include <string.h>
+
+void MySQLStmtBinder::AddColumn(
+	enum_field_types type,
+	void *target,
+	unsigned long target_size,
+	bool is_unsigned,
+	std::string *str
+)
+{
+	Column c{};
+	c.type        = type;
+	c.target      = target;
+	c.target_size = target_size;
+	c.is_unsigned = is_unsigned;
+	c.str         = str;
+
+	m_columns.emplace_back(std::move(c));
+}
+
+int MySQLStmtBinder::Fetch(MYSQL_STMT *stmt)
+{
+	if (mysql_stmt_field_count(stmt) != m_columns.size()) {
+		return -1;
+	}
+
+	// binds are built here rather than in Bind so column addresses are stable
+	m_binds.resize(m_columns.size());
+	memset(m_binds.data(), 0, sizeof(MYSQL_BIND) * m_binds.size());
+
+	for (size_t i = 0; i < m_columns.size(); ++i) {
+		auto &c = m_columns[i];
+		auto &b = m_binds[i];
+
+		b.buffer_type = c.type;
+		b.is_null     = &c.is_null;
+		b.error       = &c.error;
+		b.length      = &c.length;
+
+		if (c.str) {
+			c.buffer.resize(DEFAULT_STRING_BUFFER);
+			b.buffer        = c.buffer.data();
+			b.buffer_length = static_cast<unsigned long>(c.buffer.size());
+		}
+		else {
+			b.buffer        = c.target;
+			b.buffer_length = c.target_size;
+			b.is_unsigned   = c.is_unsigned;
+		}
+	}
+
+	if (mysql_stmt_bind_result(stmt, m_binds.data()) != 0) {
+		return -1;
+	}
+
+	int status = mysql_stmt_fetch(stmt);
+	if (status == MYSQL_NO_DATA) {
+		return 0;
+	}
+
+	// MYSQL_DATA_TRUNCATED is expected for long strings and narrowed integers, same as the text path casts
+	if (status != 0 && status != MYSQL_DATA_TRUNCATED) {
+		return -1;
+	}
+
+	for (size_t i = 0; i < m_columns.size(); ++i) {
+		auto &c = m_columns[i];
+		auto &b = m_binds[i];
+
+		if (!c.str) {
+			if (c.is_null) {
+				memset(c.target, 0, c.target_size);
+			}
+
+			continue;
+		}
+
+		if (c.is_null) {
+			c.str->clear();
+			continue;
+		}
+
+		// string was larger than our scratch buffer, pull the remainder of the column
+		if (c.length > b.buffer_length) {
+			c.buffer.resize(c.length);
+			b.buffer        = c.buffer.data();
+			b.buffer_length = c.length;
+
+			if (mysql_stmt_fetch_column(stmt, &b, static_cast<unsigned int>(i), 0) != 0) {
+				return -1;
+			}
+		}
+
+		c.str->assign(c.buffer.data(), c.length);
+	}
+
+	return 1;
+}
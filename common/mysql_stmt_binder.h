@@ -0,0 +1,74 @@
+#ifndef MYSQL_STMT_BINDER_H
+#define MYSQL_STMT_BINDER_H
+
+#ifdef _WINDOWS
+	#include <winsock2.h>
+	#include <windows.h>
+#endif
+
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <mysql.h>
+#include "types.h"
+
+/**
+ * Binds prepared statement result columns straight into entity fields
+ *
+ * Columns are bound in call order, which must match the statement's select list.
+ * Integer and floating point columns are converted by the client library into the
+ * target field's type, strings are copied out after the fetch
+ */
+class MySQLStmtBinder {
+public:
+	// my_bool on MariaDB / older MySQL, bool on MySQL 8
+	typedef std::remove_pointer_t<decltype(MYSQL_BIND::is_null)> null_flag_t;
+
+	template<typename T>
+	std::enable_if_t<std::is_integral_v<T>> Bind(T &v)
+	{
+		enum_field_types type = MYSQL_TYPE_LONGLONG;
+		if constexpr (sizeof(T) == 1) {
+			type = MYSQL_TYPE_TINY;
+		}
+		else if constexpr (sizeof(T) == 2) {
+			type = MYSQL_TYPE_SHORT;
+		}
+		else if constexpr (sizeof(T) == 4) {
+			type = MYSQL_TYPE_LONG;
+		}
+
+		AddColumn(type, &v, sizeof(T), std::is_unsigned_v<T>, nullptr);
+	}
+
+	inline void Bind(float &v) { AddColumn(MYSQL_TYPE_FLOAT, &v, sizeof(float), false, nullptr); }
+	inline void Bind(double &v) { AddColumn(MYSQL_TYPE_DOUBLE, &v, sizeof(double), false, nullptr); }
+	inline void Bind(std::string &v) { AddColumn(MYSQL_TYPE_STRING, nullptr, 0, false, &v); }
+
+	inline size_t GetColumnCount() const { return m_columns.size(); }
+
+	// binds the result buffers and fetches a single row, returns 1 on row, 0 on no data, -1 on error
+	int Fetch(MYSQL_STMT *stmt);
+
+private:
+	static constexpr unsigned long DEFAULT_STRING_BUFFER = 256;
+
+	struct Column {
+		enum_field_types type;
+		void             *target;
+		unsigned long    target_size;
+		bool             is_unsigned;
+		std::string      *str;
+		std::string      buffer;
+		unsigned long    length;
+		null_flag_t      is_null;
+		null_flag_t      error;
+	};
+
+	void AddColumn(enum_field_types type, void *target, unsigned long target_size, bool is_unsigned, std::string *str);
+
+	std::vector<Column>     m_columns;
+	std::vector<MYSQL_BIND> m_binds;
+};
+
+#endif
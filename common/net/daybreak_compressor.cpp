@@ -0,0 +1,144 @@
+#include "daybreak_compressor.h"
+#include "daybreak_connection.h"
+#include <string.h>
+
+EQ::Net::DaybreakCompressor::DaybreakCompressor(size_t min_size)
+{
+	m_min_size = min_size;
+
+	memset(&m_deflate, 0, sizeof(m_deflate));
+	memset(&m_inflate, 0, sizeof(m_inflate));
+
+	m_deflate_ready = deflateInit(&m_deflate, Z_BEST_SPEED) == Z_OK;
+	m_inflate_ready = inflateInit2(&m_inflate, 15) == Z_OK;
+}
+
+EQ::Net::DaybreakCompressor::~DaybreakCompressor()
+{
+	if (m_deflate_ready) {
+		deflateEnd(&m_deflate);
+	}
+
+	if (m_inflate_ready) {
+		inflateEnd(&m_inflate);
+	}
+}
+
+uint32_t EQ::Net::DaybreakCompressor::Deflate(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len)
+{
+	if (!in || !m_deflate_ready) {
+		return 0;
+	}
+
+	m_deflate.next_in = const_cast<unsigned char *>(in);
+	m_deflate.avail_in = in_len;
+	m_deflate.next_out = out;
+	m_deflate.avail_out = out_len;
+
+	int zerror = deflate(&m_deflate, Z_FINISH);
+	uint32_t written = (zerror == Z_STREAM_END) ? (uint32_t)m_deflate.total_out : 0;
+
+	//keeps the window and hash tables, only clears the stream state
+	m_deflate_ready = deflateReset(&m_deflate) == Z_OK;
+
+	return written;
+}
+
+uint32_t EQ::Net::DaybreakCompressor::Inflate(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len)
+{
+	if (!in || !m_inflate_ready) {
+		return 0;
+	}
+
+	m_inflate.next_in = const_cast<unsigned char *>(in);
+	m_inflate.avail_in = in_len;
+	m_inflate.next_out = out;
+	m_inflate.avail_out = out_len;
+
+	int zerror = inflate(&m_inflate, Z_FINISH);
+	uint32_t written = (zerror == Z_STREAM_END) ? (uint32_t)m_inflate.total_out : 0;
+
+	m_inflate_ready = inflateReset(&m_inflate) == Z_OK;
+
+	return written;
+}
+
+void EQ::Net::DaybreakCompressor::RecordCompress(uint8_t opcode, size_t in, size_t out, bool skipped, uint64_t nanoseconds)
+{
+	auto &s = m_compress_stats[opcode];
+	s.packets++;
+	s.bytes_in += in;
+	s.bytes_out += out;
+	s.nanoseconds += nanoseconds;
+
+	if (skipped) {
+		s.skipped++;
+	}
+}
+
+void EQ::Net::DaybreakCompressor::RecordDecompress(uint8_t opcode, size_t in, size_t out, uint64_t nanoseconds)
+{
+	auto &s = m_decompress_stats[opcode];
+	s.packets++;
+	s.bytes_in += in;
+	s.bytes_out += out;
+	s.nanoseconds += nanoseconds;
+}
+
+void EQ::Net::DaybreakCompressor::ResetStats()
+{
+	for (int i = 0; i < 256; ++i) {
+		m_compress_stats[i].Reset();
+		m_decompress_stats[i].Reset();
+	}
+}
+
+const char *EQ::Net::DaybreakCompressor::GetOpcodeName(uint8_t opcode)
+{
+	switch (opcode) {
+		case OP_Padding:
+			return "Raw";
+		case OP_SessionRequest:
+			return "SessionRequest";
+		case OP_SessionResponse:
+			return "SessionResponse";
+		case OP_Combined:
+			return "Combined";
+		case OP_SessionDisconnect:
+			return "SessionDisconnect";
+		case OP_KeepAlive:
+			return "KeepAlive";
+		case OP_SessionStatRequest:
+			return "SessionStatRequest";
+		case OP_SessionStatResponse:
+			return "SessionStatResponse";
+		case OP_Packet:
+		case OP_Packet2:
+		case OP_Packet3:
+		case OP_Packet4:
+			return "Packet";
+		case OP_Fragment:
+		case OP_Fragment2:
+		case OP_Fragment3:
+		case OP_Fragment4:
+			return "Fragment";
+		case OP_OutOfOrderAck:
+		case OP_OutOfOrderAck2:
+		case OP_OutOfOrderAck3:
+		case OP_OutOfOrderAck4:
+			return "OutOfOrderAck";
+		case OP_Ack:
+		case OP_Ack2:
+		case OP_Ack3:
+		case OP_Ack4:
+			return "Ack";
+		case OP_AppCombined:
+			return "AppCombined";
+		case OP_OutboundPing:
+			return "OutboundPing";
+		case OP_OutOfSession:
+			return "OutOfSession";
+		default:
+			return "Unknown";
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <zlib.h>
+#include <cstdint>
+#include <cstddef>
+
+namespace EQ
+{
+	namespace Net
+	{
+		struct DaybreakCompressionStats
+		{
+			DaybreakCompressionStats() {
+				Reset();
+			}
+
+			void Reset() {
+				packets = 0;
+				skipped = 0;
+				bytes_in = 0;
+				bytes_out = 0;
+				nanoseconds = 0;
+			}
+
+			uint64_t packets;
+			uint64_t skipped; //sent with the uncompressed marker by policy or because deflate did not help
+			uint64_t bytes_in;
+			uint64_t bytes_out;
+			uint64_t nanoseconds;
+		};
+
+		/**
+		 * Wire compression for every connection on a DaybreakConnectionManager
+		 *
+		 * One deflate and one inflate stream live as long as the manager and are reset between packets rather
+		 * than having zlib allocate and free its window for each one. A manager's connections are all serviced
+		 * from its event loop thread so the streams are never used concurrently.
+		 *
+		 * Subclass and hand to DaybreakConnectionManager::SetCompressor to change the algorithm or the policy,
+		 * stats are kept per protocol opcode, raw application packets are counted under OP_Padding
+		 */
+		class DaybreakCompressor
+		{
+		public:
+			DaybreakCompressor(size_t min_size);
+			virtual ~DaybreakCompressor();
+
+			DaybreakCompressor(const DaybreakCompressor &) = delete;
+			DaybreakCompressor &operator=(const DaybreakCompressor &) = delete;
+
+			//packets this returns false for go out with the uncompressed marker without touching zlib
+			virtual bool ShouldCompress(uint8_t opcode, size_t length) const { return length > m_min_size; }
+
+			//both return the number of bytes written to out, 0 on failure
+			virtual uint32_t Deflate(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len);
+			virtual uint32_t Inflate(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len);
+
+			void RecordCompress(uint8_t opcode, size_t in, size_t out, bool skipped, uint64_t nanoseconds);
+			void RecordDecompress(uint8_t opcode, size_t in, size_t out, uint64_t nanoseconds);
+
+			const DaybreakCompressionStats& GetCompressStats(uint8_t opcode) const { return m_compress_stats[opcode]; }
+			const DaybreakCompressionStats& GetDecompressStats(uint8_t opcode) const { return m_decompress_stats[opcode]; }
+			void ResetStats();
+
+			size_t GetMinSize() const { return m_min_size; }
+			void SetMinSize(size_t min_size) { m_min_size = min_size; }
+
+			static const char *GetOpcodeName(uint8_t opcode);
+		private:
+			size_t m_min_size;
+			z_stream m_deflate;
+			z_stream m_inflate;
+			bool m_deflate_ready;
+			bool m_inflate_ready;
+			DaybreakCompressionStats m_compress_stats[256];
+			DaybreakCompressionStats m_decompress_stats[256];
+		};
+	}
+}
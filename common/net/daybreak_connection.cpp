@@ -4,15 +4,74 @@
 #include "../data_verification.h"
 #include "crc32.h"
 #include "../eqemu_logsys.h"
-#include <zlib.h>
 #include <fmt/format.h>
 #include <sstream>
+#include <algorithm>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <errno.h>
+
+//pooled buffers for draining the socket with recvmmsg and flushing queued sends with sendmmsg
+struct EQ::Net::DaybreakBatchIO
+{
+	//comfortably over any max_packet_size a client will negotiate, anything longer is dropped
+	static constexpr size_t recv_buffer_size = 2048;
+
+	//wakeups drain at most this many batches so a flood can not starve the rest of the loop
+	static constexpr size_t max_recv_batches = 8;
+
+	DaybreakBatchIO(int socket_fd, size_t size) {
+		fd = socket_fd;
+		batch_size = size;
+		send_count = 0;
+
+		recv_buffers.reset(new char[recv_buffer_size * batch_size]);
+		recv_addrs.resize(batch_size);
+		recv_iovs.resize(batch_size);
+		recv_msgs.resize(batch_size);
+
+		for (size_t i = 0; i < batch_size; ++i) {
+			recv_iovs[i].iov_base = &recv_buffers[recv_buffer_size * i];
+			recv_iovs[i].iov_len = recv_buffer_size;
+		}
+
+		send_iovs.resize(batch_size);
+		send_msgs.resize(batch_size);
+	}
+
+	int fd;
+	size_t batch_size;
+
+	std::unique_ptr<char[]> recv_buffers;
+	std::vector<sockaddr_in> recv_addrs;
+	std::vector<iovec> recv_iovs;
+	std::vector<mmsghdr> recv_msgs;
+
+	//slots are reused between flushes so steady state sends do not allocate
+	std::vector<std::vector<char>> send_buffers;
+	std::vector<sockaddr_in> send_addrs;
+	std::vector<iovec> send_iovs;
+	std::vector<mmsghdr> send_msgs;
+	size_t send_count;
+};
+#else
+struct EQ::Net::DaybreakBatchIO
+{
+};
+#endif
 
 EQ::Net::DaybreakConnectionManager::DaybreakConnectionManager()
 {
 	m_attached = nullptr;
 	memset(&m_timer, 0, sizeof(uv_timer_t));
 	memset(&m_socket, 0, sizeof(uv_udp_t));
+	m_poll = nullptr;
+	m_flush = nullptr;
+	m_flush_check = nullptr;
+	m_compressor.reset(new DaybreakCompressor(m_options.compress_min_size));
 
 	Attach(EQ::EventLoop::Get().Handle());
 }
@@ -23,6 +82,10 @@ EQ::Net::DaybreakConnectionManager::DaybreakConnectionManager(const DaybreakConn
 	m_options = opts;
 	memset(&m_timer, 0, sizeof(uv_timer_t));
 	memset(&m_socket, 0, sizeof(uv_udp_t));
+	m_poll = nullptr;
+	m_flush = nullptr;
+	m_flush_check = nullptr;
+	m_compressor.reset(new DaybreakCompressor(m_options.compress_min_size));
 
 	Attach(EQ::EventLoop::Get().Handle());
 }
@@ -53,6 +116,11 @@ void EQ::Net::DaybreakConnectionManager::Attach(uv_loop_t *loop)
 		uv_ip4_addr("0.0.0.0", m_options.port, &recv_addr);
 		int rc = uv_udp_bind(&m_socket, (const struct sockaddr *)&recv_addr, UV_UDP_REUSEADDR);
 
+		if (m_options.batched_io && AttachBatchedIO(loop)) {
+			m_attached = loop;
+			return;
+		}
+
 		rc = uv_udp_recv_start(&m_socket,
 			[](uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf) {
 			buf->base = new char[suggested_size];
@@ -66,6 +134,9 @@ void EQ::Net::DaybreakConnectionManager::Attach(uv_loop_t *loop)
 				return;
 			}
 
+			c->m_socket_stats.recv_syscalls++;
+			c->m_socket_stats.recv_datagrams++;
+
 			char endpoint[16];
 			uv_ip4_name((const sockaddr_in*)addr, endpoint, 16);
 			auto port = ntohs(((const sockaddr_in*)addr)->sin_port);
@@ -80,12 +151,212 @@ void EQ::Net::DaybreakConnectionManager::Attach(uv_loop_t *loop)
 void EQ::Net::DaybreakConnectionManager::Detach()
 {
 	if (m_attached) {
-		uv_udp_recv_stop(&m_socket);
+		if (m_batch) {
+			BatchFlush();
+			uv_poll_stop(m_poll);
+			uv_prepare_stop(m_flush);
+			uv_check_stop(m_flush_check);
+
+			//the loop may still reference the handles until the close callbacks run, so they are freed there
+			uv_close((uv_handle_t*)m_poll, [](uv_handle_t* handle) {
+				delete (uv_poll_t *)handle;
+			});
+			uv_close((uv_handle_t*)m_flush, [](uv_handle_t* handle) {
+				delete (uv_prepare_t *)handle;
+			});
+			uv_close((uv_handle_t*)m_flush_check, [](uv_handle_t* handle) {
+				delete (uv_check_t *)handle;
+			});
+
+			m_poll = nullptr;
+			m_flush = nullptr;
+			m_flush_check = nullptr;
+			m_batch.reset();
+		}
+		else {
+			uv_udp_recv_stop(&m_socket);
+		}
+
 		uv_timer_stop(&m_timer);
 		m_attached = nullptr;
 	}
 }
 
+#ifdef __linux__
+bool EQ::Net::DaybreakConnectionManager::AttachBatchedIO(uv_loop_t *loop)
+{
+	uv_os_fd_t fd;
+	if (uv_fileno((uv_handle_t*)&m_socket, &fd) != 0) {
+		LogError("Batched UDP on port [{}] could not get the socket, using per packet io", m_options.port);
+		return false;
+	}
+
+	//the udp handle is never started so libuv is not watching the fd and the poll handle can own it
+	m_poll = new uv_poll_t;
+	memset(m_poll, 0, sizeof(uv_poll_t));
+	if (uv_poll_init_socket(loop, m_poll, fd) != 0) {
+		LogError("Batched UDP on port [{}] could not poll the socket, using per packet io", m_options.port);
+		delete m_poll;
+		m_poll = nullptr;
+		return false;
+	}
+
+	m_batch.reset(new DaybreakBatchIO(fd, std::max(m_options.batch_size, (size_t)1)));
+
+	m_poll->data = this;
+	uv_poll_start(m_poll, UV_READABLE, [](uv_poll_t *handle, int status, int events) {
+		DaybreakConnectionManager *c = (DaybreakConnectionManager*)handle->data;
+		if (status < 0 || !(events & UV_READABLE)) {
+			return;
+		}
+
+		c->BatchRecv();
+	});
+
+	//prepare runs once per loop iteration just before it blocks, so everything queued by timers
+	//and callbacks in that iteration goes out in one sendmmsg without waiting on our own tick
+	m_flush = new uv_prepare_t;
+	memset(m_flush, 0, sizeof(uv_prepare_t));
+	uv_prepare_init(loop, m_flush);
+	m_flush->data = this;
+	uv_prepare_start(m_flush, [](uv_prepare_t *handle) {
+		DaybreakConnectionManager *c = (DaybreakConnectionManager*)handle->data;
+		c->BatchFlush();
+	});
+
+	//check runs right after the poll phase, so acks and replies queued by io callbacks (our own
+	//recv, tcp, world links) go out now instead of waiting for the next iteration to block again
+	m_flush_check = new uv_check_t;
+	memset(m_flush_check, 0, sizeof(uv_check_t));
+	uv_check_init(loop, m_flush_check);
+	m_flush_check->data = this;
+	uv_check_start(m_flush_check, [](uv_check_t *handle) {
+		DaybreakConnectionManager *c = (DaybreakConnectionManager*)handle->data;
+		c->BatchFlush();
+	});
+
+	return true;
+}
+
+void EQ::Net::DaybreakConnectionManager::BatchRecv()
+{
+	auto &b = *m_batch;
+
+	for (size_t batches = 0; batches < DaybreakBatchIO::max_recv_batches; ++batches) {
+		for (size_t i = 0; i < b.batch_size; ++i) {
+			auto &hdr = b.recv_msgs[i].msg_hdr;
+			memset(&hdr, 0, sizeof(hdr));
+			hdr.msg_name = &b.recv_addrs[i];
+			hdr.msg_namelen = sizeof(sockaddr_in);
+			hdr.msg_iov = &b.recv_iovs[i];
+			hdr.msg_iovlen = 1;
+		}
+
+		int n = recvmmsg(b.fd, b.recv_msgs.data(), (unsigned int)b.batch_size, MSG_DONTWAIT, nullptr);
+		m_socket_stats.recv_syscalls++;
+
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return;
+		}
+
+		m_socket_stats.recv_datagrams += n;
+
+		for (int i = 0; i < n; ++i) {
+			auto &msg = b.recv_msgs[i];
+			if (msg.msg_hdr.msg_flags & MSG_TRUNC) {
+				if (m_on_error_message) {
+					m_on_error_message(fmt::format("Dropped datagram larger than {0} bytes", DaybreakBatchIO::recv_buffer_size));
+				}
+				continue;
+			}
+
+			char endpoint[16];
+			uv_ip4_name(&b.recv_addrs[i], endpoint, 16);
+			auto port = ntohs(b.recv_addrs[i].sin_port);
+			ProcessPacket(endpoint, port, (const char*)b.recv_iovs[i].iov_base, msg.msg_len);
+		}
+
+		if ((size_t)n < b.batch_size) {
+			return;
+		}
+	}
+}
+
+void EQ::Net::DaybreakConnectionManager::BatchFlush()
+{
+	auto &b = *m_batch;
+	size_t sent = 0;
+
+	while (sent < b.send_count) {
+		auto count = std::min(b.send_count - sent, b.batch_size);
+
+		for (size_t i = 0; i < count; ++i) {
+			auto &buffer = b.send_buffers[sent + i];
+			b.send_iovs[i].iov_base = buffer.data();
+			b.send_iovs[i].iov_len = buffer.size();
+
+			auto &hdr = b.send_msgs[i].msg_hdr;
+			memset(&hdr, 0, sizeof(hdr));
+			hdr.msg_name = &b.send_addrs[sent + i];
+			hdr.msg_namelen = sizeof(sockaddr_in);
+			hdr.msg_iov = &b.send_iovs[i];
+			hdr.msg_iovlen = 1;
+		}
+
+		int n = sendmmsg(b.fd, b.send_msgs.data(), (unsigned int)count, MSG_DONTWAIT);
+		m_socket_stats.send_syscalls++;
+
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			//socket buffer is full, keep the rest for the next flush
+			if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+				break;
+			}
+
+			//sendmmsg stops at the first datagram that fails, drop it and carry on like a lost packet
+			m_socket_stats.send_errors++;
+			sent++;
+			continue;
+		}
+
+		m_socket_stats.send_datagrams += n;
+		sent += n;
+	}
+
+	if (sent == 0) {
+		return;
+	}
+
+	for (size_t i = sent; i < b.send_count; ++i) {
+		std::swap(b.send_buffers[i - sent], b.send_buffers[i]);
+		b.send_addrs[i - sent] = b.send_addrs[i];
+	}
+
+	b.send_count -= sent;
+}
+#else
+bool EQ::Net::DaybreakConnectionManager::AttachBatchedIO(uv_loop_t *loop)
+{
+	LogWarning("Batched UDP is only supported on Linux, using per packet io on port [{}]", m_options.port);
+	return false;
+}
+
+void EQ::Net::DaybreakConnectionManager::BatchRecv()
+{
+}
+
+void EQ::Net::DaybreakConnectionManager::BatchFlush()
+{
+}
+#endif
+
 void EQ::Net::DaybreakConnectionManager::Connect(const std::string &addr, int port)
 {
 	//todo dns resolution
@@ -270,16 +541,50 @@ void EQ::Net::DaybreakConnectionManager::SendDisconnect(const std::string &addr,
 	DynamicPacket out;
 	out.PutSerialize(0, header);
 
-	uv_udp_send_t *send_req = new uv_udp_send_t;
+	SendDatagram(addr, port, (const char*)out.Data(), out.Length());
+}
+
+void EQ::Net::DaybreakConnectionManager::SendDatagram(const std::string &addr, int port, const char *data, size_t size)
+{
+	if (m_options.simulated_out_packet_loss && m_options.simulated_out_packet_loss >= m_rand.Int(0, 100)) {
+		return;
+	}
+
 	sockaddr_in send_addr;
 	uv_ip4_addr(addr.c_str(), port, &send_addr);
+
+#ifdef __linux__
+	if (m_batch) {
+		auto &b = *m_batch;
+		if (b.send_count >= b.batch_size) {
+			BatchFlush();
+		}
+
+		if (b.send_count == b.send_buffers.size()) {
+			b.send_buffers.emplace_back();
+			b.send_addrs.emplace_back();
+		}
+
+		b.send_buffers[b.send_count].assign(data, data + size);
+		b.send_addrs[b.send_count] = send_addr;
+		b.send_count++;
+		return;
+	}
+#endif
+
+	uv_udp_send_t *send_req = new uv_udp_send_t;
+	memset(send_req, 0, sizeof(*send_req));
 	uv_buf_t send_buffers[1];
 
-	char *data = new char[out.Length()];
-	memcpy(data, out.Data(), out.Length());
-	send_buffers[0] = uv_buf_init(data, out.Length());
+	char *buffer = new char[size];
+	memcpy(buffer, data, size);
+	send_buffers[0] = uv_buf_init(buffer, size);
 	send_req->data = send_buffers[0].base;
-	int ret = uv_udp_send(send_req, &m_socket, send_buffers, 1, (sockaddr*)&send_addr,
+
+	m_socket_stats.send_syscalls++;
+	m_socket_stats.send_datagrams++;
+
+	uv_udp_send(send_req, &m_socket, send_buffers, 1, (sockaddr*)&send_addr,
 		[](uv_udp_send_t* req, int status) {
 		delete[](char*)req->data;
 		delete req;
@@ -968,75 +1273,6 @@ void EQ::Net::DaybreakConnection::Encode(Packet &p, size_t offset, size_t length
 	}
 }
 
-uint32_t Inflate(const uint8_t* in, uint32_t in_len, uint8_t* out, uint32_t out_len) {
-	if (!in) {
-		return 0;
-	}
-
-	z_stream zstream;
-	memset(&zstream, 0, sizeof(zstream));
-	int zerror = 0;
-	int i;
-
-	zstream.next_in = const_cast<unsigned char *>(in);
-	zstream.avail_in = in_len;
-	zstream.next_out = out;
-	zstream.avail_out = out_len;
-	zstream.opaque = Z_NULL;
-
-	i = inflateInit2(&zstream, 15);
-
-	if (i != Z_OK) {
-		return 0;
-	}
-
-	zerror = inflate(&zstream, Z_FINISH);
-
-	if (zerror == Z_STREAM_END) {
-		inflateEnd(&zstream);
-		return zstream.total_out;
-	}
-	else {
-		if (zerror == Z_MEM_ERROR && !zstream.msg)
-		{
-			return 0;
-		}
-
-		zerror = inflateEnd(&zstream);
-		return 0;
-	}
-}
-
-uint32_t Deflate(const uint8_t* in, uint32_t in_len, uint8_t* out, uint32_t out_len) {
-	if (!in) {
-		return 0;
-	}
-
-	z_stream zstream;
-	memset(&zstream, 0, sizeof(zstream));
-	int zerror;
-
-	zstream.next_in = const_cast<unsigned char *>(in);
-	zstream.avail_in = in_len;
-	zstream.opaque = Z_NULL;
-
-	deflateInit(&zstream, Z_BEST_SPEED);
-	zstream.next_out = out;
-	zstream.avail_out = out_len;
-
-	zerror = deflate(&zstream, Z_FINISH);
-
-	if (zerror == Z_STREAM_END)
-	{
-		deflateEnd(&zstream);
-		return zstream.total_out;
-	}
-	else {
-		zerror = deflateEnd(&zstream);
-		return 0;
-	}
-}
-
 void EQ::Net::DaybreakConnection::Decompress(Packet &p, size_t offset, size_t length)
 {
 	if (length < 2) {
@@ -1048,7 +1284,18 @@ void EQ::Net::DaybreakConnection::Decompress(Packet &p, size_t offset, size_t le
 	uint32_t new_length = 0;
 
 	if (buffer[0] == 0x5a) {
-		new_length = Inflate(buffer + 1, (uint32_t)length - 1, new_buffer, 4096);
+		auto &compressor = *m_owner->m_compressor;
+		auto opcode = offset == DaybreakHeader::size() ? p.GetUInt8(1) : (uint8_t)OP_Padding;
+		auto start = Clock::now();
+
+		new_length = compressor.Inflate(buffer + 1, (uint32_t)length - 1, new_buffer, 4096);
+
+		compressor.RecordDecompress(
+			opcode,
+			length,
+			new_length,
+			std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()
+		);
 	}
 	else if (buffer[0] == 0xa5) {
 		memcpy(new_buffer, buffer + 1, length - 1);
@@ -1064,15 +1311,20 @@ void EQ::Net::DaybreakConnection::Decompress(Packet &p, size_t offset, size_t le
 
 void EQ::Net::DaybreakConnection::Compress(Packet &p, size_t offset, size_t length)
 {
-	uint8_t new_buffer[2048] = { 0 };
+	uint8_t new_buffer[2048];
 	uint8_t *buffer = (uint8_t*)p.Data() + offset;
 	uint32_t new_length = 0;
 	bool send_uncompressed = true;
 
-	if (length > 30) {
-		new_length = Deflate(buffer, (uint32_t)length, new_buffer + 1, 2048) + 1;
+	auto &compressor = *m_owner->m_compressor;
+	auto opcode = offset == DaybreakHeader::size() ? p.GetUInt8(1) : (uint8_t)OP_Padding;
+	auto start = Clock::now();
+
+	if (compressor.ShouldCompress(opcode, length)) {
+		auto deflated = compressor.Deflate(buffer, (uint32_t)length, new_buffer + 1, sizeof(new_buffer) - 1);
+		new_length = deflated + 1;
 		new_buffer[0] = 0x5a;
-		send_uncompressed = (new_length > length);
+		send_uncompressed = (deflated == 0 || new_length > length);
 	}
 	if (send_uncompressed) {
 		memcpy(new_buffer + 1, buffer, length);
@@ -1080,6 +1332,14 @@ void EQ::Net::DaybreakConnection::Compress(Packet &p, size_t offset, size_t leng
 		new_length = length + 1;
 	}
 
+	compressor.RecordCompress(
+		opcode,
+		length,
+		new_length,
+		send_uncompressed,
+		std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()
+	);
+
 	p.Resize(offset);
 	p.PutData(offset, new_buffer, new_length);
 }
@@ -1308,11 +1568,6 @@ void EQ::Net::DaybreakConnection::InternalSend(Packet &p)
 
 	m_last_send = Clock::now();
 
-	auto send_func = [](uv_udp_send_t* req, int status) {
-		delete[](char*)req->data;
-		delete req;
-	};
-
 	if (PacketCanBeEncoded(p)) {
 
 		m_stats.bytes_before_encode += p.Length();
@@ -1341,51 +1596,19 @@ void EQ::Net::DaybreakConnection::InternalSend(Packet &p)
 
 		AppendCRC(out);
 
-		uv_udp_send_t *send_req = new uv_udp_send_t;
-		memset(send_req, 0, sizeof(*send_req));
-		sockaddr_in send_addr;
-		uv_ip4_addr(m_endpoint.c_str(), m_port, &send_addr);
-		uv_buf_t send_buffers[1];
-
-		char *data = new char[out.Length()];
-		memcpy(data, out.Data(), out.Length());
-		send_buffers[0] = uv_buf_init(data, out.Length());
-		send_req->data = send_buffers[0].base;
-
 		m_stats.sent_bytes += out.Length();
 		m_stats.sent_packets++;
-		if (m_owner->m_options.simulated_out_packet_loss && m_owner->m_options.simulated_out_packet_loss >= m_owner->m_rand.Int(0, 100)) {
-			delete[](char*)send_req->data;
-			delete send_req;
-			return;
-		}
 
-		uv_udp_send(send_req, &m_owner->m_socket, send_buffers, 1, (sockaddr*)&send_addr, send_func);
+		m_owner->SendDatagram(m_endpoint, m_port, (const char*)out.Data(), out.Length());
 		return;
 	}
 
 	m_stats.bytes_before_encode += p.Length();
 
-	uv_udp_send_t *send_req = new uv_udp_send_t;
-	sockaddr_in send_addr;
-	uv_ip4_addr(m_endpoint.c_str(), m_port, &send_addr);
-	uv_buf_t send_buffers[1];
-
-	char *data = new char[p.Length()];
-	memcpy(data, p.Data(), p.Length());
-	send_buffers[0] = uv_buf_init(data, p.Length());
-	send_req->data = send_buffers[0].base;
-
 	m_stats.sent_bytes += p.Length();
 	m_stats.sent_packets++;
 
-	if (m_owner->m_options.simulated_out_packet_loss && m_owner->m_options.simulated_out_packet_loss >= m_owner->m_rand.Int(0, 100)) {
-		delete[](char*)send_req->data;
-		delete send_req;
-		return;
-	}
-
-	uv_udp_send(send_req, &m_owner->m_socket, send_buffers, 1, (sockaddr*)&send_addr, send_func);
+	m_owner->SendDatagram(m_endpoint, m_port, (const char*)p.Data(), p.Length());
 }
 
 void EQ::Net::DaybreakConnection::InternalQueuePacket(Packet &p, int stream_id, bool reliable)
@@ -3,6 +3,7 @@
 #include "../random.h"
 #include "packet.h"
 #include "daybreak_structs.h"
+#include "daybreak_compressor.h"
 #include <uv.h>
 #include <chrono>
 #include <functional>
@@ -133,6 +134,30 @@ namespace EQ
 			uint64_t bytes_before_encode;
 		};
 
+		//shared by every connection on a manager's socket, the syscall / datagram ratios show how well batching is doing
+		struct DaybreakSocketStats
+		{
+			DaybreakSocketStats() {
+				Reset();
+			}
+
+			void Reset() {
+				recv_syscalls = 0;
+				recv_datagrams = 0;
+				send_syscalls = 0;
+				send_datagrams = 0;
+				send_errors = 0;
+				created = Clock::now();
+			}
+
+			uint64_t recv_syscalls;
+			uint64_t recv_datagrams;
+			uint64_t send_syscalls;
+			uint64_t send_datagrams;
+			uint64_t send_errors;
+			Timestamp created;
+		};
+
 		class DaybreakConnectionManager;
 		class DaybreakConnection;
 		class DaybreakConnection
@@ -272,6 +297,9 @@ namespace EQ
 				resend_timeout = 30000;
 				connection_close_time = 2000;
 				outgoing_data_rate = 0.0;
+				batched_io = false;
+				batch_size = 64;
+				compress_min_size = 30;
 			}
 
 			size_t max_packet_size;
@@ -295,8 +323,13 @@ namespace EQ
 			DaybreakEncodeType encode_passes[2];
 			int port;
 			double outgoing_data_rate;
+			bool batched_io; //recvmmsg / sendmmsg on linux, ignored elsewhere
+			size_t batch_size;
+			size_t compress_min_size; //packets this size or smaller are never deflated
 		};
 
+		struct DaybreakBatchIO;
+
 		class DaybreakConnectionManager
 		{
 		public:
@@ -314,14 +347,29 @@ namespace EQ
 			void OnErrorMessage(std::function<void(const std::string&)> func) { m_on_error_message = func; }
 
 			DaybreakConnectionManagerOptions& GetOptions() { return m_options; }
+			const DaybreakSocketStats& GetSocketStats() const { return m_socket_stats; }
+			void ResetSocketStats() { m_socket_stats.Reset(); }
+			bool IsBatchedIO() const { return m_batch != nullptr; }
+			DaybreakCompressor& GetCompressor() { return *m_compressor; }
+			const DaybreakCompressor& GetCompressor() const { return *m_compressor; }
+			void SetCompressor(std::unique_ptr<DaybreakCompressor> compressor) { m_compressor = std::move(compressor); }
 		private:
 			void Attach(uv_loop_t *loop);
 			void Detach();
+			bool AttachBatchedIO(uv_loop_t *loop);
+			void BatchRecv();
+			void BatchFlush();
 
 			EQ::Random m_rand;
 			uv_timer_t m_timer;
 			uv_udp_t m_socket;
+			uv_poll_t *m_poll;
+			uv_prepare_t *m_flush;
+			uv_check_t *m_flush_check;
 			uv_loop_t *m_attached;
+			std::unique_ptr<DaybreakBatchIO> m_batch;
+			DaybreakSocketStats m_socket_stats;
+			std::unique_ptr<DaybreakCompressor> m_compressor;
 			DaybreakConnectionManagerOptions m_options;
 			std::function<void(std::shared_ptr<DaybreakConnection>)> m_on_new_connection;
 			std::function<void(std::shared_ptr<DaybreakConnection>, DbProtocolStatus, DbProtocolStatus)> m_on_connection_state_change;
@@ -332,6 +380,7 @@ namespace EQ
 			void ProcessPacket(const std::string &endpoint, int port, const char *data, size_t size);
 			std::shared_ptr<DaybreakConnection> FindConnectionByEndpoint(std::string addr, int port);
 			void SendDisconnect(const std::string &addr, int port);
+			void SendDatagram(const std::string &addr, int port, const char *data, size_t size);
 
 			friend class DaybreakConnection;
 		};
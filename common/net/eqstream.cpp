@@ -236,6 +236,22 @@ EQ::Net::EQStream::Stats EQ::Net::EQStream::GetStats() const
 {
 	Stats ret;
 	ret.DaybreakStats = m_connection->GetStats();
+	ret.SocketStats = m_connection->GetManager()->GetSocketStats();
+
+	auto &compressor = m_connection->GetManager()->GetCompressor();
+	for (int i = 0; i < 256; ++i) {
+		auto &s = compressor.GetCompressStats((uint8_t)i);
+		if (s.packets) {
+			ret.CompressionStats.emplace_back((uint8_t)i, s);
+		}
+	}
+
+	for (int i = 0; i < 256; ++i) {
+		auto &s = compressor.GetDecompressStats((uint8_t)i);
+		if (s.packets) {
+			ret.DecompressionStats.emplace_back((uint8_t)i, s);
+		}
+	}
 
 	for (int i = 0; i < _maxEmuOpcode; ++i) {
 		ret.RecvCount[i] = 0;
@@ -27,7 +27,16 @@
 	#include <sys/time.h>
 #endif
 
-#ifdef i386
+#include <chrono>
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define USE_RDTSC
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif
+#elif defined(i386)
 	#define USE_RDTSC
 #endif
 
@@ -58,8 +67,9 @@ RDTSC_Timer::RDTSC_Timer(bool start_it) {
 
 int64 RDTSC_Timer::rdtsc() {
 	int64 res = 0;
-#ifdef USE_RDTSC
-#ifndef WIN64
+#if defined(__x86_64__) || defined(_M_X64)
+	res = (int64) __rdtsc();
+#elif defined(USE_RDTSC)
 #ifdef WIN32
 	//untested!
 	unsigned long highw, loww;
@@ -78,11 +88,10 @@ int64 RDTSC_Timer::rdtsc() {
 	__asm__ __volatile__ ("rdtsc" : "=A" (res));
 #endif
 #else
-	//fall back to get time of day
-	timeval t;
-	gettimeofday(&t, nullptr);
-	res = ((int64)t.tv_sec) * 1000 + t.tv_usec;
-#endif
+	//fall back to a monotonic microsecond clock, matches the fixed 1000 ticks per ms in init
+	res = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()
+	).count();
 #endif
 	return(res);
 }
@@ -28,7 +28,8 @@
 	which is avaliable on the current archetecture.
 
 	On intel, this uses the rdtsc instruction to get the actual
-	clock cycle count, and elsewhere it falls back to gettimeofday
+	clock cycle count, and elsewhere it falls back to a monotonic
+	microsecond clock
 
 	All calculations are carried out in 64 bit integers.
 */
@@ -48,9 +49,11 @@ public:
 	int64 getTicks() { return(_end - _start); }
 	static int64 ticksPerMS() { return(_ticsperms); }
 
-protected:
+	//raw counter read, only meaningful relative to another read and ticksPerMS
 	static int64 rdtsc();
 
+protected:
+
 	int64 _start;
 	int64 _end;
 
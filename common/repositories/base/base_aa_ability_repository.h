@@ -149,11 +149,51 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, AaAbility &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.name);
+		b.Bind(e.category);
+		b.Bind(e.classes);
+		b.Bind(e.races);
+		b.Bind(e.drakkin_heritage);
+		b.Bind(e.deities);
+		b.Bind(e.status);
+		b.Bind(e.type);
+		b.Bind(e.charges);
+		b.Bind(e.grant_only);
+		b.Bind(e.first_rank_id);
+		b.Bind(e.enabled);
+		b.Bind(e.reset_on_death);
+	}
+
 	static AaAbility FindOne(
 		Database& db,
 		int aa_ability_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			AaAbility e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, aa_ability_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -448,6 +488,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int aa_ability_id,
+		std::function<void(AaAbility)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<AaAbility>();
+
+		db.RunAsync(
+			[e, aa_ability_id](Database& c) { *e = FindOne(c, aa_ability_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<AaAbility>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<AaAbility>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		AaAbility e,
+		std::function<void(AaAbility)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<AaAbility>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const AaAbility &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_AA_ABILITY_REPOSITORY_H
@@ -113,11 +113,42 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, AaRankEffects &e)
+	{
+		b.Bind(e.rank_id);
+		b.Bind(e.slot);
+		b.Bind(e.effect_id);
+		b.Bind(e.base1);
+		b.Bind(e.base2);
+	}
+
 	static AaRankEffects FindOne(
 		Database& db,
 		int aa_rank_effects_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			AaRankEffects e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, aa_rank_effects_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -358,6 +389,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int aa_rank_effects_id,
+		std::function<void(AaRankEffects)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<AaRankEffects>();
+
+		db.RunAsync(
+			[e, aa_rank_effects_id](Database& c) { *e = FindOne(c, aa_rank_effects_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<AaRankEffects>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<AaRankEffects>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		AaRankEffects e,
+		std::function<void(AaRankEffects)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<AaRankEffects>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const AaRankEffects &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_AA_RANK_EFFECTS_REPOSITORY_H
@@ -145,11 +145,50 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, AaRanks &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.upper_hotkey_sid);
+		b.Bind(e.lower_hotkey_sid);
+		b.Bind(e.title_sid);
+		b.Bind(e.desc_sid);
+		b.Bind(e.cost);
+		b.Bind(e.level_req);
+		b.Bind(e.spell);
+		b.Bind(e.spell_type);
+		b.Bind(e.recast_time);
+		b.Bind(e.expansion);
+		b.Bind(e.prev_id);
+		b.Bind(e.next_id);
+	}
+
 	static AaRanks FindOne(
 		Database& db,
 		int aa_ranks_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			AaRanks e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, aa_ranks_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -438,6 +477,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int aa_ranks_id,
+		std::function<void(AaRanks)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<AaRanks>();
+
+		db.RunAsync(
+			[e, aa_ranks_id](Database& c) { *e = FindOne(c, aa_ranks_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<AaRanks>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<AaRanks>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		AaRanks e,
+		std::function<void(AaRanks)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<AaRanks>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const AaRanks &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_AA_RANKS_REPOSITORY_H
@@ -105,11 +105,40 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, AccountFlags &e)
+	{
+		b.Bind(e.p_accid);
+		b.Bind(e.p_flag);
+		b.Bind(e.p_value);
+	}
+
 	static AccountFlags FindOne(
 		Database& db,
 		int account_flags_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			AccountFlags e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, account_flags_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -338,6 +367,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int account_flags_id,
+		std::function<void(AccountFlags)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<AccountFlags>();
+
+		db.RunAsync(
+			[e, account_flags_id](Database& c) { *e = FindOne(c, account_flags_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<AccountFlags>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<AccountFlags>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		AccountFlags e,
+		std::function<void(AccountFlags)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<AccountFlags>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const AccountFlags &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_ACCOUNT_FLAGS_REPOSITORY_H
@@ -189,11 +189,61 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Account &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.name);
+		b.Bind(e.charname);
+		b.Bind(e.sharedplat);
+		b.Bind(e.password);
+		b.Bind(e.status);
+		b.Bind(e.ls_id);
+		b.Bind(e.lsaccount_id);
+		b.Bind(e.gmspeed);
+		b.Bind(e.invulnerable);
+		b.Bind(e.flymode);
+		b.Bind(e.ignore_tells);
+		b.Bind(e.revoked);
+		b.Bind(e.karma);
+		b.Bind(e.minilogin_ip);
+		b.Bind(e.hideme);
+		b.Bind(e.rulesflag);
+		b.Bind(e.suspendeduntil);
+		b.Bind(e.time_creation);
+		b.Bind(e.ban_reason);
+		b.Bind(e.suspend_reason);
+		b.Bind(e.crc_eqgame);
+		b.Bind(e.crc_skillcaps);
+		b.Bind(e.crc_basedata);
+	}
+
 	static Account FindOne(
 		Database& db,
 		int account_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Account e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, account_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -547,6 +597,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int account_id,
+		std::function<void(Account)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Account>();
+
+		db.RunAsync(
+			[e, account_id](Database& c) { *e = FindOne(c, account_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Account>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Account>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Account e,
+		std::function<void(Account)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Account>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Account &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_ACCOUNT_REPOSITORY_H
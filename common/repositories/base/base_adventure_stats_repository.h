@@ -137,11 +137,48 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, AdventureStats &e)
+	{
+		b.Bind(e.player_id);
+		b.Bind(e.guk_wins);
+		b.Bind(e.mir_wins);
+		b.Bind(e.mmc_wins);
+		b.Bind(e.ruj_wins);
+		b.Bind(e.tak_wins);
+		b.Bind(e.guk_losses);
+		b.Bind(e.mir_losses);
+		b.Bind(e.mmc_losses);
+		b.Bind(e.ruj_losses);
+		b.Bind(e.tak_losses);
+	}
+
 	static AdventureStats FindOne(
 		Database& db,
 		int adventure_stats_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			AdventureStats e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, adventure_stats_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -418,6 +455,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int adventure_stats_id,
+		std::function<void(AdventureStats)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<AdventureStats>();
+
+		db.RunAsync(
+			[e, adventure_stats_id](Database& c) { *e = FindOne(c, adventure_stats_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<AdventureStats>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<AdventureStats>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		AdventureStats e,
+		std::function<void(AdventureStats)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<AdventureStats>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const AdventureStats &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_ADVENTURE_STATS_REPOSITORY_H
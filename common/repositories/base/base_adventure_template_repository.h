@@ -225,11 +225,70 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, AdventureTemplate &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.zone);
+		b.Bind(e.zone_version);
+		b.Bind(e.is_hard);
+		b.Bind(e.is_raid);
+		b.Bind(e.min_level);
+		b.Bind(e.max_level);
+		b.Bind(e.type);
+		b.Bind(e.type_data);
+		b.Bind(e.type_count);
+		b.Bind(e.assa_x);
+		b.Bind(e.assa_y);
+		b.Bind(e.assa_z);
+		b.Bind(e.assa_h);
+		b.Bind(e.text);
+		b.Bind(e.duration);
+		b.Bind(e.zone_in_time);
+		b.Bind(e.win_points);
+		b.Bind(e.lose_points);
+		b.Bind(e.theme);
+		b.Bind(e.zone_in_zone_id);
+		b.Bind(e.zone_in_x);
+		b.Bind(e.zone_in_y);
+		b.Bind(e.zone_in_object_id);
+		b.Bind(e.dest_x);
+		b.Bind(e.dest_y);
+		b.Bind(e.dest_z);
+		b.Bind(e.dest_h);
+		b.Bind(e.graveyard_zone_id);
+		b.Bind(e.graveyard_x);
+		b.Bind(e.graveyard_y);
+		b.Bind(e.graveyard_z);
+		b.Bind(e.graveyard_radius);
+	}
+
 	static AdventureTemplate FindOne(
 		Database& db,
 		int adventure_template_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			AdventureTemplate e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, adventure_template_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -635,6 +694,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int adventure_template_id,
+		std::function<void(AdventureTemplate)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<AdventureTemplate>();
+
+		db.RunAsync(
+			[e, adventure_template_id](Database& c) { *e = FindOne(c, adventure_template_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<AdventureTemplate>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<AdventureTemplate>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		AdventureTemplate e,
+		std::function<void(AdventureTemplate)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<AdventureTemplate>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const AdventureTemplate &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_ADVENTURE_TEMPLATE_REPOSITORY_H
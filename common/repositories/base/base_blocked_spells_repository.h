@@ -141,11 +141,49 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, BlockedSpells &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.spellid);
+		b.Bind(e.type);
+		b.Bind(e.zoneid);
+		b.Bind(e.x);
+		b.Bind(e.y);
+		b.Bind(e.z);
+		b.Bind(e.x_diff);
+		b.Bind(e.y_diff);
+		b.Bind(e.z_diff);
+		b.Bind(e.message);
+		b.Bind(e.description);
+	}
+
 	static BlockedSpells FindOne(
 		Database& db,
 		int blocked_spells_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			BlockedSpells e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, blocked_spells_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -427,6 +465,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int blocked_spells_id,
+		std::function<void(BlockedSpells)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<BlockedSpells>();
+
+		db.RunAsync(
+			[e, blocked_spells_id](Database& c) { *e = FindOne(c, blocked_spells_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<BlockedSpells>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<BlockedSpells>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		BlockedSpells e,
+		std::function<void(BlockedSpells)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<BlockedSpells>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const BlockedSpells &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_BLOCKED_SPELLS_REPOSITORY_H
@@ -173,11 +173,57 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, BotBuffs &e)
+	{
+		b.Bind(e.buffs_index);
+		b.Bind(e.bot_id);
+		b.Bind(e.spell_id);
+		b.Bind(e.caster_level);
+		b.Bind(e.duration_formula);
+		b.Bind(e.tics_remaining);
+		b.Bind(e.poison_counters);
+		b.Bind(e.disease_counters);
+		b.Bind(e.curse_counters);
+		b.Bind(e.corruption_counters);
+		b.Bind(e.numhits);
+		b.Bind(e.melee_rune);
+		b.Bind(e.magic_rune);
+		b.Bind(e.dot_rune);
+		b.Bind(e.persistent);
+		b.Bind(e.caston_x);
+		b.Bind(e.caston_y);
+		b.Bind(e.caston_z);
+		b.Bind(e.extra_di_chance);
+		b.Bind(e.instrument_mod);
+	}
+
 	static BotBuffs FindOne(
 		Database& db,
 		int bot_buffs_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			BotBuffs e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, bot_buffs_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -507,6 +553,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int bot_buffs_id,
+		std::function<void(BotBuffs)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<BotBuffs>();
+
+		db.RunAsync(
+			[e, bot_buffs_id](Database& c) { *e = FindOne(c, bot_buffs_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<BotBuffs>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<BotBuffs>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		BotBuffs e,
+		std::function<void(BotBuffs)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<BotBuffs>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const BotBuffs &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_BOT_BUFFS_REPOSITORY_H
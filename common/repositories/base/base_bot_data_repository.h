@@ -297,11 +297,88 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, BotData &e)
+	{
+		b.Bind(e.bot_id);
+		b.Bind(e.owner_id);
+		b.Bind(e.spells_id);
+		b.Bind(e.name);
+		b.Bind(e.last_name);
+		b.Bind(e.title);
+		b.Bind(e.suffix);
+		b.Bind(e.zone_id);
+		b.Bind(e.gender);
+		b.Bind(e.race);
+		b.Bind(e.class_);
+		b.Bind(e.level);
+		b.Bind(e.deity);
+		b.Bind(e.creation_day);
+		b.Bind(e.last_spawn);
+		b.Bind(e.time_spawned);
+		b.Bind(e.size);
+		b.Bind(e.face);
+		b.Bind(e.hair_color);
+		b.Bind(e.hair_style);
+		b.Bind(e.beard);
+		b.Bind(e.beard_color);
+		b.Bind(e.eye_color_1);
+		b.Bind(e.eye_color_2);
+		b.Bind(e.drakkin_heritage);
+		b.Bind(e.drakkin_tattoo);
+		b.Bind(e.drakkin_details);
+		b.Bind(e.ac);
+		b.Bind(e.atk);
+		b.Bind(e.hp);
+		b.Bind(e.mana);
+		b.Bind(e.str);
+		b.Bind(e.sta);
+		b.Bind(e.cha);
+		b.Bind(e.dex);
+		b.Bind(e.int_);
+		b.Bind(e.agi);
+		b.Bind(e.wis);
+		b.Bind(e.fire);
+		b.Bind(e.cold);
+		b.Bind(e.magic);
+		b.Bind(e.poison);
+		b.Bind(e.disease);
+		b.Bind(e.corruption);
+		b.Bind(e.show_helm);
+		b.Bind(e.follow_distance);
+		b.Bind(e.stop_melee_level);
+		b.Bind(e.expansion_bitmask);
+		b.Bind(e.enforce_spell_settings);
+		b.Bind(e.archery_setting);
+		b.Bind(e.caster_range);
+	}
+
 	static BotData FindOne(
 		Database& db,
 		int bot_data_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			BotData e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, bot_data_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -818,6 +895,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int bot_data_id,
+		std::function<void(BotData)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<BotData>();
+
+		db.RunAsync(
+			[e, bot_data_id](Database& c) { *e = FindOne(c, bot_data_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<BotData>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<BotData>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		BotData e,
+		std::function<void(BotData)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<BotData>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const BotData &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_BOT_DATA_REPOSITORY_H
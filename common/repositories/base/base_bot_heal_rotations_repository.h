@@ -157,11 +157,53 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, BotHealRotations &e)
+	{
+		b.Bind(e.heal_rotation_index);
+		b.Bind(e.bot_id);
+		b.Bind(e.interval);
+		b.Bind(e.fast_heals);
+		b.Bind(e.adaptive_targeting);
+		b.Bind(e.casting_override);
+		b.Bind(e.safe_hp_base);
+		b.Bind(e.safe_hp_cloth);
+		b.Bind(e.safe_hp_leather);
+		b.Bind(e.safe_hp_chain);
+		b.Bind(e.safe_hp_plate);
+		b.Bind(e.critical_hp_base);
+		b.Bind(e.critical_hp_cloth);
+		b.Bind(e.critical_hp_leather);
+		b.Bind(e.critical_hp_chain);
+		b.Bind(e.critical_hp_plate);
+	}
+
 	static BotHealRotations FindOne(
 		Database& db,
 		int bot_heal_rotations_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			BotHealRotations e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, bot_heal_rotations_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -437,6 +479,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int bot_heal_rotations_id,
+		std::function<void(BotHealRotations)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<BotHealRotations>();
+
+		db.RunAsync(
+			[e, bot_heal_rotations_id](Database& c) { *e = FindOne(c, bot_heal_rotations_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<BotHealRotations>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<BotHealRotations>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		BotHealRotations e,
+		std::function<void(BotHealRotations)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<BotHealRotations>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const BotHealRotations &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_BOT_HEAL_ROTATIONS_REPOSITORY_H
@@ -161,11 +161,54 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, BotInventories &e)
+	{
+		b.Bind(e.inventories_index);
+		b.Bind(e.bot_id);
+		b.Bind(e.slot_id);
+		b.Bind(e.item_id);
+		b.Bind(e.inst_charges);
+		b.Bind(e.inst_color);
+		b.Bind(e.inst_no_drop);
+		b.Bind(e.inst_custom_data);
+		b.Bind(e.ornament_icon);
+		b.Bind(e.ornament_id_file);
+		b.Bind(e.ornament_hero_model);
+		b.Bind(e.augment_1);
+		b.Bind(e.augment_2);
+		b.Bind(e.augment_3);
+		b.Bind(e.augment_4);
+		b.Bind(e.augment_5);
+		b.Bind(e.augment_6);
+	}
+
 	static BotInventories FindOne(
 		Database& db,
 		int bot_inventories_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			BotInventories e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, bot_inventories_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -477,6 +520,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int bot_inventories_id,
+		std::function<void(BotInventories)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<BotInventories>();
+
+		db.RunAsync(
+			[e, bot_inventories_id](Database& c) { *e = FindOne(c, bot_inventories_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<BotInventories>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<BotInventories>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		BotInventories e,
+		std::function<void(BotInventories)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<BotInventories>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const BotInventories &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_BOT_INVENTORIES_REPOSITORY_H
@@ -173,11 +173,57 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, BotSpellCastingChances &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.spell_type_index);
+		b.Bind(e.class_id);
+		b.Bind(e.stance_index);
+		b.Bind(e.nHSND_value);
+		b.Bind(e.pH_value);
+		b.Bind(e.pS_value);
+		b.Bind(e.pHS_value);
+		b.Bind(e.pN_value);
+		b.Bind(e.pHN_value);
+		b.Bind(e.pSN_value);
+		b.Bind(e.pHSN_value);
+		b.Bind(e.pD_value);
+		b.Bind(e.pHD_value);
+		b.Bind(e.pSD_value);
+		b.Bind(e.pHSD_value);
+		b.Bind(e.pND_value);
+		b.Bind(e.pHND_value);
+		b.Bind(e.pSND_value);
+		b.Bind(e.pHSND_value);
+	}
+
 	static BotSpellCastingChances FindOne(
 		Database& db,
 		int bot_spell_casting_chances_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			BotSpellCastingChances e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, bot_spell_casting_chances_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -507,6 +553,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int bot_spell_casting_chances_id,
+		std::function<void(BotSpellCastingChances)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<BotSpellCastingChances>();
+
+		db.RunAsync(
+			[e, bot_spell_casting_chances_id](Database& c) { *e = FindOne(c, bot_spell_casting_chances_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<BotSpellCastingChances>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<BotSpellCastingChances>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		BotSpellCastingChances e,
+		std::function<void(BotSpellCastingChances)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<BotSpellCastingChances>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const BotSpellCastingChances &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_BOT_SPELL_CASTING_CHANCES_REPOSITORY_H
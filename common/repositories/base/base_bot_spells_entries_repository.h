@@ -153,11 +153,52 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, BotSpellsEntries &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.npc_spells_id);
+		b.Bind(e.spellid);
+		b.Bind(e.type);
+		b.Bind(e.minlevel);
+		b.Bind(e.maxlevel);
+		b.Bind(e.manacost);
+		b.Bind(e.recast_delay);
+		b.Bind(e.priority);
+		b.Bind(e.resist_adjust);
+		b.Bind(e.min_hp);
+		b.Bind(e.max_hp);
+		b.Bind(e.bucket_name);
+		b.Bind(e.bucket_value);
+		b.Bind(e.bucket_comparison);
+	}
+
 	static BotSpellsEntries FindOne(
 		Database& db,
 		int bot_spells_entries_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			BotSpellsEntries e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, bot_spells_entries_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -457,6 +498,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int bot_spells_entries_id,
+		std::function<void(BotSpellsEntries)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<BotSpellsEntries>();
+
+		db.RunAsync(
+			[e, bot_spells_entries_id](Database& c) { *e = FindOne(c, bot_spells_entries_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<BotSpellsEntries>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<BotSpellsEntries>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		BotSpellsEntries e,
+		std::function<void(BotSpellsEntries)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<BotSpellsEntries>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const BotSpellsEntries &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_BOT_SPELLS_ENTRIES_REPOSITORY_H
@@ -221,11 +221,69 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, BugReports &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.zone);
+		b.Bind(e.client_version_id);
+		b.Bind(e.client_version_name);
+		b.Bind(e.account_id);
+		b.Bind(e.character_id);
+		b.Bind(e.character_name);
+		b.Bind(e.reporter_spoof);
+		b.Bind(e.category_id);
+		b.Bind(e.category_name);
+		b.Bind(e.reporter_name);
+		b.Bind(e.ui_path);
+		b.Bind(e.pos_x);
+		b.Bind(e.pos_y);
+		b.Bind(e.pos_z);
+		b.Bind(e.heading);
+		b.Bind(e.time_played);
+		b.Bind(e.target_id);
+		b.Bind(e.target_name);
+		b.Bind(e.optional_info_mask);
+		b.Bind(e._can_duplicate);
+		b.Bind(e._crash_bug);
+		b.Bind(e._target_info);
+		b.Bind(e._character_flags);
+		b.Bind(e._unknown_value);
+		b.Bind(e.bug_report);
+		b.Bind(e.system_info);
+		b.Bind(e.report_datetime);
+		b.Bind(e.bug_status);
+		b.Bind(e.last_review);
+		b.Bind(e.last_reviewer);
+		b.Bind(e.reviewer_notes);
+	}
+
 	static BugReports FindOne(
 		Database& db,
 		int bug_reports_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			BugReports e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, bug_reports_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -627,6 +685,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int bug_reports_id,
+		std::function<void(BugReports)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<BugReports>();
+
+		db.RunAsync(
+			[e, bug_reports_id](Database& c) { *e = FindOne(c, bug_reports_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<BugReports>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<BugReports>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		BugReports e,
+		std::function<void(BugReports)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<BugReports>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const BugReports &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_BUG_REPORTS_REPOSITORY_H
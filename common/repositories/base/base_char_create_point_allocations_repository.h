@@ -153,11 +153,52 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, CharCreatePointAllocations &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.base_str);
+		b.Bind(e.base_sta);
+		b.Bind(e.base_dex);
+		b.Bind(e.base_agi);
+		b.Bind(e.base_int);
+		b.Bind(e.base_wis);
+		b.Bind(e.base_cha);
+		b.Bind(e.alloc_str);
+		b.Bind(e.alloc_sta);
+		b.Bind(e.alloc_dex);
+		b.Bind(e.alloc_agi);
+		b.Bind(e.alloc_int);
+		b.Bind(e.alloc_wis);
+		b.Bind(e.alloc_cha);
+	}
+
 	static CharCreatePointAllocations FindOne(
 		Database& db,
 		int char_create_point_allocations_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			CharCreatePointAllocations e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, char_create_point_allocations_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -458,6 +499,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int char_create_point_allocations_id,
+		std::function<void(CharCreatePointAllocations)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<CharCreatePointAllocations>();
+
+		db.RunAsync(
+			[e, char_create_point_allocations_id](Database& c) { *e = FindOne(c, char_create_point_allocations_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<CharCreatePointAllocations>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<CharCreatePointAllocations>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		CharCreatePointAllocations e,
+		std::function<void(CharCreatePointAllocations)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<CharCreatePointAllocations>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const CharCreatePointAllocations &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_CHAR_CREATE_POINT_ALLOCATIONS_REPOSITORY_H
@@ -161,11 +161,54 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, CharacterBuffs &e)
+	{
+		b.Bind(e.character_id);
+		b.Bind(e.slot_id);
+		b.Bind(e.spell_id);
+		b.Bind(e.caster_level);
+		b.Bind(e.caster_name);
+		b.Bind(e.ticsremaining);
+		b.Bind(e.counters);
+		b.Bind(e.numhits);
+		b.Bind(e.melee_rune);
+		b.Bind(e.magic_rune);
+		b.Bind(e.persistent);
+		b.Bind(e.dot_rune);
+		b.Bind(e.caston_x);
+		b.Bind(e.caston_y);
+		b.Bind(e.caston_z);
+		b.Bind(e.ExtraDIChance);
+		b.Bind(e.instrument_mod);
+	}
+
 	static CharacterBuffs FindOne(
 		Database& db,
 		int character_buffs_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			CharacterBuffs e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, character_buffs_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -478,6 +521,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int character_buffs_id,
+		std::function<void(CharacterBuffs)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<CharacterBuffs>();
+
+		db.RunAsync(
+			[e, character_buffs_id](Database& c) { *e = FindOne(c, character_buffs_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<CharacterBuffs>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<CharacterBuffs>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		CharacterBuffs e,
+		std::function<void(CharacterBuffs)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<CharacterBuffs>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const CharacterBuffs &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_CHARACTER_BUFFS_REPOSITORY_H
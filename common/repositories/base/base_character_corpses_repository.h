@@ -281,11 +281,84 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, CharacterCorpses &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.charid);
+		b.Bind(e.charname);
+		b.Bind(e.zone_id);
+		b.Bind(e.instance_id);
+		b.Bind(e.x);
+		b.Bind(e.y);
+		b.Bind(e.z);
+		b.Bind(e.heading);
+		b.Bind(e.time_of_death);
+		b.Bind(e.guild_consent_id);
+		b.Bind(e.is_rezzed);
+		b.Bind(e.is_buried);
+		b.Bind(e.was_at_graveyard);
+		b.Bind(e.is_locked);
+		b.Bind(e.exp);
+		b.Bind(e.size);
+		b.Bind(e.level);
+		b.Bind(e.race);
+		b.Bind(e.gender);
+		b.Bind(e.class_);
+		b.Bind(e.deity);
+		b.Bind(e.texture);
+		b.Bind(e.helm_texture);
+		b.Bind(e.copper);
+		b.Bind(e.silver);
+		b.Bind(e.gold);
+		b.Bind(e.platinum);
+		b.Bind(e.hair_color);
+		b.Bind(e.beard_color);
+		b.Bind(e.eye_color_1);
+		b.Bind(e.eye_color_2);
+		b.Bind(e.hair_style);
+		b.Bind(e.face);
+		b.Bind(e.beard);
+		b.Bind(e.drakkin_heritage);
+		b.Bind(e.drakkin_tattoo);
+		b.Bind(e.drakkin_details);
+		b.Bind(e.wc_1);
+		b.Bind(e.wc_2);
+		b.Bind(e.wc_3);
+		b.Bind(e.wc_4);
+		b.Bind(e.wc_5);
+		b.Bind(e.wc_6);
+		b.Bind(e.wc_7);
+		b.Bind(e.wc_8);
+		b.Bind(e.wc_9);
+	}
+
 	static CharacterCorpses FindOne(
 		Database& db,
 		int character_corpses_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			CharacterCorpses e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, character_corpses_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -777,6 +850,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int character_corpses_id,
+		std::function<void(CharacterCorpses)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<CharacterCorpses>();
+
+		db.RunAsync(
+			[e, character_corpses_id](Database& c) { *e = FindOne(c, character_corpses_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<CharacterCorpses>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<CharacterCorpses>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		CharacterCorpses e,
+		std::function<void(CharacterCorpses)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<CharacterCorpses>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const CharacterCorpses &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_CHARACTER_CORPSES_REPOSITORY_H
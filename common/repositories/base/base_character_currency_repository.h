@@ -161,11 +161,54 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, CharacterCurrency &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.platinum);
+		b.Bind(e.gold);
+		b.Bind(e.silver);
+		b.Bind(e.copper);
+		b.Bind(e.platinum_bank);
+		b.Bind(e.gold_bank);
+		b.Bind(e.silver_bank);
+		b.Bind(e.copper_bank);
+		b.Bind(e.platinum_cursor);
+		b.Bind(e.gold_cursor);
+		b.Bind(e.silver_cursor);
+		b.Bind(e.copper_cursor);
+		b.Bind(e.radiant_crystals);
+		b.Bind(e.career_radiant_crystals);
+		b.Bind(e.ebon_crystals);
+		b.Bind(e.career_ebon_crystals);
+	}
+
 	static CharacterCurrency FindOne(
 		Database& db,
 		int character_currency_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			CharacterCurrency e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, character_currency_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -478,6 +521,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int character_currency_id,
+		std::function<void(CharacterCurrency)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<CharacterCurrency>();
+
+		db.RunAsync(
+			[e, character_currency_id](Database& c) { *e = FindOne(c, character_currency_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<CharacterCurrency>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<CharacterCurrency>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		CharacterCurrency e,
+		std::function<void(CharacterCurrency)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<CharacterCurrency>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const CharacterCurrency &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_CHARACTER_CURRENCY_REPOSITORY_H
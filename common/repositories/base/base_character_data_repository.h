@@ -506,11 +506,140 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, CharacterData &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.account_id);
+		b.Bind(e.name);
+		b.Bind(e.last_name);
+		b.Bind(e.title);
+		b.Bind(e.suffix);
+		b.Bind(e.zone_id);
+		b.Bind(e.zone_instance);
+		b.Bind(e.y);
+		b.Bind(e.x);
+		b.Bind(e.z);
+		b.Bind(e.heading);
+		b.Bind(e.gender);
+		b.Bind(e.race);
+		b.Bind(e.class_);
+		b.Bind(e.level);
+		b.Bind(e.deity);
+		b.Bind(e.birthday);
+		b.Bind(e.last_login);
+		b.Bind(e.time_played);
+		b.Bind(e.level2);
+		b.Bind(e.anon);
+		b.Bind(e.gm);
+		b.Bind(e.face);
+		b.Bind(e.hair_color);
+		b.Bind(e.hair_style);
+		b.Bind(e.beard);
+		b.Bind(e.beard_color);
+		b.Bind(e.eye_color_1);
+		b.Bind(e.eye_color_2);
+		b.Bind(e.drakkin_heritage);
+		b.Bind(e.drakkin_tattoo);
+		b.Bind(e.drakkin_details);
+		b.Bind(e.ability_time_seconds);
+		b.Bind(e.ability_number);
+		b.Bind(e.ability_time_minutes);
+		b.Bind(e.ability_time_hours);
+		b.Bind(e.exp);
+		b.Bind(e.exp_enabled);
+		b.Bind(e.aa_points_spent);
+		b.Bind(e.aa_exp);
+		b.Bind(e.aa_points);
+		b.Bind(e.group_leadership_exp);
+		b.Bind(e.raid_leadership_exp);
+		b.Bind(e.group_leadership_points);
+		b.Bind(e.raid_leadership_points);
+		b.Bind(e.points);
+		b.Bind(e.cur_hp);
+		b.Bind(e.mana);
+		b.Bind(e.endurance);
+		b.Bind(e.intoxication);
+		b.Bind(e.str);
+		b.Bind(e.sta);
+		b.Bind(e.cha);
+		b.Bind(e.dex);
+		b.Bind(e.int_);
+		b.Bind(e.agi);
+		b.Bind(e.wis);
+		b.Bind(e.zone_change_count);
+		b.Bind(e.toxicity);
+		b.Bind(e.hunger_level);
+		b.Bind(e.thirst_level);
+		b.Bind(e.ability_up);
+		b.Bind(e.ldon_points_guk);
+		b.Bind(e.ldon_points_mir);
+		b.Bind(e.ldon_points_mmc);
+		b.Bind(e.ldon_points_ruj);
+		b.Bind(e.ldon_points_tak);
+		b.Bind(e.ldon_points_available);
+		b.Bind(e.tribute_time_remaining);
+		b.Bind(e.career_tribute_points);
+		b.Bind(e.tribute_points);
+		b.Bind(e.tribute_active);
+		b.Bind(e.pvp_status);
+		b.Bind(e.pvp_kills);
+		b.Bind(e.pvp_deaths);
+		b.Bind(e.pvp_current_points);
+		b.Bind(e.pvp_career_points);
+		b.Bind(e.pvp_best_kill_streak);
+		b.Bind(e.pvp_worst_death_streak);
+		b.Bind(e.pvp_current_kill_streak);
+		b.Bind(e.pvp2);
+		b.Bind(e.pvp_type);
+		b.Bind(e.show_helm);
+		b.Bind(e.group_auto_consent);
+		b.Bind(e.raid_auto_consent);
+		b.Bind(e.guild_auto_consent);
+		b.Bind(e.leadership_exp_on);
+		b.Bind(e.RestTimer);
+		b.Bind(e.air_remaining);
+		b.Bind(e.autosplit_enabled);
+		b.Bind(e.lfp);
+		b.Bind(e.lfg);
+		b.Bind(e.mailkey);
+		b.Bind(e.xtargets);
+		b.Bind(e.firstlogon);
+		b.Bind(e.e_aa_effects);
+		b.Bind(e.e_percent_to_aa);
+		b.Bind(e.e_expended_aa_spent);
+		b.Bind(e.aa_points_spent_old);
+		b.Bind(e.aa_points_old);
+		b.Bind(e.e_last_invsnapshot);
+		b.Bind(e.deleted_at);
+	}
+
 	static CharacterData FindOne(
 		Database& db,
 		int character_data_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			CharacterData e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, character_data_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -1339,6 +1468,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int character_data_id,
+		std::function<void(CharacterData)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<CharacterData>();
+
+		db.RunAsync(
+			[e, character_data_id](Database& c) { *e = FindOne(c, character_data_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<CharacterData>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<CharacterData>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		CharacterData e,
+		std::function<void(CharacterData)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<CharacterData>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const CharacterData &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_CHARACTER_DATA_REPOSITORY_H
@@ -390,11 +390,111 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, CharacterStatsRecord &e)
+	{
+		b.Bind(e.character_id);
+		b.Bind(e.name);
+		b.Bind(e.status);
+		b.Bind(e.level);
+		b.Bind(e.class_);
+		b.Bind(e.race);
+		b.Bind(e.aa_points);
+		b.Bind(e.hp);
+		b.Bind(e.mana);
+		b.Bind(e.endurance);
+		b.Bind(e.ac);
+		b.Bind(e.strength);
+		b.Bind(e.stamina);
+		b.Bind(e.dexterity);
+		b.Bind(e.agility);
+		b.Bind(e.intelligence);
+		b.Bind(e.wisdom);
+		b.Bind(e.charisma);
+		b.Bind(e.magic_resist);
+		b.Bind(e.fire_resist);
+		b.Bind(e.cold_resist);
+		b.Bind(e.poison_resist);
+		b.Bind(e.disease_resist);
+		b.Bind(e.corruption_resist);
+		b.Bind(e.heroic_strength);
+		b.Bind(e.heroic_stamina);
+		b.Bind(e.heroic_dexterity);
+		b.Bind(e.heroic_agility);
+		b.Bind(e.heroic_intelligence);
+		b.Bind(e.heroic_wisdom);
+		b.Bind(e.heroic_charisma);
+		b.Bind(e.heroic_magic_resist);
+		b.Bind(e.heroic_fire_resist);
+		b.Bind(e.heroic_cold_resist);
+		b.Bind(e.heroic_poison_resist);
+		b.Bind(e.heroic_disease_resist);
+		b.Bind(e.heroic_corruption_resist);
+		b.Bind(e.haste);
+		b.Bind(e.accuracy);
+		b.Bind(e.attack);
+		b.Bind(e.avoidance);
+		b.Bind(e.clairvoyance);
+		b.Bind(e.combat_effects);
+		b.Bind(e.damage_shield_mitigation);
+		b.Bind(e.damage_shield);
+		b.Bind(e.dot_shielding);
+		b.Bind(e.hp_regen);
+		b.Bind(e.mana_regen);
+		b.Bind(e.endurance_regen);
+		b.Bind(e.shielding);
+		b.Bind(e.spell_damage);
+		b.Bind(e.spell_shielding);
+		b.Bind(e.strikethrough);
+		b.Bind(e.stun_resist);
+		b.Bind(e.backstab);
+		b.Bind(e.wind);
+		b.Bind(e.brass);
+		b.Bind(e.string);
+		b.Bind(e.percussion);
+		b.Bind(e.singing);
+		b.Bind(e.baking);
+		b.Bind(e.alchemy);
+		b.Bind(e.tailoring);
+		b.Bind(e.blacksmithing);
+		b.Bind(e.fletching);
+		b.Bind(e.brewing);
+		b.Bind(e.jewelry);
+		b.Bind(e.pottery);
+		b.Bind(e.research);
+		b.Bind(e.alcohol);
+		b.Bind(e.fishing);
+		b.Bind(e.tinkering);
+		b.Bind(e.created_at);
+		b.Bind(e.updated_at);
+	}
+
 	static CharacterStatsRecord FindOne(
 		Database& db,
 		int character_stats_record_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			CharacterStatsRecord e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, character_stats_record_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -1050,6 +1150,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int character_stats_record_id,
+		std::function<void(CharacterStatsRecord)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<CharacterStatsRecord>();
+
+		db.RunAsync(
+			[e, character_stats_record_id](Database& c) { *e = FindOne(c, character_stats_record_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<CharacterStatsRecord>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<CharacterStatsRecord>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		CharacterStatsRecord e,
+		std::function<void(CharacterStatsRecord)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<CharacterStatsRecord>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const CharacterStatsRecord &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_CHARACTER_STATS_RECORD_REPOSITORY_H
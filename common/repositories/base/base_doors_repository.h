@@ -237,11 +237,73 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Doors &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.doorid);
+		b.Bind(e.zone);
+		b.Bind(e.version);
+		b.Bind(e.name);
+		b.Bind(e.pos_y);
+		b.Bind(e.pos_x);
+		b.Bind(e.pos_z);
+		b.Bind(e.heading);
+		b.Bind(e.opentype);
+		b.Bind(e.guild);
+		b.Bind(e.lockpick);
+		b.Bind(e.keyitem);
+		b.Bind(e.nokeyring);
+		b.Bind(e.triggerdoor);
+		b.Bind(e.triggertype);
+		b.Bind(e.disable_timer);
+		b.Bind(e.doorisopen);
+		b.Bind(e.door_param);
+		b.Bind(e.dest_zone);
+		b.Bind(e.dest_instance);
+		b.Bind(e.dest_x);
+		b.Bind(e.dest_y);
+		b.Bind(e.dest_z);
+		b.Bind(e.dest_heading);
+		b.Bind(e.invert_state);
+		b.Bind(e.incline);
+		b.Bind(e.size);
+		b.Bind(e.buffer);
+		b.Bind(e.client_version_mask);
+		b.Bind(e.is_ldon_door);
+		b.Bind(e.dz_switch_id);
+		b.Bind(e.min_expansion);
+		b.Bind(e.max_expansion);
+		b.Bind(e.content_flags);
+		b.Bind(e.content_flags_disabled);
+	}
+
 	static Doors FindOne(
 		Database& db,
 		int doors_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Doors e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, doors_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -667,6 +729,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int doors_id,
+		std::function<void(Doors)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Doors>();
+
+		db.RunAsync(
+			[e, doors_id](Database& c) { *e = FindOne(c, doors_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Doors>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Doors>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Doors e,
+		std::function<void(Doors)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Doors>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Doors &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_DOORS_REPOSITORY_H
@@ -181,11 +181,59 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, DynamicZoneTemplates &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.zone_id);
+		b.Bind(e.zone_version);
+		b.Bind(e.name);
+		b.Bind(e.min_players);
+		b.Bind(e.max_players);
+		b.Bind(e.duration_seconds);
+		b.Bind(e.dz_switch_id);
+		b.Bind(e.compass_zone_id);
+		b.Bind(e.compass_x);
+		b.Bind(e.compass_y);
+		b.Bind(e.compass_z);
+		b.Bind(e.return_zone_id);
+		b.Bind(e.return_x);
+		b.Bind(e.return_y);
+		b.Bind(e.return_z);
+		b.Bind(e.return_h);
+		b.Bind(e.override_zone_in);
+		b.Bind(e.zone_in_x);
+		b.Bind(e.zone_in_y);
+		b.Bind(e.zone_in_z);
+		b.Bind(e.zone_in_h);
+	}
+
 	static DynamicZoneTemplates FindOne(
 		Database& db,
 		int dynamic_zone_templates_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			DynamicZoneTemplates e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, dynamic_zone_templates_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -527,6 +575,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int dynamic_zone_templates_id,
+		std::function<void(DynamicZoneTemplates)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<DynamicZoneTemplates>();
+
+		db.RunAsync(
+			[e, dynamic_zone_templates_id](Database& c) { *e = FindOne(c, dynamic_zone_templates_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<DynamicZoneTemplates>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<DynamicZoneTemplates>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		DynamicZoneTemplates e,
+		std::function<void(DynamicZoneTemplates)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<DynamicZoneTemplates>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const DynamicZoneTemplates &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_DYNAMIC_ZONE_TEMPLATES_REPOSITORY_H
@@ -185,11 +185,60 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, DynamicZones &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.instance_id);
+		b.Bind(e.type);
+		b.Bind(e.uuid);
+		b.Bind(e.name);
+		b.Bind(e.leader_id);
+		b.Bind(e.min_players);
+		b.Bind(e.max_players);
+		b.Bind(e.dz_switch_id);
+		b.Bind(e.compass_zone_id);
+		b.Bind(e.compass_x);
+		b.Bind(e.compass_y);
+		b.Bind(e.compass_z);
+		b.Bind(e.safe_return_zone_id);
+		b.Bind(e.safe_return_x);
+		b.Bind(e.safe_return_y);
+		b.Bind(e.safe_return_z);
+		b.Bind(e.safe_return_heading);
+		b.Bind(e.zone_in_x);
+		b.Bind(e.zone_in_y);
+		b.Bind(e.zone_in_z);
+		b.Bind(e.zone_in_heading);
+		b.Bind(e.has_zone_in);
+	}
+
 	static DynamicZones FindOne(
 		Database& db,
 		int dynamic_zones_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			DynamicZones e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, dynamic_zones_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -537,6 +586,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int dynamic_zones_id,
+		std::function<void(DynamicZones)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<DynamicZones>();
+
+		db.RunAsync(
+			[e, dynamic_zones_id](Database& c) { *e = FindOne(c, dynamic_zones_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<DynamicZones>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<DynamicZones>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		DynamicZones e,
+		std::function<void(DynamicZones)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<DynamicZones>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const DynamicZones &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_DYNAMIC_ZONES_REPOSITORY_H
@@ -177,11 +177,58 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, FactionAssociation &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.id_1);
+		b.Bind(e.mod_1);
+		b.Bind(e.id_2);
+		b.Bind(e.mod_2);
+		b.Bind(e.id_3);
+		b.Bind(e.mod_3);
+		b.Bind(e.id_4);
+		b.Bind(e.mod_4);
+		b.Bind(e.id_5);
+		b.Bind(e.mod_5);
+		b.Bind(e.id_6);
+		b.Bind(e.mod_6);
+		b.Bind(e.id_7);
+		b.Bind(e.mod_7);
+		b.Bind(e.id_8);
+		b.Bind(e.mod_8);
+		b.Bind(e.id_9);
+		b.Bind(e.mod_9);
+		b.Bind(e.id_10);
+		b.Bind(e.mod_10);
+	}
+
 	static FactionAssociation FindOne(
 		Database& db,
 		int faction_association_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			FactionAssociation e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, faction_association_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -518,6 +565,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int faction_association_id,
+		std::function<void(FactionAssociation)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<FactionAssociation>();
+
+		db.RunAsync(
+			[e, faction_association_id](Database& c) { *e = FindOne(c, faction_association_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<FactionAssociation>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<FactionAssociation>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		FactionAssociation e,
+		std::function<void(FactionAssociation)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<FactionAssociation>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const FactionAssociation &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_FACTION_ASSOCIATION_REPOSITORY_H
@@ -161,11 +161,54 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, GlobalLoot &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.description);
+		b.Bind(e.loottable_id);
+		b.Bind(e.enabled);
+		b.Bind(e.min_level);
+		b.Bind(e.max_level);
+		b.Bind(e.rare);
+		b.Bind(e.raid);
+		b.Bind(e.race);
+		b.Bind(e.class_);
+		b.Bind(e.bodytype);
+		b.Bind(e.zone);
+		b.Bind(e.hot_zone);
+		b.Bind(e.min_expansion);
+		b.Bind(e.max_expansion);
+		b.Bind(e.content_flags);
+		b.Bind(e.content_flags_disabled);
+	}
+
 	static GlobalLoot FindOne(
 		Database& db,
 		int global_loot_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			GlobalLoot e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, global_loot_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -477,6 +520,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int global_loot_id,
+		std::function<void(GlobalLoot)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<GlobalLoot>();
+
+		db.RunAsync(
+			[e, global_loot_id](Database& c) { *e = FindOne(c, global_loot_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<GlobalLoot>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<GlobalLoot>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		GlobalLoot e,
+		std::function<void(GlobalLoot)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<GlobalLoot>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const GlobalLoot &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_GLOBAL_LOOT_REPOSITORY_H
@@ -165,11 +165,55 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, GroundSpawns &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.zoneid);
+		b.Bind(e.version);
+		b.Bind(e.max_x);
+		b.Bind(e.max_y);
+		b.Bind(e.max_z);
+		b.Bind(e.min_x);
+		b.Bind(e.min_y);
+		b.Bind(e.heading);
+		b.Bind(e.name);
+		b.Bind(e.item);
+		b.Bind(e.max_allowed);
+		b.Bind(e.comment);
+		b.Bind(e.respawn_timer);
+		b.Bind(e.min_expansion);
+		b.Bind(e.max_expansion);
+		b.Bind(e.content_flags);
+		b.Bind(e.content_flags_disabled);
+	}
+
 	static GroundSpawns FindOne(
 		Database& db,
 		int ground_spawns_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			GroundSpawns e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, ground_spawns_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -487,6 +531,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int ground_spawns_id,
+		std::function<void(GroundSpawns)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<GroundSpawns>();
+
+		db.RunAsync(
+			[e, ground_spawns_id](Database& c) { *e = FindOne(c, ground_spawns_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<GroundSpawns>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<GroundSpawns>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		GroundSpawns e,
+		std::function<void(GroundSpawns)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<GroundSpawns>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const GroundSpawns &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_GROUND_SPAWNS_REPOSITORY_H
@@ -157,11 +157,53 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Inventory &e)
+	{
+		b.Bind(e.charid);
+		b.Bind(e.slotid);
+		b.Bind(e.itemid);
+		b.Bind(e.charges);
+		b.Bind(e.color);
+		b.Bind(e.augslot1);
+		b.Bind(e.augslot2);
+		b.Bind(e.augslot3);
+		b.Bind(e.augslot4);
+		b.Bind(e.augslot5);
+		b.Bind(e.augslot6);
+		b.Bind(e.instnodrop);
+		b.Bind(e.custom_data);
+		b.Bind(e.ornamenticon);
+		b.Bind(e.ornamentidfile);
+		b.Bind(e.ornament_hero_model);
+	}
+
 	static Inventory FindOne(
 		Database& db,
 		int inventory_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Inventory e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, inventory_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -468,6 +510,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int inventory_id,
+		std::function<void(Inventory)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Inventory>();
+
+		db.RunAsync(
+			[e, inventory_id](Database& c) { *e = FindOne(c, inventory_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Inventory>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Inventory>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Inventory e,
+		std::function<void(Inventory)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Inventory>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Inventory &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_INVENTORY_REPOSITORY_H
@@ -1234,11 +1234,322 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Items &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.minstatus);
+		b.Bind(e.Name);
+		b.Bind(e.aagi);
+		b.Bind(e.ac);
+		b.Bind(e.accuracy);
+		b.Bind(e.acha);
+		b.Bind(e.adex);
+		b.Bind(e.aint);
+		b.Bind(e.artifactflag);
+		b.Bind(e.asta);
+		b.Bind(e.astr);
+		b.Bind(e.attack);
+		b.Bind(e.augrestrict);
+		b.Bind(e.augslot1type);
+		b.Bind(e.augslot1visible);
+		b.Bind(e.augslot2type);
+		b.Bind(e.augslot2visible);
+		b.Bind(e.augslot3type);
+		b.Bind(e.augslot3visible);
+		b.Bind(e.augslot4type);
+		b.Bind(e.augslot4visible);
+		b.Bind(e.augslot5type);
+		b.Bind(e.augslot5visible);
+		b.Bind(e.augslot6type);
+		b.Bind(e.augslot6visible);
+		b.Bind(e.augtype);
+		b.Bind(e.avoidance);
+		b.Bind(e.awis);
+		b.Bind(e.bagsize);
+		b.Bind(e.bagslots);
+		b.Bind(e.bagtype);
+		b.Bind(e.bagwr);
+		b.Bind(e.banedmgamt);
+		b.Bind(e.banedmgraceamt);
+		b.Bind(e.banedmgbody);
+		b.Bind(e.banedmgrace);
+		b.Bind(e.bardtype);
+		b.Bind(e.bardvalue);
+		b.Bind(e.book);
+		b.Bind(e.casttime);
+		b.Bind(e.casttime_);
+		b.Bind(e.charmfile);
+		b.Bind(e.charmfileid);
+		b.Bind(e.classes);
+		b.Bind(e.color);
+		b.Bind(e.combateffects);
+		b.Bind(e.extradmgskill);
+		b.Bind(e.extradmgamt);
+		b.Bind(e.price);
+		b.Bind(e.cr);
+		b.Bind(e.damage);
+		b.Bind(e.damageshield);
+		b.Bind(e.deity);
+		b.Bind(e.delay);
+		b.Bind(e.augdistiller);
+		b.Bind(e.dotshielding);
+		b.Bind(e.dr);
+		b.Bind(e.clicktype);
+		b.Bind(e.clicklevel2);
+		b.Bind(e.elemdmgtype);
+		b.Bind(e.elemdmgamt);
+		b.Bind(e.endur);
+		b.Bind(e.factionamt1);
+		b.Bind(e.factionamt2);
+		b.Bind(e.factionamt3);
+		b.Bind(e.factionamt4);
+		b.Bind(e.factionmod1);
+		b.Bind(e.factionmod2);
+		b.Bind(e.factionmod3);
+		b.Bind(e.factionmod4);
+		b.Bind(e.filename);
+		b.Bind(e.focuseffect);
+		b.Bind(e.fr);
+		b.Bind(e.fvnodrop);
+		b.Bind(e.haste);
+		b.Bind(e.clicklevel);
+		b.Bind(e.hp);
+		b.Bind(e.regen);
+		b.Bind(e.icon);
+		b.Bind(e.idfile);
+		b.Bind(e.itemclass);
+		b.Bind(e.itemtype);
+		b.Bind(e.ldonprice);
+		b.Bind(e.ldontheme);
+		b.Bind(e.ldonsold);
+		b.Bind(e.light);
+		b.Bind(e.lore);
+		b.Bind(e.loregroup);
+		b.Bind(e.magic);
+		b.Bind(e.mana);
+		b.Bind(e.manaregen);
+		b.Bind(e.enduranceregen);
+		b.Bind(e.material);
+		b.Bind(e.herosforgemodel);
+		b.Bind(e.maxcharges);
+		b.Bind(e.mr);
+		b.Bind(e.nodrop);
+		b.Bind(e.norent);
+		b.Bind(e.pendingloreflag);
+		b.Bind(e.pr);
+		b.Bind(e.procrate);
+		b.Bind(e.races);
+		b.Bind(e.range_);
+		b.Bind(e.reclevel);
+		b.Bind(e.recskill);
+		b.Bind(e.reqlevel);
+		b.Bind(e.sellrate);
+		b.Bind(e.shielding);
+		b.Bind(e.size);
+		b.Bind(e.skillmodtype);
+		b.Bind(e.skillmodvalue);
+		b.Bind(e.slots);
+		b.Bind(e.clickeffect);
+		b.Bind(e.spellshield);
+		b.Bind(e.strikethrough);
+		b.Bind(e.stunresist);
+		b.Bind(e.summonedflag);
+		b.Bind(e.tradeskills);
+		b.Bind(e.favor);
+		b.Bind(e.weight);
+		b.Bind(e.UNK012);
+		b.Bind(e.UNK013);
+		b.Bind(e.benefitflag);
+		b.Bind(e.UNK054);
+		b.Bind(e.UNK059);
+		b.Bind(e.booktype);
+		b.Bind(e.recastdelay);
+		b.Bind(e.recasttype);
+		b.Bind(e.guildfavor);
+		b.Bind(e.UNK123);
+		b.Bind(e.UNK124);
+		b.Bind(e.attuneable);
+		b.Bind(e.nopet);
+		b.Bind(e.updated);
+		b.Bind(e.comment);
+		b.Bind(e.UNK127);
+		b.Bind(e.pointtype);
+		b.Bind(e.potionbelt);
+		b.Bind(e.potionbeltslots);
+		b.Bind(e.stacksize);
+		b.Bind(e.notransfer);
+		b.Bind(e.stackable);
+		b.Bind(e.UNK134);
+		b.Bind(e.UNK137);
+		b.Bind(e.proceffect);
+		b.Bind(e.proctype);
+		b.Bind(e.proclevel2);
+		b.Bind(e.proclevel);
+		b.Bind(e.UNK142);
+		b.Bind(e.worneffect);
+		b.Bind(e.worntype);
+		b.Bind(e.wornlevel2);
+		b.Bind(e.wornlevel);
+		b.Bind(e.UNK147);
+		b.Bind(e.focustype);
+		b.Bind(e.focuslevel2);
+		b.Bind(e.focuslevel);
+		b.Bind(e.UNK152);
+		b.Bind(e.scrolleffect);
+		b.Bind(e.scrolltype);
+		b.Bind(e.scrolllevel2);
+		b.Bind(e.scrolllevel);
+		b.Bind(e.UNK157);
+		b.Bind(e.serialized);
+		b.Bind(e.verified);
+		b.Bind(e.serialization);
+		b.Bind(e.source);
+		b.Bind(e.UNK033);
+		b.Bind(e.lorefile);
+		b.Bind(e.UNK014);
+		b.Bind(e.svcorruption);
+		b.Bind(e.skillmodmax);
+		b.Bind(e.UNK060);
+		b.Bind(e.augslot1unk2);
+		b.Bind(e.augslot2unk2);
+		b.Bind(e.augslot3unk2);
+		b.Bind(e.augslot4unk2);
+		b.Bind(e.augslot5unk2);
+		b.Bind(e.augslot6unk2);
+		b.Bind(e.UNK120);
+		b.Bind(e.UNK121);
+		b.Bind(e.questitemflag);
+		b.Bind(e.UNK132);
+		b.Bind(e.clickunk5);
+		b.Bind(e.clickunk6);
+		b.Bind(e.clickunk7);
+		b.Bind(e.procunk1);
+		b.Bind(e.procunk2);
+		b.Bind(e.procunk3);
+		b.Bind(e.procunk4);
+		b.Bind(e.procunk6);
+		b.Bind(e.procunk7);
+		b.Bind(e.wornunk1);
+		b.Bind(e.wornunk2);
+		b.Bind(e.wornunk3);
+		b.Bind(e.wornunk4);
+		b.Bind(e.wornunk5);
+		b.Bind(e.wornunk6);
+		b.Bind(e.wornunk7);
+		b.Bind(e.focusunk1);
+		b.Bind(e.focusunk2);
+		b.Bind(e.focusunk3);
+		b.Bind(e.focusunk4);
+		b.Bind(e.focusunk5);
+		b.Bind(e.focusunk6);
+		b.Bind(e.focusunk7);
+		b.Bind(e.scrollunk1);
+		b.Bind(e.scrollunk2);
+		b.Bind(e.scrollunk3);
+		b.Bind(e.scrollunk4);
+		b.Bind(e.scrollunk5);
+		b.Bind(e.scrollunk6);
+		b.Bind(e.scrollunk7);
+		b.Bind(e.UNK193);
+		b.Bind(e.purity);
+		b.Bind(e.evoitem);
+		b.Bind(e.evoid);
+		b.Bind(e.evolvinglevel);
+		b.Bind(e.evomax);
+		b.Bind(e.clickname);
+		b.Bind(e.procname);
+		b.Bind(e.wornname);
+		b.Bind(e.focusname);
+		b.Bind(e.scrollname);
+		b.Bind(e.dsmitigation);
+		b.Bind(e.heroic_str);
+		b.Bind(e.heroic_int);
+		b.Bind(e.heroic_wis);
+		b.Bind(e.heroic_agi);
+		b.Bind(e.heroic_dex);
+		b.Bind(e.heroic_sta);
+		b.Bind(e.heroic_cha);
+		b.Bind(e.heroic_pr);
+		b.Bind(e.heroic_dr);
+		b.Bind(e.heroic_fr);
+		b.Bind(e.heroic_cr);
+		b.Bind(e.heroic_mr);
+		b.Bind(e.heroic_svcorrup);
+		b.Bind(e.healamt);
+		b.Bind(e.spelldmg);
+		b.Bind(e.clairvoyance);
+		b.Bind(e.backstabdmg);
+		b.Bind(e.created);
+		b.Bind(e.elitematerial);
+		b.Bind(e.ldonsellbackrate);
+		b.Bind(e.scriptfileid);
+		b.Bind(e.expendablearrow);
+		b.Bind(e.powersourcecapacity);
+		b.Bind(e.bardeffect);
+		b.Bind(e.bardeffecttype);
+		b.Bind(e.bardlevel2);
+		b.Bind(e.bardlevel);
+		b.Bind(e.bardunk1);
+		b.Bind(e.bardunk2);
+		b.Bind(e.bardunk3);
+		b.Bind(e.bardunk4);
+		b.Bind(e.bardunk5);
+		b.Bind(e.bardname);
+		b.Bind(e.bardunk7);
+		b.Bind(e.UNK214);
+		b.Bind(e.subtype);
+		b.Bind(e.UNK220);
+		b.Bind(e.UNK221);
+		b.Bind(e.heirloom);
+		b.Bind(e.UNK223);
+		b.Bind(e.UNK224);
+		b.Bind(e.UNK225);
+		b.Bind(e.UNK226);
+		b.Bind(e.UNK227);
+		b.Bind(e.UNK228);
+		b.Bind(e.UNK229);
+		b.Bind(e.UNK230);
+		b.Bind(e.UNK231);
+		b.Bind(e.UNK232);
+		b.Bind(e.UNK233);
+		b.Bind(e.UNK234);
+		b.Bind(e.placeable);
+		b.Bind(e.UNK236);
+		b.Bind(e.UNK237);
+		b.Bind(e.UNK238);
+		b.Bind(e.UNK239);
+		b.Bind(e.UNK240);
+		b.Bind(e.UNK241);
+		b.Bind(e.epicitem);
+	}
+
 	static Items FindOne(
 		Database& db,
 		int items_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Items e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, items_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -3160,6 +3471,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int items_id,
+		std::function<void(Items)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Items>();
+
+		db.RunAsync(
+			[e, items_id](Database& c) { *e = FindOne(c, items_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Items>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Items>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Items e,
+		std::function<void(Items)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Items>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Items &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_ITEMS_REPOSITORY_H
@@ -133,11 +133,47 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, LoginWorldServers &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.long_name);
+		b.Bind(e.short_name);
+		b.Bind(e.tag_description);
+		b.Bind(e.login_server_list_type_id);
+		b.Bind(e.last_login_date);
+		b.Bind(e.last_ip_address);
+		b.Bind(e.login_server_admin_id);
+		b.Bind(e.is_server_trusted);
+		b.Bind(e.note);
+	}
+
 	static LoginWorldServers FindOne(
 		Database& db,
 		int login_world_servers_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			LoginWorldServers e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, login_world_servers_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -407,6 +443,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int login_world_servers_id,
+		std::function<void(LoginWorldServers)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<LoginWorldServers>();
+
+		db.RunAsync(
+			[e, login_world_servers_id](Database& c) { *e = FindOne(c, login_world_servers_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<LoginWorldServers>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<LoginWorldServers>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		LoginWorldServers e,
+		std::function<void(LoginWorldServers)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<LoginWorldServers>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const LoginWorldServers &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_LOGIN_WORLD_SERVERS_REPOSITORY_H
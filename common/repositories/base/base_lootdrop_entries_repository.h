@@ -137,11 +137,48 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, LootdropEntries &e)
+	{
+		b.Bind(e.lootdrop_id);
+		b.Bind(e.item_id);
+		b.Bind(e.item_charges);
+		b.Bind(e.equip_item);
+		b.Bind(e.chance);
+		b.Bind(e.disabled_chance);
+		b.Bind(e.trivial_min_level);
+		b.Bind(e.trivial_max_level);
+		b.Bind(e.multiplier);
+		b.Bind(e.npc_min_level);
+		b.Bind(e.npc_max_level);
+	}
+
 	static LootdropEntries FindOne(
 		Database& db,
 		int lootdrop_entries_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			LootdropEntries e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, lootdrop_entries_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -418,6 +455,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int lootdrop_entries_id,
+		std::function<void(LootdropEntries)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<LootdropEntries>();
+
+		db.RunAsync(
+			[e, lootdrop_entries_id](Database& c) { *e = FindOne(c, lootdrop_entries_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<LootdropEntries>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<LootdropEntries>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		LootdropEntries e,
+		std::function<void(LootdropEntries)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<LootdropEntries>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const LootdropEntries &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_LOOTDROP_ENTRIES_REPOSITORY_H
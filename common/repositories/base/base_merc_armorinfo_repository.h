@@ -134,11 +134,47 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, MercArmorinfo &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.merc_npc_type_id);
+		b.Bind(e.minlevel);
+		b.Bind(e.maxlevel);
+		b.Bind(e.texture);
+		b.Bind(e.helmtexture);
+		b.Bind(e.armortint_id);
+		b.Bind(e.armortint_red);
+		b.Bind(e.armortint_green);
+		b.Bind(e.armortint_blue);
+	}
+
 	static MercArmorinfo FindOne(
 		Database& db,
 		int merc_armorinfo_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			MercArmorinfo e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, merc_armorinfo_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -409,6 +445,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int merc_armorinfo_id,
+		std::function<void(MercArmorinfo)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<MercArmorinfo>();
+
+		db.RunAsync(
+			[e, merc_armorinfo_id](Database& c) { *e = FindOne(c, merc_armorinfo_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<MercArmorinfo>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<MercArmorinfo>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		MercArmorinfo e,
+		std::function<void(MercArmorinfo)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<MercArmorinfo>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const MercArmorinfo &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_MERC_ARMORINFO_REPOSITORY_H
@@ -170,11 +170,56 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, MercBuffs &e)
+	{
+		b.Bind(e.MercBuffId);
+		b.Bind(e.MercId);
+		b.Bind(e.SpellId);
+		b.Bind(e.CasterLevel);
+		b.Bind(e.DurationFormula);
+		b.Bind(e.TicsRemaining);
+		b.Bind(e.PoisonCounters);
+		b.Bind(e.DiseaseCounters);
+		b.Bind(e.CurseCounters);
+		b.Bind(e.CorruptionCounters);
+		b.Bind(e.HitCount);
+		b.Bind(e.MeleeRune);
+		b.Bind(e.MagicRune);
+		b.Bind(e.dot_rune);
+		b.Bind(e.caston_x);
+		b.Bind(e.Persistent);
+		b.Bind(e.caston_y);
+		b.Bind(e.caston_z);
+		b.Bind(e.ExtraDIChance);
+	}
+
 	static MercBuffs FindOne(
 		Database& db,
 		int merc_buffs_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			MercBuffs e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, merc_buffs_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -499,6 +544,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int merc_buffs_id,
+		std::function<void(MercBuffs)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<MercBuffs>();
+
+		db.RunAsync(
+			[e, merc_buffs_id](Database& c) { *e = FindOne(c, merc_buffs_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<MercBuffs>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<MercBuffs>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		MercBuffs e,
+		std::function<void(MercBuffs)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<MercBuffs>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const MercBuffs &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_MERC_BUFFS_REPOSITORY_H
@@ -226,11 +226,70 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, MercStats &e)
+	{
+		b.Bind(e.merc_npc_type_id);
+		b.Bind(e.clientlevel);
+		b.Bind(e.level);
+		b.Bind(e.hp);
+		b.Bind(e.mana);
+		b.Bind(e.AC);
+		b.Bind(e.ATK);
+		b.Bind(e.STR);
+		b.Bind(e.STA);
+		b.Bind(e.DEX);
+		b.Bind(e.AGI);
+		b.Bind(e._INT);
+		b.Bind(e.WIS);
+		b.Bind(e.CHA);
+		b.Bind(e.MR);
+		b.Bind(e.CR);
+		b.Bind(e.DR);
+		b.Bind(e.FR);
+		b.Bind(e.PR);
+		b.Bind(e.Corrup);
+		b.Bind(e.mindmg);
+		b.Bind(e.maxdmg);
+		b.Bind(e.attack_count);
+		b.Bind(e.attack_speed);
+		b.Bind(e.attack_delay);
+		b.Bind(e.special_abilities);
+		b.Bind(e.Accuracy);
+		b.Bind(e.hp_regen_rate);
+		b.Bind(e.mana_regen_rate);
+		b.Bind(e.runspeed);
+		b.Bind(e.statscale);
+		b.Bind(e.spellscale);
+		b.Bind(e.healscale);
+	}
+
 	static MercStats FindOne(
 		Database& db,
 		int merc_stats_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			MercStats e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, merc_stats_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -640,6 +699,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int merc_stats_id,
+		std::function<void(MercStats)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<MercStats>();
+
+		db.RunAsync(
+			[e, merc_stats_id](Database& c) { *e = FindOne(c, merc_stats_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<MercStats>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<MercStats>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		MercStats e,
+		std::function<void(MercStats)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<MercStats>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const MercStats &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_MERC_STATS_REPOSITORY_H
@@ -190,11 +190,61 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Mercs &e)
+	{
+		b.Bind(e.MercID);
+		b.Bind(e.OwnerCharacterID);
+		b.Bind(e.Slot);
+		b.Bind(e.Name);
+		b.Bind(e.TemplateID);
+		b.Bind(e.SuspendedTime);
+		b.Bind(e.IsSuspended);
+		b.Bind(e.TimerRemaining);
+		b.Bind(e.Gender);
+		b.Bind(e.MercSize);
+		b.Bind(e.StanceID);
+		b.Bind(e.HP);
+		b.Bind(e.Mana);
+		b.Bind(e.Endurance);
+		b.Bind(e.Face);
+		b.Bind(e.LuclinHairStyle);
+		b.Bind(e.LuclinHairColor);
+		b.Bind(e.LuclinEyeColor);
+		b.Bind(e.LuclinEyeColor2);
+		b.Bind(e.LuclinBeardColor);
+		b.Bind(e.LuclinBeard);
+		b.Bind(e.DrakkinHeritage);
+		b.Bind(e.DrakkinTattoo);
+		b.Bind(e.DrakkinDetails);
+	}
+
 	static Mercs FindOne(
 		Database& db,
 		int mercs_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Mercs e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, mercs_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -549,6 +599,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int mercs_id,
+		std::function<void(Mercs)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Mercs>();
+
+		db.RunAsync(
+			[e, mercs_id](Database& c) { *e = FindOne(c, mercs_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Mercs>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Mercs>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Mercs e,
+		std::function<void(Mercs)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Mercs>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Mercs &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_MERCS_REPOSITORY_H
@@ -226,11 +226,70 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, NpcScaleGlobalBase &e)
+	{
+		b.Bind(e.type);
+		b.Bind(e.level);
+		b.Bind(e.zone_id_list);
+		b.Bind(e.instance_version_list);
+		b.Bind(e.ac);
+		b.Bind(e.hp);
+		b.Bind(e.accuracy);
+		b.Bind(e.slow_mitigation);
+		b.Bind(e.attack);
+		b.Bind(e.strength);
+		b.Bind(e.stamina);
+		b.Bind(e.dexterity);
+		b.Bind(e.agility);
+		b.Bind(e.intelligence);
+		b.Bind(e.wisdom);
+		b.Bind(e.charisma);
+		b.Bind(e.magic_resist);
+		b.Bind(e.cold_resist);
+		b.Bind(e.fire_resist);
+		b.Bind(e.poison_resist);
+		b.Bind(e.disease_resist);
+		b.Bind(e.corruption_resist);
+		b.Bind(e.physical_resist);
+		b.Bind(e.min_dmg);
+		b.Bind(e.max_dmg);
+		b.Bind(e.hp_regen_rate);
+		b.Bind(e.hp_regen_per_second);
+		b.Bind(e.attack_delay);
+		b.Bind(e.spell_scale);
+		b.Bind(e.heal_scale);
+		b.Bind(e.avoidance);
+		b.Bind(e.heroic_strikethrough);
+		b.Bind(e.special_abilities);
+	}
+
 	static NpcScaleGlobalBase FindOne(
 		Database& db,
 		int npc_scale_global_base_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			NpcScaleGlobalBase e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, npc_scale_global_base_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -640,6 +699,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int npc_scale_global_base_id,
+		std::function<void(NpcScaleGlobalBase)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<NpcScaleGlobalBase>();
+
+		db.RunAsync(
+			[e, npc_scale_global_base_id](Database& c) { *e = FindOne(c, npc_scale_global_base_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<NpcScaleGlobalBase>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<NpcScaleGlobalBase>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		NpcScaleGlobalBase e,
+		std::function<void(NpcScaleGlobalBase)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<NpcScaleGlobalBase>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const NpcScaleGlobalBase &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_NPC_SCALE_GLOBAL_BASE_REPOSITORY_H
@@ -177,11 +177,58 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, NpcSpells &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.name);
+		b.Bind(e.parent_list);
+		b.Bind(e.attack_proc);
+		b.Bind(e.proc_chance);
+		b.Bind(e.range_proc);
+		b.Bind(e.rproc_chance);
+		b.Bind(e.defensive_proc);
+		b.Bind(e.dproc_chance);
+		b.Bind(e.fail_recast);
+		b.Bind(e.engaged_no_sp_recast_min);
+		b.Bind(e.engaged_no_sp_recast_max);
+		b.Bind(e.engaged_b_self_chance);
+		b.Bind(e.engaged_b_other_chance);
+		b.Bind(e.engaged_d_chance);
+		b.Bind(e.pursue_no_sp_recast_min);
+		b.Bind(e.pursue_no_sp_recast_max);
+		b.Bind(e.pursue_d_chance);
+		b.Bind(e.idle_no_sp_recast_min);
+		b.Bind(e.idle_no_sp_recast_max);
+		b.Bind(e.idle_b_chance);
+	}
+
 	static NpcSpells FindOne(
 		Database& db,
 		int npc_spells_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			NpcSpells e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, npc_spells_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -517,6 +564,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int npc_spells_id,
+		std::function<void(NpcSpells)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<NpcSpells>();
+
+		db.RunAsync(
+			[e, npc_spells_id](Database& c) { *e = FindOne(c, npc_spells_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<NpcSpells>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<NpcSpells>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		NpcSpells e,
+		std::function<void(NpcSpells)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<NpcSpells>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const NpcSpells &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_NPC_SPELLS_REPOSITORY_H
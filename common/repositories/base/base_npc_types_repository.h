@@ -602,11 +602,164 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, NpcTypes &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.name);
+		b.Bind(e.lastname);
+		b.Bind(e.level);
+		b.Bind(e.race);
+		b.Bind(e.class_);
+		b.Bind(e.bodytype);
+		b.Bind(e.hp);
+		b.Bind(e.mana);
+		b.Bind(e.gender);
+		b.Bind(e.texture);
+		b.Bind(e.helmtexture);
+		b.Bind(e.herosforgemodel);
+		b.Bind(e.size);
+		b.Bind(e.hp_regen_rate);
+		b.Bind(e.hp_regen_per_second);
+		b.Bind(e.mana_regen_rate);
+		b.Bind(e.loottable_id);
+		b.Bind(e.merchant_id);
+		b.Bind(e.alt_currency_id);
+		b.Bind(e.npc_spells_id);
+		b.Bind(e.npc_spells_effects_id);
+		b.Bind(e.npc_faction_id);
+		b.Bind(e.adventure_template_id);
+		b.Bind(e.trap_template);
+		b.Bind(e.mindmg);
+		b.Bind(e.maxdmg);
+		b.Bind(e.attack_count);
+		b.Bind(e.npcspecialattks);
+		b.Bind(e.special_abilities);
+		b.Bind(e.aggroradius);
+		b.Bind(e.assistradius);
+		b.Bind(e.face);
+		b.Bind(e.luclin_hairstyle);
+		b.Bind(e.luclin_haircolor);
+		b.Bind(e.luclin_eyecolor);
+		b.Bind(e.luclin_eyecolor2);
+		b.Bind(e.luclin_beardcolor);
+		b.Bind(e.luclin_beard);
+		b.Bind(e.drakkin_heritage);
+		b.Bind(e.drakkin_tattoo);
+		b.Bind(e.drakkin_details);
+		b.Bind(e.armortint_id);
+		b.Bind(e.armortint_red);
+		b.Bind(e.armortint_green);
+		b.Bind(e.armortint_blue);
+		b.Bind(e.d_melee_texture1);
+		b.Bind(e.d_melee_texture2);
+		b.Bind(e.ammo_idfile);
+		b.Bind(e.prim_melee_type);
+		b.Bind(e.sec_melee_type);
+		b.Bind(e.ranged_type);
+		b.Bind(e.runspeed);
+		b.Bind(e.MR);
+		b.Bind(e.CR);
+		b.Bind(e.DR);
+		b.Bind(e.FR);
+		b.Bind(e.PR);
+		b.Bind(e.Corrup);
+		b.Bind(e.PhR);
+		b.Bind(e.see_invis);
+		b.Bind(e.see_invis_undead);
+		b.Bind(e.qglobal);
+		b.Bind(e.AC);
+		b.Bind(e.npc_aggro);
+		b.Bind(e.spawn_limit);
+		b.Bind(e.attack_speed);
+		b.Bind(e.attack_delay);
+		b.Bind(e.findable);
+		b.Bind(e.STR);
+		b.Bind(e.STA);
+		b.Bind(e.DEX);
+		b.Bind(e.AGI);
+		b.Bind(e._INT);
+		b.Bind(e.WIS);
+		b.Bind(e.CHA);
+		b.Bind(e.see_hide);
+		b.Bind(e.see_improved_hide);
+		b.Bind(e.trackable);
+		b.Bind(e.isbot);
+		b.Bind(e.exclude);
+		b.Bind(e.ATK);
+		b.Bind(e.Accuracy);
+		b.Bind(e.Avoidance);
+		b.Bind(e.slow_mitigation);
+		b.Bind(e.version);
+		b.Bind(e.maxlevel);
+		b.Bind(e.scalerate);
+		b.Bind(e.private_corpse);
+		b.Bind(e.unique_spawn_by_name);
+		b.Bind(e.underwater);
+		b.Bind(e.isquest);
+		b.Bind(e.emoteid);
+		b.Bind(e.spellscale);
+		b.Bind(e.healscale);
+		b.Bind(e.no_target_hotkey);
+		b.Bind(e.raid_target);
+		b.Bind(e.armtexture);
+		b.Bind(e.bracertexture);
+		b.Bind(e.handtexture);
+		b.Bind(e.legtexture);
+		b.Bind(e.feettexture);
+		b.Bind(e.light);
+		b.Bind(e.walkspeed);
+		b.Bind(e.peqid);
+		b.Bind(e.unique_);
+		b.Bind(e.fixed);
+		b.Bind(e.ignore_despawn);
+		b.Bind(e.show_name);
+		b.Bind(e.untargetable);
+		b.Bind(e.charm_ac);
+		b.Bind(e.charm_min_dmg);
+		b.Bind(e.charm_max_dmg);
+		b.Bind(e.charm_attack_delay);
+		b.Bind(e.charm_accuracy_rating);
+		b.Bind(e.charm_avoidance_rating);
+		b.Bind(e.charm_atk);
+		b.Bind(e.skip_global_loot);
+		b.Bind(e.rare_spawn);
+		b.Bind(e.stuck_behavior);
+		b.Bind(e.model);
+		b.Bind(e.flymode);
+		b.Bind(e.always_aggro);
+		b.Bind(e.exp_mod);
+		b.Bind(e.heroic_strikethrough);
+		b.Bind(e.faction_amount);
+		b.Bind(e.keeps_sold_items);
+	}
+
 	static NpcTypes FindOne(
 		Database& db,
 		int npc_types_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			NpcTypes e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, npc_types_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -1579,6 +1732,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int npc_types_id,
+		std::function<void(NpcTypes)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<NpcTypes>();
+
+		db.RunAsync(
+			[e, npc_types_id](Database& c) { *e = FindOne(c, npc_types_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<NpcTypes>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<NpcTypes>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		NpcTypes e,
+		std::function<void(NpcTypes)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<NpcTypes>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const NpcTypes &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_NPC_TYPES_REPOSITORY_H
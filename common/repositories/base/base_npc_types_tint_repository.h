@@ -209,11 +209,66 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, NpcTypesTint &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.tint_set_name);
+		b.Bind(e.red1h);
+		b.Bind(e.grn1h);
+		b.Bind(e.blu1h);
+		b.Bind(e.red2c);
+		b.Bind(e.grn2c);
+		b.Bind(e.blu2c);
+		b.Bind(e.red3a);
+		b.Bind(e.grn3a);
+		b.Bind(e.blu3a);
+		b.Bind(e.red4b);
+		b.Bind(e.grn4b);
+		b.Bind(e.blu4b);
+		b.Bind(e.red5g);
+		b.Bind(e.grn5g);
+		b.Bind(e.blu5g);
+		b.Bind(e.red6l);
+		b.Bind(e.grn6l);
+		b.Bind(e.blu6l);
+		b.Bind(e.red7f);
+		b.Bind(e.grn7f);
+		b.Bind(e.blu7f);
+		b.Bind(e.red8x);
+		b.Bind(e.grn8x);
+		b.Bind(e.blu8x);
+		b.Bind(e.red9x);
+		b.Bind(e.grn9x);
+		b.Bind(e.blu9x);
+	}
+
 	static NpcTypesTint FindOne(
 		Database& db,
 		int npc_types_tint_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			NpcTypesTint e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, npc_types_tint_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -598,6 +653,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int npc_types_tint_id,
+		std::function<void(NpcTypesTint)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<NpcTypesTint>();
+
+		db.RunAsync(
+			[e, npc_types_tint_id](Database& c) { *e = FindOne(c, npc_types_tint_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<NpcTypesTint>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<NpcTypesTint>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		NpcTypesTint e,
+		std::function<void(NpcTypesTint)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<NpcTypesTint>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const NpcTypesTint &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_NPC_TYPES_TINT_REPOSITORY_H
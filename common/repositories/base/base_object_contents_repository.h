@@ -141,11 +141,49 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, ObjectContents &e)
+	{
+		b.Bind(e.zoneid);
+		b.Bind(e.parentid);
+		b.Bind(e.bagidx);
+		b.Bind(e.itemid);
+		b.Bind(e.charges);
+		b.Bind(e.droptime);
+		b.Bind(e.augslot1);
+		b.Bind(e.augslot2);
+		b.Bind(e.augslot3);
+		b.Bind(e.augslot4);
+		b.Bind(e.augslot5);
+		b.Bind(e.augslot6);
+	}
+
 	static ObjectContents FindOne(
 		Database& db,
 		int object_contents_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			ObjectContents e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, object_contents_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -428,6 +466,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int object_contents_id,
+		std::function<void(ObjectContents)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<ObjectContents>();
+
+		db.RunAsync(
+			[e, object_contents_id](Database& c) { *e = FindOne(c, object_contents_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<ObjectContents>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<ObjectContents>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		ObjectContents e,
+		std::function<void(ObjectContents)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<ObjectContents>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const ObjectContents &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_OBJECT_CONTENTS_REPOSITORY_H
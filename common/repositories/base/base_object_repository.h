@@ -213,11 +213,67 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Object &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.zoneid);
+		b.Bind(e.version);
+		b.Bind(e.xpos);
+		b.Bind(e.ypos);
+		b.Bind(e.zpos);
+		b.Bind(e.heading);
+		b.Bind(e.itemid);
+		b.Bind(e.charges);
+		b.Bind(e.objectname);
+		b.Bind(e.type);
+		b.Bind(e.icon);
+		b.Bind(e.unknown08);
+		b.Bind(e.unknown10);
+		b.Bind(e.unknown20);
+		b.Bind(e.unknown24);
+		b.Bind(e.unknown60);
+		b.Bind(e.unknown64);
+		b.Bind(e.unknown68);
+		b.Bind(e.unknown72);
+		b.Bind(e.unknown76);
+		b.Bind(e.unknown84);
+		b.Bind(e.size);
+		b.Bind(e.tilt_x);
+		b.Bind(e.tilt_y);
+		b.Bind(e.display_name);
+		b.Bind(e.min_expansion);
+		b.Bind(e.max_expansion);
+		b.Bind(e.content_flags);
+		b.Bind(e.content_flags_disabled);
+	}
+
 	static Object FindOne(
 		Database& db,
 		int object_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Object e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, object_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -607,6 +663,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int object_id,
+		std::function<void(Object)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Object>();
+
+		db.RunAsync(
+			[e, object_id](Database& c) { *e = FindOne(c, object_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Object>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Object>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Object e,
+		std::function<void(Object)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Object>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Object &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_OBJECT_REPOSITORY_H
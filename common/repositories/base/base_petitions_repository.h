@@ -157,11 +157,53 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Petitions &e)
+	{
+		b.Bind(e.dib);
+		b.Bind(e.petid);
+		b.Bind(e.charname);
+		b.Bind(e.accountname);
+		b.Bind(e.lastgm);
+		b.Bind(e.petitiontext);
+		b.Bind(e.gmtext);
+		b.Bind(e.zone);
+		b.Bind(e.urgency);
+		b.Bind(e.charclass);
+		b.Bind(e.charrace);
+		b.Bind(e.charlevel);
+		b.Bind(e.checkouts);
+		b.Bind(e.unavailables);
+		b.Bind(e.ischeckedout);
+		b.Bind(e.senttime);
+	}
+
 	static Petitions FindOne(
 		Database& db,
 		int petitions_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Petitions e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, petitions_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -467,6 +509,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int petitions_id,
+		std::function<void(Petitions)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Petitions>();
+
+		db.RunAsync(
+			[e, petitions_id](Database& c) { *e = FindOne(c, petitions_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Petitions>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Petitions>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Petitions e,
+		std::function<void(Petitions)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Petitions>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Petitions &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_PETITIONS_REPOSITORY_H
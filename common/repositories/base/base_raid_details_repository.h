@@ -146,11 +146,50 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, RaidDetails &e)
+	{
+		b.Bind(e.raidid);
+		b.Bind(e.loottype);
+		b.Bind(e.locked);
+		b.Bind(e.motd);
+		b.Bind(e.marked_npc_1_entity_id);
+		b.Bind(e.marked_npc_1_zone_id);
+		b.Bind(e.marked_npc_1_instance_id);
+		b.Bind(e.marked_npc_2_entity_id);
+		b.Bind(e.marked_npc_2_zone_id);
+		b.Bind(e.marked_npc_2_instance_id);
+		b.Bind(e.marked_npc_3_entity_id);
+		b.Bind(e.marked_npc_3_zone_id);
+		b.Bind(e.marked_npc_3_instance_id);
+	}
+
 	static RaidDetails FindOne(
 		Database& db,
 		int raid_details_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			RaidDetails e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, raid_details_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -440,6 +479,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int raid_details_id,
+		std::function<void(RaidDetails)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<RaidDetails>();
+
+		db.RunAsync(
+			[e, raid_details_id](Database& c) { *e = FindOne(c, raid_details_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<RaidDetails>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<RaidDetails>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		RaidDetails e,
+		std::function<void(RaidDetails)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<RaidDetails>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const RaidDetails &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_RAID_DETAILS_REPOSITORY_H
@@ -161,11 +161,54 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, ServerScheduledEvents &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.description);
+		b.Bind(e.event_type);
+		b.Bind(e.event_data);
+		b.Bind(e.minute_start);
+		b.Bind(e.hour_start);
+		b.Bind(e.day_start);
+		b.Bind(e.month_start);
+		b.Bind(e.year_start);
+		b.Bind(e.minute_end);
+		b.Bind(e.hour_end);
+		b.Bind(e.day_end);
+		b.Bind(e.month_end);
+		b.Bind(e.year_end);
+		b.Bind(e.cron_expression);
+		b.Bind(e.created_at);
+		b.Bind(e.deleted_at);
+	}
+
 	static ServerScheduledEvents FindOne(
 		Database& db,
 		int server_scheduled_events_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			ServerScheduledEvents e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, server_scheduled_events_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -477,6 +520,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int server_scheduled_events_id,
+		std::function<void(ServerScheduledEvents)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<ServerScheduledEvents>();
+
+		db.RunAsync(
+			[e, server_scheduled_events_id](Database& c) { *e = FindOne(c, server_scheduled_events_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<ServerScheduledEvents>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<ServerScheduledEvents>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		ServerScheduledEvents e,
+		std::function<void(ServerScheduledEvents)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<ServerScheduledEvents>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const ServerScheduledEvents &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_SERVER_SCHEDULED_EVENTS_REPOSITORY_H
@@ -149,11 +149,51 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, SpawnEvents &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.zone);
+		b.Bind(e.cond_id);
+		b.Bind(e.name);
+		b.Bind(e.period);
+		b.Bind(e.next_minute);
+		b.Bind(e.next_hour);
+		b.Bind(e.next_day);
+		b.Bind(e.next_month);
+		b.Bind(e.next_year);
+		b.Bind(e.enabled);
+		b.Bind(e.action);
+		b.Bind(e.argument);
+		b.Bind(e.strict);
+	}
+
 	static SpawnEvents FindOne(
 		Database& db,
 		int spawn_events_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			SpawnEvents e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, spawn_events_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -447,6 +487,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int spawn_events_id,
+		std::function<void(SpawnEvents)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<SpawnEvents>();
+
+		db.RunAsync(
+			[e, spawn_events_id](Database& c) { *e = FindOne(c, spawn_events_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<SpawnEvents>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<SpawnEvents>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		SpawnEvents e,
+		std::function<void(SpawnEvents)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<SpawnEvents>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const SpawnEvents &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_SPAWN_EVENTS_REPOSITORY_H
@@ -145,11 +145,50 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Spawngroup &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.name);
+		b.Bind(e.spawn_limit);
+		b.Bind(e.dist);
+		b.Bind(e.max_x);
+		b.Bind(e.min_x);
+		b.Bind(e.max_y);
+		b.Bind(e.min_y);
+		b.Bind(e.delay);
+		b.Bind(e.mindelay);
+		b.Bind(e.despawn);
+		b.Bind(e.despawn_timer);
+		b.Bind(e.wp_spawns);
+	}
+
 	static Spawngroup FindOne(
 		Database& db,
 		int spawngroup_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Spawngroup e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, spawngroup_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -437,6 +476,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int spawngroup_id,
+		std::function<void(Spawngroup)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Spawngroup>();
+
+		db.RunAsync(
+			[e, spawngroup_id](Database& c) { *e = FindOne(c, spawngroup_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Spawngroup>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Spawngroup>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Spawngroup e,
+		std::function<void(Spawngroup)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Spawngroup>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Spawngroup &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_SPAWNGROUP_REPOSITORY_H
@@ -1041,11 +1041,274 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, SpellsNew &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.name);
+		b.Bind(e.player_1);
+		b.Bind(e.teleport_zone);
+		b.Bind(e.you_cast);
+		b.Bind(e.other_casts);
+		b.Bind(e.cast_on_you);
+		b.Bind(e.cast_on_other);
+		b.Bind(e.spell_fades);
+		b.Bind(e.range);
+		b.Bind(e.aoerange);
+		b.Bind(e.pushback);
+		b.Bind(e.pushup);
+		b.Bind(e.cast_time);
+		b.Bind(e.recovery_time);
+		b.Bind(e.recast_time);
+		b.Bind(e.buffdurationformula);
+		b.Bind(e.buffduration);
+		b.Bind(e.AEDuration);
+		b.Bind(e.mana);
+		b.Bind(e.effect_base_value1);
+		b.Bind(e.effect_base_value2);
+		b.Bind(e.effect_base_value3);
+		b.Bind(e.effect_base_value4);
+		b.Bind(e.effect_base_value5);
+		b.Bind(e.effect_base_value6);
+		b.Bind(e.effect_base_value7);
+		b.Bind(e.effect_base_value8);
+		b.Bind(e.effect_base_value9);
+		b.Bind(e.effect_base_value10);
+		b.Bind(e.effect_base_value11);
+		b.Bind(e.effect_base_value12);
+		b.Bind(e.effect_limit_value1);
+		b.Bind(e.effect_limit_value2);
+		b.Bind(e.effect_limit_value3);
+		b.Bind(e.effect_limit_value4);
+		b.Bind(e.effect_limit_value5);
+		b.Bind(e.effect_limit_value6);
+		b.Bind(e.effect_limit_value7);
+		b.Bind(e.effect_limit_value8);
+		b.Bind(e.effect_limit_value9);
+		b.Bind(e.effect_limit_value10);
+		b.Bind(e.effect_limit_value11);
+		b.Bind(e.effect_limit_value12);
+		b.Bind(e.max1);
+		b.Bind(e.max2);
+		b.Bind(e.max3);
+		b.Bind(e.max4);
+		b.Bind(e.max5);
+		b.Bind(e.max6);
+		b.Bind(e.max7);
+		b.Bind(e.max8);
+		b.Bind(e.max9);
+		b.Bind(e.max10);
+		b.Bind(e.max11);
+		b.Bind(e.max12);
+		b.Bind(e.icon);
+		b.Bind(e.memicon);
+		b.Bind(e.components1);
+		b.Bind(e.components2);
+		b.Bind(e.components3);
+		b.Bind(e.components4);
+		b.Bind(e.component_counts1);
+		b.Bind(e.component_counts2);
+		b.Bind(e.component_counts3);
+		b.Bind(e.component_counts4);
+		b.Bind(e.NoexpendReagent1);
+		b.Bind(e.NoexpendReagent2);
+		b.Bind(e.NoexpendReagent3);
+		b.Bind(e.NoexpendReagent4);
+		b.Bind(e.formula1);
+		b.Bind(e.formula2);
+		b.Bind(e.formula3);
+		b.Bind(e.formula4);
+		b.Bind(e.formula5);
+		b.Bind(e.formula6);
+		b.Bind(e.formula7);
+		b.Bind(e.formula8);
+		b.Bind(e.formula9);
+		b.Bind(e.formula10);
+		b.Bind(e.formula11);
+		b.Bind(e.formula12);
+		b.Bind(e.LightType);
+		b.Bind(e.goodEffect);
+		b.Bind(e.Activated);
+		b.Bind(e.resisttype);
+		b.Bind(e.effectid1);
+		b.Bind(e.effectid2);
+		b.Bind(e.effectid3);
+		b.Bind(e.effectid4);
+		b.Bind(e.effectid5);
+		b.Bind(e.effectid6);
+		b.Bind(e.effectid7);
+		b.Bind(e.effectid8);
+		b.Bind(e.effectid9);
+		b.Bind(e.effectid10);
+		b.Bind(e.effectid11);
+		b.Bind(e.effectid12);
+		b.Bind(e.targettype);
+		b.Bind(e.basediff);
+		b.Bind(e.skill);
+		b.Bind(e.zonetype);
+		b.Bind(e.EnvironmentType);
+		b.Bind(e.TimeOfDay);
+		b.Bind(e.classes1);
+		b.Bind(e.classes2);
+		b.Bind(e.classes3);
+		b.Bind(e.classes4);
+		b.Bind(e.classes5);
+		b.Bind(e.classes6);
+		b.Bind(e.classes7);
+		b.Bind(e.classes8);
+		b.Bind(e.classes9);
+		b.Bind(e.classes10);
+		b.Bind(e.classes11);
+		b.Bind(e.classes12);
+		b.Bind(e.classes13);
+		b.Bind(e.classes14);
+		b.Bind(e.classes15);
+		b.Bind(e.classes16);
+		b.Bind(e.CastingAnim);
+		b.Bind(e.TargetAnim);
+		b.Bind(e.TravelType);
+		b.Bind(e.SpellAffectIndex);
+		b.Bind(e.disallow_sit);
+		b.Bind(e.deities0);
+		b.Bind(e.deities1);
+		b.Bind(e.deities2);
+		b.Bind(e.deities3);
+		b.Bind(e.deities4);
+		b.Bind(e.deities5);
+		b.Bind(e.deities6);
+		b.Bind(e.deities7);
+		b.Bind(e.deities8);
+		b.Bind(e.deities9);
+		b.Bind(e.deities10);
+		b.Bind(e.deities11);
+		b.Bind(e.deities12);
+		b.Bind(e.deities13);
+		b.Bind(e.deities14);
+		b.Bind(e.deities15);
+		b.Bind(e.deities16);
+		b.Bind(e.field142);
+		b.Bind(e.field143);
+		b.Bind(e.new_icon);
+		b.Bind(e.spellanim);
+		b.Bind(e.uninterruptable);
+		b.Bind(e.ResistDiff);
+		b.Bind(e.dot_stacking_exempt);
+		b.Bind(e.deleteable);
+		b.Bind(e.RecourseLink);
+		b.Bind(e.no_partial_resist);
+		b.Bind(e.field152);
+		b.Bind(e.field153);
+		b.Bind(e.short_buff_box);
+		b.Bind(e.descnum);
+		b.Bind(e.typedescnum);
+		b.Bind(e.effectdescnum);
+		b.Bind(e.effectdescnum2);
+		b.Bind(e.npc_no_los);
+		b.Bind(e.field160);
+		b.Bind(e.reflectable);
+		b.Bind(e.bonushate);
+		b.Bind(e.field163);
+		b.Bind(e.field164);
+		b.Bind(e.ldon_trap);
+		b.Bind(e.EndurCost);
+		b.Bind(e.EndurTimerIndex);
+		b.Bind(e.IsDiscipline);
+		b.Bind(e.field169);
+		b.Bind(e.field170);
+		b.Bind(e.field171);
+		b.Bind(e.field172);
+		b.Bind(e.HateAdded);
+		b.Bind(e.EndurUpkeep);
+		b.Bind(e.numhitstype);
+		b.Bind(e.numhits);
+		b.Bind(e.pvpresistbase);
+		b.Bind(e.pvpresistcalc);
+		b.Bind(e.pvpresistcap);
+		b.Bind(e.spell_category);
+		b.Bind(e.pvp_duration);
+		b.Bind(e.pvp_duration_cap);
+		b.Bind(e.pcnpc_only_flag);
+		b.Bind(e.cast_not_standing);
+		b.Bind(e.can_mgb);
+		b.Bind(e.nodispell);
+		b.Bind(e.npc_category);
+		b.Bind(e.npc_usefulness);
+		b.Bind(e.MinResist);
+		b.Bind(e.MaxResist);
+		b.Bind(e.viral_targets);
+		b.Bind(e.viral_timer);
+		b.Bind(e.nimbuseffect);
+		b.Bind(e.ConeStartAngle);
+		b.Bind(e.ConeStopAngle);
+		b.Bind(e.sneaking);
+		b.Bind(e.not_extendable);
+		b.Bind(e.field198);
+		b.Bind(e.field199);
+		b.Bind(e.suspendable);
+		b.Bind(e.viral_range);
+		b.Bind(e.songcap);
+		b.Bind(e.field203);
+		b.Bind(e.field204);
+		b.Bind(e.no_block);
+		b.Bind(e.field206);
+		b.Bind(e.spellgroup);
+		b.Bind(e.rank);
+		b.Bind(e.field209);
+		b.Bind(e.field210);
+		b.Bind(e.CastRestriction);
+		b.Bind(e.allowrest);
+		b.Bind(e.InCombat);
+		b.Bind(e.OutofCombat);
+		b.Bind(e.field215);
+		b.Bind(e.field216);
+		b.Bind(e.field217);
+		b.Bind(e.aemaxtargets);
+		b.Bind(e.maxtargets);
+		b.Bind(e.field220);
+		b.Bind(e.field221);
+		b.Bind(e.field222);
+		b.Bind(e.field223);
+		b.Bind(e.persistdeath);
+		b.Bind(e.field225);
+		b.Bind(e.field226);
+		b.Bind(e.min_dist);
+		b.Bind(e.min_dist_mod);
+		b.Bind(e.max_dist);
+		b.Bind(e.max_dist_mod);
+		b.Bind(e.min_range);
+		b.Bind(e.field232);
+		b.Bind(e.field233);
+		b.Bind(e.field234);
+		b.Bind(e.field235);
+		b.Bind(e.field236);
+	}
+
 	static SpellsNew FindOne(
 		Database& db,
 		int spells_new_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			SpellsNew e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, spells_new_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -2678,6 +2941,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int spells_new_id,
+		std::function<void(SpellsNew)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<SpellsNew>();
+
+		db.RunAsync(
+			[e, spells_new_id](Database& c) { *e = FindOne(c, spells_new_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<SpellsNew>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<SpellsNew>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		SpellsNew e,
+		std::function<void(SpellsNew)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<SpellsNew>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const SpellsNew &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_SPELLS_NEW_REPOSITORY_H
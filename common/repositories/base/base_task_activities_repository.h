@@ -189,11 +189,61 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, TaskActivities &e)
+	{
+		b.Bind(e.taskid);
+		b.Bind(e.activityid);
+		b.Bind(e.req_activity_id);
+		b.Bind(e.step);
+		b.Bind(e.activitytype);
+		b.Bind(e.target_name);
+		b.Bind(e.goalmethod);
+		b.Bind(e.goalcount);
+		b.Bind(e.description_override);
+		b.Bind(e.npc_match_list);
+		b.Bind(e.item_id_list);
+		b.Bind(e.item_list);
+		b.Bind(e.dz_switch_id);
+		b.Bind(e.min_x);
+		b.Bind(e.min_y);
+		b.Bind(e.min_z);
+		b.Bind(e.max_x);
+		b.Bind(e.max_y);
+		b.Bind(e.max_z);
+		b.Bind(e.skill_list);
+		b.Bind(e.spell_list);
+		b.Bind(e.zones);
+		b.Bind(e.zone_version);
+		b.Bind(e.optional);
+	}
+
 	static TaskActivities FindOne(
 		Database& db,
 		int task_activities_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			TaskActivities e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, task_activities_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -548,6 +598,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int task_activities_id,
+		std::function<void(TaskActivities)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<TaskActivities>();
+
+		db.RunAsync(
+			[e, task_activities_id](Database& c) { *e = FindOne(c, task_activities_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<TaskActivities>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<TaskActivities>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		TaskActivities e,
+		std::function<void(TaskActivities)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<TaskActivities>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const TaskActivities &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_TASK_ACTIVITIES_REPOSITORY_H
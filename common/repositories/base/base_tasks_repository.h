@@ -205,11 +205,65 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Tasks &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.type);
+		b.Bind(e.duration);
+		b.Bind(e.duration_code);
+		b.Bind(e.title);
+		b.Bind(e.description);
+		b.Bind(e.reward_text);
+		b.Bind(e.reward_id_list);
+		b.Bind(e.cash_reward);
+		b.Bind(e.exp_reward);
+		b.Bind(e.reward_method);
+		b.Bind(e.reward_points);
+		b.Bind(e.reward_point_type);
+		b.Bind(e.min_level);
+		b.Bind(e.max_level);
+		b.Bind(e.level_spread);
+		b.Bind(e.min_players);
+		b.Bind(e.max_players);
+		b.Bind(e.repeatable);
+		b.Bind(e.faction_reward);
+		b.Bind(e.completion_emote);
+		b.Bind(e.replay_timer_group);
+		b.Bind(e.replay_timer_seconds);
+		b.Bind(e.request_timer_group);
+		b.Bind(e.request_timer_seconds);
+		b.Bind(e.dz_template_id);
+		b.Bind(e.lock_activity_id);
+		b.Bind(e.faction_amount);
+	}
+
 	static Tasks FindOne(
 		Database& db,
 		int tasks_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Tasks e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, tasks_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -588,6 +642,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int tasks_id,
+		std::function<void(Tasks)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Tasks>();
+
+		db.RunAsync(
+			[e, tasks_id](Database& c) { *e = FindOne(c, tasks_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Tasks>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Tasks>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Tasks e,
+		std::function<void(Tasks)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Tasks>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Tasks &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_TASKS_REPOSITORY_H
@@ -153,11 +153,52 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, TradeskillRecipe &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.name);
+		b.Bind(e.tradeskill);
+		b.Bind(e.skillneeded);
+		b.Bind(e.trivial);
+		b.Bind(e.nofail);
+		b.Bind(e.replace_container);
+		b.Bind(e.notes);
+		b.Bind(e.must_learn);
+		b.Bind(e.quest);
+		b.Bind(e.enabled);
+		b.Bind(e.min_expansion);
+		b.Bind(e.max_expansion);
+		b.Bind(e.content_flags);
+		b.Bind(e.content_flags_disabled);
+	}
+
 	static TradeskillRecipe FindOne(
 		Database& db,
 		int tradeskill_recipe_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			TradeskillRecipe e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, tradeskill_recipe_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -457,6 +498,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int tradeskill_recipe_id,
+		std::function<void(TradeskillRecipe)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<TradeskillRecipe>();
+
+		db.RunAsync(
+			[e, tradeskill_recipe_id](Database& c) { *e = FindOne(c, tradeskill_recipe_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<TradeskillRecipe>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<TradeskillRecipe>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		TradeskillRecipe e,
+		std::function<void(TradeskillRecipe)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<TradeskillRecipe>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const TradeskillRecipe &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_TRADESKILL_RECIPE_REPOSITORY_H
@@ -189,11 +189,61 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, ZonePoints &e)
+	{
+		b.Bind(e.id);
+		b.Bind(e.zone);
+		b.Bind(e.version);
+		b.Bind(e.number);
+		b.Bind(e.y);
+		b.Bind(e.x);
+		b.Bind(e.z);
+		b.Bind(e.heading);
+		b.Bind(e.target_y);
+		b.Bind(e.target_x);
+		b.Bind(e.target_z);
+		b.Bind(e.target_heading);
+		b.Bind(e.zoneinst);
+		b.Bind(e.target_zone_id);
+		b.Bind(e.target_instance);
+		b.Bind(e.buffer);
+		b.Bind(e.client_version_mask);
+		b.Bind(e.min_expansion);
+		b.Bind(e.max_expansion);
+		b.Bind(e.content_flags);
+		b.Bind(e.content_flags_disabled);
+		b.Bind(e.is_virtual);
+		b.Bind(e.height);
+		b.Bind(e.width);
+	}
+
 	static ZonePoints FindOne(
 		Database& db,
 		int zone_points_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			ZonePoints e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, zone_points_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE id = {} LIMIT 1",
@@ -547,6 +597,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int zone_points_id,
+		std::function<void(ZonePoints)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<ZonePoints>();
+
+		db.RunAsync(
+			[e, zone_points_id](Database& c) { *e = FindOne(c, zone_points_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<ZonePoints>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<ZonePoints>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		ZonePoints e,
+		std::function<void(ZonePoints)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<ZonePoints>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const ZonePoints &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_ZONE_POINTS_REPOSITORY_H
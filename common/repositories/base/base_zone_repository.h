@@ -478,11 +478,133 @@ public:
 		return NewEntity();
 	}
 
+	template<class Binder>
+	static void BindColumns(Binder &b, Zone &e)
+	{
+		b.Bind(e.short_name);
+		b.Bind(e.id);
+		b.Bind(e.file_name);
+		b.Bind(e.long_name);
+		b.Bind(e.map_file_name);
+		b.Bind(e.safe_x);
+		b.Bind(e.safe_y);
+		b.Bind(e.safe_z);
+		b.Bind(e.safe_heading);
+		b.Bind(e.graveyard_id);
+		b.Bind(e.min_level);
+		b.Bind(e.max_level);
+		b.Bind(e.min_status);
+		b.Bind(e.zoneidnumber);
+		b.Bind(e.version);
+		b.Bind(e.timezone);
+		b.Bind(e.maxclients);
+		b.Bind(e.ruleset);
+		b.Bind(e.note);
+		b.Bind(e.underworld);
+		b.Bind(e.minclip);
+		b.Bind(e.maxclip);
+		b.Bind(e.fog_minclip);
+		b.Bind(e.fog_maxclip);
+		b.Bind(e.fog_blue);
+		b.Bind(e.fog_red);
+		b.Bind(e.fog_green);
+		b.Bind(e.sky);
+		b.Bind(e.ztype);
+		b.Bind(e.zone_exp_multiplier);
+		b.Bind(e.walkspeed);
+		b.Bind(e.time_type);
+		b.Bind(e.fog_red1);
+		b.Bind(e.fog_green1);
+		b.Bind(e.fog_blue1);
+		b.Bind(e.fog_minclip1);
+		b.Bind(e.fog_maxclip1);
+		b.Bind(e.fog_red2);
+		b.Bind(e.fog_green2);
+		b.Bind(e.fog_blue2);
+		b.Bind(e.fog_minclip2);
+		b.Bind(e.fog_maxclip2);
+		b.Bind(e.fog_red3);
+		b.Bind(e.fog_green3);
+		b.Bind(e.fog_blue3);
+		b.Bind(e.fog_minclip3);
+		b.Bind(e.fog_maxclip3);
+		b.Bind(e.fog_red4);
+		b.Bind(e.fog_green4);
+		b.Bind(e.fog_blue4);
+		b.Bind(e.fog_minclip4);
+		b.Bind(e.fog_maxclip4);
+		b.Bind(e.fog_density);
+		b.Bind(e.flag_needed);
+		b.Bind(e.canbind);
+		b.Bind(e.cancombat);
+		b.Bind(e.canlevitate);
+		b.Bind(e.castoutdoor);
+		b.Bind(e.hotzone);
+		b.Bind(e.insttype);
+		b.Bind(e.shutdowndelay);
+		b.Bind(e.peqzone);
+		b.Bind(e.expansion);
+		b.Bind(e.bypass_expansion_check);
+		b.Bind(e.suspendbuffs);
+		b.Bind(e.rain_chance1);
+		b.Bind(e.rain_chance2);
+		b.Bind(e.rain_chance3);
+		b.Bind(e.rain_chance4);
+		b.Bind(e.rain_duration1);
+		b.Bind(e.rain_duration2);
+		b.Bind(e.rain_duration3);
+		b.Bind(e.rain_duration4);
+		b.Bind(e.snow_chance1);
+		b.Bind(e.snow_chance2);
+		b.Bind(e.snow_chance3);
+		b.Bind(e.snow_chance4);
+		b.Bind(e.snow_duration1);
+		b.Bind(e.snow_duration2);
+		b.Bind(e.snow_duration3);
+		b.Bind(e.snow_duration4);
+		b.Bind(e.gravity);
+		b.Bind(e.type);
+		b.Bind(e.skylock);
+		b.Bind(e.fast_regen_hp);
+		b.Bind(e.fast_regen_mana);
+		b.Bind(e.fast_regen_endurance);
+		b.Bind(e.npc_max_aggro_dist);
+		b.Bind(e.max_movement_update_range);
+		b.Bind(e.min_expansion);
+		b.Bind(e.max_expansion);
+		b.Bind(e.content_flags);
+		b.Bind(e.content_flags_disabled);
+		b.Bind(e.underworld_teleport_index);
+		b.Bind(e.lava_damage);
+		b.Bind(e.min_lava_damage);
+	}
+
 	static Zone FindOne(
 		Database& db,
 		int zone_id
 	)
 	{
+		if (db.IsPreparedStatementsEnabled()) {
+			static const std::string query = fmt::format(
+				"{} WHERE {} = ? LIMIT 1",
+				BaseSelect(),
+				PrimaryKey()
+			);
+
+			Zone e{};
+
+			MySQLStmtBinder b;
+			BindColumns(b, e);
+
+			const int status = db.QueryPreparedRow(query, zone_id, b);
+			if (status > 0) {
+				return e;
+			}
+			else if (status == 0) {
+				return NewEntity();
+			}
+		}
+
 		auto results = db.QueryDatabase(
 			fmt::format(
 				"{} WHERE {} = {} LIMIT 1",
@@ -1269,6 +1391,70 @@ public:
 		return (results.Success() && results.begin()[0] ? strtoll(results.begin()[0], nullptr, 10) : 0);
 	}
 
+	static void FindOneAsync(
+		Database& db,
+		int zone_id,
+		std::function<void(Zone)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto e = std::make_shared<Zone>();
+
+		db.RunAsync(
+			[e, zone_id](Database& c) { *e = FindOne(c, zone_id); },
+			[e, callback]() { if (callback) { callback(*e); } },
+			ordering_key
+		);
+	}
+
+	static void GetWhereAsync(
+		Database& db,
+		const std::string &where_filter,
+		std::function<void(std::vector<Zone>)> callback,
+		uint64 ordering_key = 0
+	)
+	{
+		auto entries = std::make_shared<std::vector<Zone>>();
+
+		db.RunAsync(
+			[entries, where_filter](Database& c) { *entries = GetWhere(c, where_filter); },
+			[entries, callback]() { if (callback) { callback(std::move(*entries)); } },
+			ordering_key
+		);
+	}
+
+	static void InsertOneAsync(
+		Database& db,
+		Zone e,
+		std::function<void(Zone)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto r = std::make_shared<Zone>(std::move(e));
+
+		db.RunAsync(
+			[r](Database& c) { *r = InsertOne(c, *r); },
+			[r, callback]() { if (callback) { callback(*r); } },
+			ordering_key
+		);
+	}
+
+	static void UpdateOneAsync(
+		Database& db,
+		const Zone &e,
+		std::function<void(int)> callback = nullptr,
+		uint64 ordering_key = 0
+	)
+	{
+		auto rows_affected = std::make_shared<int>(0);
+
+		db.RunAsync(
+			[e, rows_affected](Database& c) { *rows_affected = UpdateOne(c, e); },
+			[rows_affected, callback]() { if (callback) { callback(*rows_affected); } },
+			ordering_key
+		);
+	}
+
 };
 
 #endif //EQEMU_BASE_ZONE_REPOSITORY_H
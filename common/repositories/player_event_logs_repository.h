@@ -45,6 +45,68 @@ public:
 
 	// Custom extended repository methods here
 
+	// multi row inserts split so each statement stays near max_query_bytes, keeps large batches under max_allowed_packet
+	static int InsertManyByBytes(
+		Database &db,
+		const std::vector<PlayerEventLogs> &entries,
+		size_t max_query_bytes
+	)
+	{
+		const std::string insert = BaseInsert() + "VALUES ";
+
+		int         rows_affected = 0;
+		std::string query;
+		query.reserve(std::min(max_query_bytes, entries.size() * 256) + insert.size());
+
+		auto flush = [&]() {
+			if (query.empty()) {
+				return;
+			}
+
+			auto results = db.QueryDatabase(query);
+			if (results.Success()) {
+				rows_affected += results.RowsAffected();
+			}
+
+			query.clear();
+		};
+
+		for (auto &e: entries) {
+			auto row = fmt::format(
+				"({},{},{},{},{},{},{},{},{},{},'{}','{}',FROM_UNIXTIME({}))",
+				e.id,
+				e.account_id,
+				e.character_id,
+				e.zone_id,
+				e.instance_id,
+				std::to_string(e.x),
+				std::to_string(e.y),
+				std::to_string(e.z),
+				std::to_string(e.heading),
+				e.event_type_id,
+				db.Escape(e.event_type_name),
+				db.Escape(e.event_data),
+				(e.created_at > 0 ? std::to_string(e.created_at) : "null")
+			);
+
+			if (!query.empty() && query.size() + row.size() + 1 > max_query_bytes) {
+				flush();
+			}
+
+			if (query.empty()) {
+				query += insert;
+			}
+			else {
+				query += ',';
+			}
+
+			query += row;
+		}
+
+		flush();
+
+		return rows_affected;
+	}
 };
 
 #endif //EQEMU_PLAYER_EVENT_LOGS_REPOSITORY_H
@@ -215,6 +215,8 @@ RULE_BOOL(Character, EnableRaidEXPModifier, true, "Enable or disable the raid ex
 RULE_BOOL(Character, EnableRaidMemberEXPModifier, true, "Enable or disable the raid experience modifier based on members in raid, default is true")
 RULE_BOOL(Character, LeaveCursorMoneyOnCorpse, false, "Enable or disable leaving cursor money on player corpses")
 RULE_BOOL(Character, ItemExtraSkillDamageCalcAsPercent, false, "If enabled, apply Item Extra Skill Damage as Percentage-based modifiers")
+RULE_INT(Character, SaveBatchIntervalMS, 0, "Time character skill, language, currency, bandolier and potion belt saves are buffered before being written as multi-row statements (milliseconds, 0 writes immediately)")
+RULE_INT(Character, SaveBatchMaxRows, 1000, "Buffered character save rows that force an early batch flush (0 for no limit)")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Mercs)
@@ -303,6 +305,7 @@ RULE_BOOL(World, EnforceCharacterLimitAtLogin, false, "Enforce the limit for cha
 RULE_BOOL(World, EnableDevTools, true, "Enable or Disable the Developer Tools globally (Most of the time you want this enabled)")
 RULE_BOOL(World, EnableChecksumVerification, false, "Enable or Disable the Checksum Verification for eqgame.exe and spells_us.txt")
 RULE_INT(World, MaximumQuestErrors, 30, "Changes the maximum number of quest errors that can be displayed in #questerrors, default is 30")
+RULE_INT(World, CharacterSelectCacheSeconds, 300, "Seconds a built character select packet is reused for an account when nothing has reported a change. 0 disables the cache")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Zone)
@@ -329,6 +332,10 @@ RULE_BOOL(Zone, KillProcessOnDynamicShutdown, true, "When process has booted a z
 RULE_INT(Zone, SecondsBeforeIdle, 60, "Seconds before IDLE_WHEN_EMPTY define kicks in")
 RULE_INT(Zone, SpawnEventMin, 3, "When strict is set in spawn_events, specifies the max EQ minutes into the trigger hour a spawn_event will fire. Going below 3 may cause the spawn_event to not fire.")
 RULE_INT(Zone, ForageChance, 25, "Chance of foraging from zone table vs global table")
+RULE_BOOL(Zone, EnableTickProfiler, true, "Times each section of the zone main loop and every quest event dispatch, exposed through #profile and the get_zone_profile API call")
+RULE_INT(Zone, TickProfilerOverrunMS, 32, "A zone tick taking longer than this keeps a snapshot of its section breakdown for #profile overruns (milliseconds, 0 to disable snapshots)")
+RULE_INT(Zone, AIThinkThreads, 0, "Worker threads used to precompute NPC target selection and NPC to NPC aggro candidates before the serial mob process each tick (0 to disable)")
+RULE_INT(Zone, AIThinkMinNPCs, 32, "Minimum number of eligible NPCs before the parallel AI think phase runs, below this everything stays serial")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Map)
@@ -338,6 +345,9 @@ RULE_BOOL(Map, MobZVisualDebug, false, "Displays spell effects determining wheth
 RULE_BOOL(Map, MobPathingVisualDebug, false, "Displays nodes in pathing points in realtime to help with visual debugging")
 RULE_REAL(Map, FixPathingZMaxDeltaSendTo, 20, "At runtime in SendTo: maximum change in Z to allow the BestZ code to apply")
 RULE_INT(Map, FindBestZHeightAdjust, 1, "Adds this to the current Z before seeking the best Z position")
+RULE_BOOL(Map, UseHeightField, false, "Answer best Z lookups from the zone's precomputed height field (maps/base/<zone>.hfield, built with 'zone build_height_field <zone>') before raycasting")
+RULE_INT(Map, LoSCacheSize, 0, "Number of line of sight results kept per zone between quantized positions, an approximation since nearby positions share a result (0 to disable)")
+RULE_REAL(Map, LoSCacheCellSize, 1.0, "Positions are snapped to cubes of this size before looking up cached line of sight results")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Pathing)
@@ -345,7 +355,11 @@ RULE_BOOL(Pathing, Find, true, "Enable pathing for FindPerson requests from the
 RULE_BOOL(Pathing, Fear, true, "Enable pathing for fear")
 RULE_REAL(Pathing, NavmeshStepSize, 100.0f, "Step size for the movement manager")
 RULE_REAL(Pathing, ShortMovementUpdateRange, 130.0f, "Range for short movement updates")
+RULE_INT(Pathing, MediumRangeMovementUpdateInterval, 250, "Minimum milliseconds between movement updates for one npc to a client past short movement update range, newer updates wait and replace older ones (0 sends every update)")
+RULE_INT(Pathing, LongRangeMovementUpdateInterval, 1000, "Minimum milliseconds between movement updates for one npc to a client past the npc position update distance (0 sends every update)")
 RULE_INT(Pathing, MaxNavmeshNodes, 4092, "Maximum navmesh nodes in a traversable path")
+RULE_INT(Pathing, PathCacheSize, 2048, "Navmesh polygon corridors kept per zone keyed by start and end polygon, reused by npcs pathing between the same polygons (0 to disable)")
+RULE_INT(Pathing, PathWorkerThreads, 0, "Worker threads used to solve the movement manager's queued ground paths each tick (0 solves them on the zone thread)")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Watermap)
@@ -743,6 +757,9 @@ RULE_INT(Network, ResendDelayMinMS, 300, "Minimum timespan between two send retr
 RULE_INT(Network, ResendDelayMaxMS, 5000, "Maximum timespan between two send retries (milliseconds)")
 RULE_REAL(Network, ClientDataRate, 0.0, "KB / sec, 0.0 disabled")
 RULE_BOOL(Network, CompressZoneStream, true, "Setting whether the zone stream should be compressed for transmission")
+RULE_INT(Network, CompressMinSize, 30, "Zone stream packets this many bytes or smaller are sent without trying to compress them")
+RULE_BOOL(Network, BatchedUDP, false, "Linux only, drain client sockets with recvmmsg and flush outgoing datagrams with sendmmsg instead of one syscall per packet")
+RULE_INT(Network, BatchedUDPSize, 64, "Datagrams per recvmmsg / sendmmsg call when Network:BatchedUDP is enabled (1 to 1024)")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(QueryServ)
@@ -808,6 +825,7 @@ RULE_BOOL(Logging, WorldGMSayLogging, true, "Relay worldserver logging to zone p
 RULE_BOOL(Logging, PlayerEventsQSProcess, false, "Have query server process player events instead of world. Useful when wanting to use a dedicated server and database for processing player events on separate disk")
 RULE_INT(Logging, BatchPlayerEventProcessIntervalSeconds, 5, "This is the interval in which player events are processed in world or qs")
 RULE_INT(Logging, BatchPlayerEventProcessChunkSize, 10000, "This is the cap of events that can be inserted into the queue before a force flush. This is to keep from hitting MySQL max_allowed_packet and killing the connection")
+RULE_INT(Logging, BatchPlayerEventInsertBytes, 1048576, "Approximate size in bytes of each multi row insert statement used to write a batch of player events, keep below MySQL max_allowed_packet")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(HotReload)
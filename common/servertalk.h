@@ -92,6 +92,7 @@
 #define ServerOP_WebInterfaceEvent  0x0066
 #define ServerOP_WebInterfaceSubscribe 0x0067
 #define ServerOP_WebInterfaceUnsubscribe 0x0068
+#define ServerOP_CharacterSaved		0x0069	// ServerCharacterSaved_Struct, drops world's cached character select for the account
 
 #define ServerOP_RaidAdd			0x0100 //in use
 #define ServerOP_RaidRemove			0x0101 //in use
@@ -1647,6 +1648,11 @@ struct ServerRequestTellQueue_Struct {
 	char name[64];
 };
 
+struct ServerCharacterSaved_Struct {
+	uint32 account_id;
+	uint32 character_id;
+};
+
 struct UCSServerStatus_Struct {
 	uint8 available; // non-zero=true, 0=false
 	union {
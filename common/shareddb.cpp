@@ -2099,6 +2099,8 @@ void SharedDatabase::LoadSpells(void *data, int max_spells) {
 		sp[tempid].min_range = Strings::ToFloat(row[231]);
 		sp[tempid].no_remove = Strings::ToBool(row[232]);
 		sp[tempid].damage_shield_type = 0;
+
+		BuildSpellEffectIndex(sp[tempid]);
     }
 
     LoadDamageShieldTypes(sp, max_spells);
@@ -2356,6 +2358,34 @@ void SharedDatabase::LoadLootTables(void *data, uint32 size) {
 
 }
 
+// compiles the roll table used by ZoneDatabase::AddLootDropToNPC so picking a drop is a binary search
+static void CompileLootDrop(LootDrop_Struct *loot_drop)
+{
+	float total_chance   = 0.0f;
+	float no_loot_chance = 1.0f;
+
+	for (uint32 i = 0; i < loot_drop->NumEntries; ++i) {
+		auto &e = loot_drop->Entries[i];
+
+		total_chance += e.chance;
+		e.cumulative_chance = total_chance;
+
+		if (e.chance >= 100) {
+			loot_drop->roll_bypass = 1;
+		}
+		else {
+			no_loot_chance *= (100 - e.chance) / 100.0f;
+		}
+
+		if (e.npc_min_level > 0 || e.npc_max_level > 0) {
+			loot_drop->level_limited = 1;
+		}
+	}
+
+	loot_drop->total_chance   = total_chance;
+	loot_drop->no_loot_chance = no_loot_chance;
+}
+
 void SharedDatabase::LoadLootDrops(void *data, uint32 size) {
 
 	EQ::FixedMemoryVariableHashSet<LootDrop_Struct> hash(static_cast<uint8*>(data), size);
@@ -2382,6 +2412,7 @@ void SharedDatabase::LoadLootDrops(void *data, uint32 size) {
 			FROM
 			  lootdrop
 			  JOIN lootdrop_entries ON lootdrop.id = lootdrop_entries.lootdrop_id
+			  JOIN items ON items.id = lootdrop_entries.item_id
 			WHERE
 			  TRUE {}
 			ORDER BY
@@ -2402,6 +2433,7 @@ void SharedDatabase::LoadLootDrops(void *data, uint32 size) {
 		const auto id = Strings::ToUnsignedInt(row[0]);
 		if (id != current_id) {
 			if (current_id != 0) {
+				CompileLootDrop(p_loot_drop_struct);
 				hash.insert(
 					current_id,
 					loot_drop,
@@ -2437,8 +2469,10 @@ void SharedDatabase::LoadLootDrops(void *data, uint32 size) {
 		++current_entry;
 	}
 
-	if(current_id != 0)
-        hash.insert(current_id, loot_drop, (sizeof(LootDrop_Struct) + (sizeof(LootDropEntries_Struct) * p_loot_drop_struct->NumEntries)));
+	if(current_id != 0) {
+		CompileLootDrop(p_loot_drop_struct);
+		hash.insert(current_id, loot_drop, (sizeof(LootDrop_Struct) + (sizeof(LootDropEntries_Struct) * p_loot_drop_struct->NumEntries)));
+	}
 
 }
 
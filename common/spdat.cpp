@@ -84,6 +84,168 @@
 #include "unix.h"
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// spell record classification
+//
+// These work from the record alone, they run while shared_memory builds the table and spells
+// does not point at it yet. The Is*Spell functions below read the flags they produce.
+
+static bool IsBlankSpellEffect(const SPDat_Spell_Struct &spell, int effect_index)
+{
+	const auto effect     = spell.effect_id[effect_index];
+	const auto base_value = spell.base_value[effect_index];
+	const auto formula    = spell.formula[effect_index];
+
+	// SE_CHA is "spacer"
+	// SE_Stacking* are also considered blank where this is used
+	if (
+		effect == SE_Blank ||
+		(
+			effect == SE_CHA &&
+			base_value == 0 &&
+			formula == 100
+		) ||
+		effect == SE_StackingCommand_Block ||
+		effect == SE_StackingCommand_Overwrite
+	) {
+		return true;
+	}
+
+	return false;
+}
+
+static bool IsSummonSpell(const SPDat_Spell_Struct &spell)
+{
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		const auto effect_id = spell.effect_id[i];
+		if (
+			effect_id == SE_SummonPet ||
+			effect_id == SE_SummonItem ||
+			effect_id == SE_SummonPC
+		) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool IsDamageSpell(const SPDat_Spell_Struct &spell)
+{
+	// lifetaps are not damage spells, see IsLifetapSpell
+	if (
+		spell.target_type == ST_Tap ||
+		spell.target_type == ST_TargetAETap ||
+		spell.id == SPELL_ANCIENT_LIFEBANE
+	) {
+		return false;
+	}
+
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		const auto effect_id = spell.effect_id[i];
+		if (
+			spell.base_value[i] < 0 &&
+			(
+				effect_id == SE_CurrentHPOnce ||
+				(
+					effect_id == SE_CurrentHP &&
+					spell.buff_duration < 1
+				)
+			)
+		) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool IsSlowSpell(const SPDat_Spell_Struct &spell)
+{
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		const auto effect_id = spell.effect_id[i];
+		if (
+			effect_id == SE_AttackSpeed4 ||
+			(
+				effect_id == SE_AttackSpeed &&
+				spell.base_value[i] < 100
+			)
+		) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool IsHasteSpell(const SPDat_Spell_Struct &spell)
+{
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		if (spell.effect_id[i] == SE_AttackSpeed) {
+			return (spell.base_value[i] < 100);
+		}
+	}
+
+	return false;
+}
+
+static bool IsPureNukeSpell(const SPDat_Spell_Struct &spell)
+{
+	auto effect_count   = 0;
+	auto has_current_hp = false;
+
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		if (!IsBlankSpellEffect(spell, i)) {
+			effect_count++;
+		}
+
+		if (spell.effect_id[i] == SE_CurrentHP) {
+			has_current_hp = true;
+		}
+	}
+
+	return (
+		effect_count == 1 &&
+		has_current_hp &&
+		spell.buff_duration == 0 &&
+		IsDamageSpell(spell)
+	);
+}
+
+void BuildSpellEffectIndex(SPDat_Spell_Struct &spell)
+{
+	memset(spell.effect_mask, 0, sizeof(spell.effect_mask));
+
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		const auto effect_id = spell.effect_id[i];
+		if (effect_id >= 0 && effect_id <= HIGHEST_SPELL_EFFECT) {
+			spell.effect_mask[effect_id / 64] |= (uint64(1) << (effect_id % 64));
+		}
+	}
+
+	spell.classification = 0;
+
+	if (IsSummonSpell(spell)) {
+		spell.classification |= SpellClassification_Summon;
+	}
+
+	if (IsDamageSpell(spell)) {
+		spell.classification |= SpellClassification_Damage;
+	}
+
+	if (IsSlowSpell(spell)) {
+		spell.classification |= SpellClassification_Slow;
+	}
+
+	if (IsHasteSpell(spell)) {
+		spell.classification |= SpellClassification_Haste;
+	}
+
+	if (IsPureNukeSpell(spell)) {
+		spell.classification |= SpellClassification_PureNuke;
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // spell property testing functions
 
@@ -136,47 +298,16 @@ bool IsSummonSpell(uint16 spell_id)
 		return false;
 	}
 
-	const auto& spell = spells[spell_id];
-
-	for (int i = 0; i < EFFECT_COUNT; i++) {
-		const auto effect_id = spell.effect_id[i];
-		if (
-			effect_id == SE_SummonPet ||
-			effect_id == SE_SummonItem ||
-			effect_id == SE_SummonPC
-		) {
-			return true;
-		}
-	}
-
-	return false;
+	return (spells[spell_id].classification & SpellClassification_Summon) != 0;
 }
 
 bool IsDamageSpell(uint16 spell_id)
 {
-	if (IsLifetapSpell(spell_id)) {
+	if (!IsValidSpell(spell_id)) {
 		return false;
 	}
 
-	const auto& spell = spells[spell_id];
-
-	for (int i = 0; i < EFFECT_COUNT; i++) {
-		const auto effect_id = spell.effect_id[i];
-		if (
-			spell.base_value[i] < 0 &&
-			(
-				effect_id == SE_CurrentHPOnce ||
-				(
-					effect_id == SE_CurrentHP &&
-					spell.buff_duration < 1
-				)
-			)
-		) {
-			return true;
-		}
-	}
-
-	return false;
+	return (spells[spell_id].classification & SpellClassification_Damage) != 0;
 }
 
 
@@ -222,22 +353,7 @@ bool IsSlowSpell(uint16 spell_id)
 		return false;
 	}
 
-	const auto& spell = spells[spell_id];
-
-	for (int i = 0; i < EFFECT_COUNT; i++) {
-		const auto effect_id = spell.effect_id[i];
-		if (
-			effect_id == SE_AttackSpeed4 ||
-			(
-				effect_id == SE_AttackSpeed &&
-				spell.base_value[i] < 100
-			)
-		) {
-			return true;
-		}
-	}
-
-	return false;
+	return (spells[spell_id].classification & SpellClassification_Slow) != 0;
 }
 
 bool IsHasteSpell(uint16 spell_id)
@@ -246,15 +362,7 @@ bool IsHasteSpell(uint16 spell_id)
 		return false;
 	}
 
-	const auto& spell = spells[spell_id];
-
-	for (int i = 0; i < EFFECT_COUNT; i++) {
-		if (spell.effect_id[i] == SE_AttackSpeed) {
-			return (spell.base_value[i] < 100);
-		}
-	}
-
-	return false;
+	return (spells[spell_id].classification & SpellClassification_Haste) != 0;
 }
 
 bool IsHarmonySpell(uint16 spell_id)
@@ -504,24 +612,7 @@ bool IsPureNukeSpell(uint16 spell_id)
 		return false;
 	}
 
-	auto effect_count = 0;
-
-	for (int i = 0; i < EFFECT_COUNT; i++) {
-		if (!IsBlankSpellEffect(spell_id, i)) {
-			effect_count++;
-		}
-	}
-
-	if (
-		effect_count == 1 &&
-		IsEffectInSpell(spell_id, SE_CurrentHP) &&
-		spells[spell_id].buff_duration == 0 &&
-		IsDamageSpell(spell_id)
-	) {
-		return true;
-	}
-
-	return false;
+	return (spells[spell_id].classification & SpellClassification_PureNuke) != 0;
 }
 
 bool IsAENukeSpell(uint16 spell_id)
@@ -683,6 +774,10 @@ bool IsEffectInSpell(uint16 spell_id, int effect_id)
 
 	const auto& spell = spells[spell_id];
 
+	if (effect_id >= 0 && effect_id <= HIGHEST_SPELL_EFFECT) {
+		return (spell.effect_mask[effect_id / 64] >> (effect_id % 64)) & 1;
+	}
+
 	for (int i = 0; i < EFFECT_COUNT; i++) {
 		if (spell.effect_id[i] == effect_id) {
 			return true;
@@ -729,28 +824,7 @@ bool IsBlankSpellEffect(uint16 spell_id, int effect_index)
 		return false;
 	}
 
-	const auto& spell = spells[spell_id];
-
-	const auto effect     = spell.effect_id[effect_index];
-	const auto base_value = spell.base_value[effect_index];
-	const auto formula    = spell.formula[effect_index];
-
-	// SE_CHA is "spacer"
-	// SE_Stacking* are also considered blank where this is used
-	if (
-		effect == SE_Blank ||
-		(
-			effect == SE_CHA &&
-			base_value == 0 &&
-			formula == 100
-		) ||
-		effect == SE_StackingCommand_Block ||
-		effect == SE_StackingCommand_Overwrite
-	) {
-		return true;
-	}
-
-	return false;
+	return IsBlankSpellEffect(spells[spell_id], effect_index);
 }
 
 // checks some things about a spell id, to see if we can proceed
@@ -816,6 +890,14 @@ int GetSpellEffectIndex(uint16 spell_id, int effect_id)
 
 	const auto& spell = spells[spell_id];
 
+	if (
+		effect_id >= 0 &&
+		effect_id <= HIGHEST_SPELL_EFFECT &&
+		!((spell.effect_mask[effect_id / 64] >> (effect_id % 64)) & 1)
+	) {
+		return -1;
+	}
+
 	for (int i = 0; i < EFFECT_COUNT; i++) {
 		if (spell.effect_id[i] == effect_id) {
 			return i;
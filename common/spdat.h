@@ -1310,7 +1310,20 @@ typedef enum {
 
 
 // LAST
+#define HIGHEST_SPELL_EFFECT			SE_Duration_Endurance_Pct // Should always be the last SE_ id above
 
+// one bit per spell effect id, see SPDat_Spell_Struct::effect_mask
+#define SPELL_EFFECT_MASK_WORDS			((HIGHEST_SPELL_EFFECT / 64) + 1)
+
+// precomputed from the spell record when the shared memory table is built, see SPDat_Spell_Struct::classification
+enum SpellClassification : uint32
+{
+	SpellClassification_Summon   = (1 << 0),
+	SpellClassification_Damage   = (1 << 1),
+	SpellClassification_Slow     = (1 << 2),
+	SpellClassification_Haste    = (1 << 3),
+	SpellClassification_PureNuke = (1 << 4)
+};
 
 #define DF_Permanent				50
 #define DF_Aura						51
@@ -1480,11 +1493,14 @@ struct SPDat_Spell_Struct
 /* 235 */	//bool is_beta_only; // -- IS_BETA_ONLY
 /* 236 */	//int spell_subgroup; // -- SPELL_SUBGROUP
 			uint8 damage_shield_type; // This field does not exist in spells_us.txt
+			uint64 effect_mask[SPELL_EFFECT_MASK_WORDS]; // Bit per effect id in effect_id, built by BuildSpellEffectIndex -- not in spells_us.txt
+			uint32 classification; // SpellClassification flags, built by BuildSpellEffectIndex -- not in spells_us.txt
 };
 
 extern const SPDat_Spell_Struct* spells;
 extern int32 SPDAT_RECORDS;
 
+void BuildSpellEffectIndex(SPDat_Spell_Struct &spell);
 bool IsTargetableAESpell(uint16 spell_id);
 bool IsSacrificeSpell(uint16 spell_id);
 bool IsLifetapSpell(uint16 spell_id);
@@ -5,6 +5,7 @@
 #include "../common/strings.h"
 #include "encryption.h"
 #include "account_management.h"
+#include "login_verify_pool.h"
 
 extern LoginServer server;
 
@@ -222,9 +223,9 @@ void Client::Handle_Login(const char *data, unsigned int size)
 			ParseAccountString(user, user, db_loginserver);
 
 			if (server.db->GetLoginDataFromAccountInfo(user, db_loginserver, db_account_password_hash, db_account_id)) {
-				result = VerifyLoginHash(user, db_loginserver, cred, db_account_password_hash);
+				VerifyLoginHashAsync(user, db_loginserver, cred, db_account_password_hash, db_account_id);
 
-				LogDebug("Success [{0}]", (result ? "true" : "false"));
+				return;
 			}
 			else {
 				m_client_status = cs_creating_account;
@@ -402,27 +403,30 @@ void Client::DoFailedLogin()
 }
 
 /**
- * Verifies a login hash, will also attempt to update a login hash if needed
+ * Verifies a login hash, touches no server state so it is safe to run on the verify pool
  *
  * @param account_username
- * @param source_loginserver
  * @param account_password
  * @param password_hash
+ * @param encryption_mode
+ * @param update_insecure_passwords
  * @return
  */
-bool Client::VerifyLoginHash(
+Client::VerifyLoginResult Client::VerifyLoginHash(
 	const std::string &account_username,
-	const std::string &source_loginserver,
 	const std::string &account_password,
-	const std::string &password_hash
+	const std::string &password_hash,
+	int encryption_mode,
+	bool update_insecure_passwords
 )
 {
-	auto encryption_mode = server.options.GetEncryptionMode();
+	VerifyLoginResult result;
+
 	if (eqcrypt_verify_hash(account_username, account_password, password_hash, encryption_mode)) {
-		return true;
+		result.valid = true;
 	}
 	else {
-		if (server.options.IsUpdatingInsecurePasswords()) {
+		if (update_insecure_passwords) {
 			if (encryption_mode < EncryptionModeArgon2) {
 				encryption_mode = EncryptionModeArgon2;
 			}
@@ -454,33 +458,135 @@ bool Client::VerifyLoginHash(
 			}
 
 			if (insecure_source_encryption_mode > 0) {
-				LogInfo(
-					"[{}] Updated insecure password user [{}] loginserver [{}] from mode [{}] ({}) to mode [{}] ({})",
-					__func__,
+				result.valid                = true;
+				result.insecure_source_mode = insecure_source_encryption_mode;
+				result.upgraded_hash        = eqcrypt_hash(
 					account_username,
-					source_loginserver,
-					GetEncryptionByModeId(insecure_source_encryption_mode),
-					insecure_source_encryption_mode,
-					GetEncryptionByModeId(encryption_mode),
+					account_password,
 					encryption_mode
 				);
+			}
+		}
+	}
 
-				server.db->UpdateLoginserverAccountPasswordHash(
-					account_username,
-					source_loginserver,
-					eqcrypt_hash(
-						account_username,
-						account_password,
-						encryption_mode
-					)
-				);
+	return result;
+}
+
+/**
+ * Hands the password check to the verify pool, the login finishes in FinishLoginHash
+ *
+ * @param account_username
+ * @param source_loginserver
+ * @param account_password
+ * @param password_hash
+ * @param db_account_id
+ */
+void Client::VerifyLoginHashAsync(
+	const std::string &account_username,
+	const std::string &source_loginserver,
+	const std::string &account_password,
+	const std::string &password_hash,
+	unsigned int db_account_id
+)
+{
+	m_client_status = cs_verifying_login;
 
-				return true;
+	auto encryption_mode = server.options.GetEncryptionMode();
+	auto update_insecure = server.options.IsUpdatingInsecurePasswords();
+	auto result          = std::make_shared<VerifyLoginResult>();
+
+	std::weak_ptr<bool> lifetime = m_lifetime;
+
+	auto queued = server.verify_pool->Enqueue(
+		m_connection->GetRemoteIP(),
+		[=]() {
+			*result = VerifyLoginHash(account_username, account_password, password_hash, encryption_mode, update_insecure);
+		},
+		[this, lifetime, result, account_username, source_loginserver, db_account_id]() {
+			if (lifetime.expired()) {
+				return;
 			}
+
+			FinishLoginHash(account_username, source_loginserver, db_account_id, *result);
 		}
+	);
+
+	if (queued != LoginVerifyPool::Queued) {
+		LogInfo(
+			"login [{}] user [{}] Login refused, {}",
+			source_loginserver,
+			account_username,
+			queued == LoginVerifyPool::RateLimited ? "too many failed logins from this address" : "verification queue is full"
+		);
+
+		DoFailedLogin();
 	}
+}
 
-	return false;
+/**
+ * Stores an upgraded hash if needed and answers the client, runs on the event loop
+ *
+ * @param account_username
+ * @param source_loginserver
+ * @param db_account_id
+ * @param result
+ */
+void Client::FinishLoginHash(
+	const std::string &account_username,
+	const std::string &source_loginserver,
+	unsigned int db_account_id,
+	const VerifyLoginResult &result
+)
+{
+	if (m_client_status != cs_verifying_login) {
+		return;
+	}
+
+	LogDebug("Success [{0}]", (result.valid ? "true" : "false"));
+
+	if (result.insecure_source_mode > 0) {
+		auto encryption_mode = server.options.GetEncryptionMode();
+		if (encryption_mode < EncryptionModeArgon2) {
+			encryption_mode = EncryptionModeArgon2;
+		}
+
+		LogInfo(
+			"[{}] Updated insecure password user [{}] loginserver [{}] from mode [{}] ({}) to mode [{}] ({})",
+			__func__,
+			account_username,
+			source_loginserver,
+			GetEncryptionByModeId(result.insecure_source_mode),
+			result.insecure_source_mode,
+			GetEncryptionByModeId(encryption_mode),
+			encryption_mode
+		);
+
+		server.db->UpdateLoginserverAccountPasswordHash(
+			account_username,
+			source_loginserver,
+			result.upgraded_hash
+		);
+	}
+
+	if (result.valid) {
+		LogInfo(
+			"login [{0}] user [{1}] Login succeeded",
+			source_loginserver,
+			account_username
+		);
+
+		DoSuccessfulLogin(account_username, db_account_id, source_loginserver);
+	}
+	else {
+		LogInfo(
+			"login [{0}] user [{1}] Login failed",
+			source_loginserver,
+			account_username
+		);
+
+		server.verify_pool->RecordFailure(m_connection->GetRemoteIP());
+		DoFailedLogin();
+	}
 }
 
 /**
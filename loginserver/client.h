@@ -160,19 +160,65 @@ public:
 	void DoFailedLogin();
 
 	/**
-	 * Verifies a login hash, will also attempt to update a login hash if needed
+	 * Outcome of checking a password against a stored hash
+	 *
+	 * insecure_source_mode is set when the password only matched an older, weaker mode and
+	 * upgraded_hash then holds the password rehashed with the configured mode
+	 */
+	struct VerifyLoginResult {
+		bool        valid                = false;
+		int         insecure_source_mode = 0;
+		std::string upgraded_hash;
+	};
+
+	/**
+	 * Verifies a login hash, touches no server state so it is safe to run on the verify pool
 	 *
 	 * @param account_username
-	 * @param source_loginserver
 	 * @param account_password
 	 * @param password_hash
+	 * @param encryption_mode
+	 * @param update_insecure_passwords
 	 * @return
 	 */
-	bool VerifyLoginHash(
+	static VerifyLoginResult VerifyLoginHash(
+		const std::string &account_username,
+		const std::string &account_password,
+		const std::string &password_hash,
+		int encryption_mode,
+		bool update_insecure_passwords
+	);
+
+	/**
+	 * Hands the password check to the verify pool, the login finishes in FinishLoginHash
+	 *
+	 * @param account_username
+	 * @param source_loginserver
+	 * @param account_password
+	 * @param password_hash
+	 * @param db_account_id
+	 */
+	void VerifyLoginHashAsync(
 		const std::string &account_username,
 		const std::string &source_loginserver,
 		const std::string &account_password,
-		const std::string &password_hash
+		const std::string &password_hash,
+		unsigned int db_account_id
+	);
+
+	/**
+	 * Stores an upgraded hash if needed and answers the client, runs on the event loop
+	 *
+	 * @param account_username
+	 * @param source_loginserver
+	 * @param db_account_id
+	 * @param result
+	 */
+	void FinishLoginHash(
+		const std::string &account_username,
+		const std::string &source_loginserver,
+		unsigned int db_account_id,
+		const VerifyLoginResult &result
 	);
 
 	void DoSuccessfulLogin(const std::string& in_account_name, int db_account_id, const std::string &db_loginserver);
@@ -198,6 +244,9 @@ private:
 
 	std::string m_stored_user;
 	std::string m_stored_pass;
+
+	// verify pool completions hold a weak reference, once the client is gone they do nothing
+	std::shared_ptr<bool> m_lifetime = std::make_shared<bool>(true);
 	static bool ProcessHealthCheck(std::string username);
 };
 
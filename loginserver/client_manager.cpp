@@ -13,6 +13,7 @@ ClientManager::ClientManager()
 	int titanium_port = server.config.GetVariableInt("client_configuration", "titanium_port", 5998);
 
 	EQStreamManagerInterfaceOptions titanium_opts(titanium_port, false, false);
+	titanium_opts.daybreak_options.batched_io = server.config.GetVariableBool("client_configuration", "batched_udp", false);
 
 	titanium_stream = new EQ::Net::EQStreamManager(titanium_opts);
 	titanium_ops    = new RegularOpcodeManager;
@@ -53,6 +54,7 @@ ClientManager::ClientManager()
 	int sod_port = server.config.GetVariableInt("client_configuration", "sod_port", 5999);
 
 	EQStreamManagerInterfaceOptions sod_opts(sod_port, false, false);
+	sod_opts.daybreak_options.batched_io = server.config.GetVariableBool("client_configuration", "batched_udp", false);
 	sod_stream = new EQ::Net::EQStreamManager(sod_opts);
 	sod_ops    = new RegularOpcodeManager;
 
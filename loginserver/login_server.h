@@ -9,6 +9,7 @@
 #include "server_manager.h"
 #include "client_manager.h"
 #include "loginserver_webserver.h"
+#include "login_verify_pool.h"
 
 /**
  * Login server struct, Contains every variable for the server that needs to exist outside the scope of main()
@@ -27,6 +28,7 @@ public:
 	Options                            options;
 	ServerManager                      *server_manager;
 	ClientManager                      *client_manager{};
+	LoginVerifyPool                    *verify_pool{};
 };
 
 #endif
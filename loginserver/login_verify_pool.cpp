@@ -0,0 +1,241 @@
+#include "login_verify_pool.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/event/event_loop.h"
+
+LoginVerifyPool::LoginVerifyPool()
+{
+	m_running    = false;
+	m_pending    = 0;
+	m_max_queued = 0;
+	m_max_per_ip = 0;
+	m_ip_window  = std::chrono::seconds(60);
+	m_async      = nullptr;
+}
+
+LoginVerifyPool::~LoginVerifyPool()
+{
+	Stop();
+}
+
+void LoginVerifyPool::Start(uint32 threads, uint32 max_queued, uint32 max_per_ip, uint32 ip_window_seconds)
+{
+	if (m_running) {
+		return;
+	}
+
+	m_max_queued    = max_queued;
+	m_max_per_ip    = max_per_ip;
+	m_ip_window     = std::chrono::seconds(ip_window_seconds ? ip_window_seconds : 1);
+	m_last_ip_prune = Clock::now();
+
+	if (threads == 0) {
+		LogInfo("Login verification pool disabled, verifying passwords inline");
+		return;
+	}
+
+	m_async       = new uv_async_t;
+	m_async->data = this;
+	uv_async_init(
+		EQ::EventLoop::Get().Handle(), m_async, [](uv_async_t *handle) {
+			static_cast<LoginVerifyPool *>(handle->data)->ProcessCompleted();
+		}
+	);
+
+	// completions should never be the only thing keeping the loop alive
+	uv_unref(reinterpret_cast<uv_handle_t *>(m_async));
+
+	m_running = true;
+
+	for (uint32 i = 0; i < threads; ++i) {
+		m_threads.emplace_back(&LoginVerifyPool::ProcessWork, this);
+	}
+
+	LogInfo(
+		"Login verification pool started with [{}] thread(s) queue limit [{}] per ip failure limit [{}] per [{}] seconds",
+		threads,
+		m_max_queued,
+		m_max_per_ip,
+		m_ip_window.count()
+	);
+}
+
+void LoginVerifyPool::Stop()
+{
+	if (!m_running) {
+		return;
+	}
+
+	// queued logins are still answered, a client left hanging would just time out instead
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		m_running = false;
+	}
+
+	m_cv.notify_all();
+
+	for (auto &t : m_threads) {
+		if (t.joinable()) {
+			t.join();
+		}
+	}
+
+	m_threads.clear();
+
+	ProcessCompleted();
+
+	uv_close(
+		reinterpret_cast<uv_handle_t *>(m_async), [](uv_handle_t *handle) {
+			delete reinterpret_cast<uv_async_t *>(handle);
+		}
+	);
+
+	m_async = nullptr;
+}
+
+LoginVerifyPool::EnqueueResult LoginVerifyPool::Enqueue(uint32 ip, WorkFn work, DoneFn done)
+{
+	auto now = Clock::now();
+
+	if (!CheckRateLimit(ip, now)) {
+		m_stats.rejected_rate_limited++;
+		return RateLimited;
+	}
+
+	if (!m_running) {
+		m_stats.queued++;
+		work();
+		RecordTime(m_stats.total_verify_us, m_stats.max_verify_us, std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - now).count());
+		done();
+		RecordTime(m_stats.total_latency_us, m_stats.max_latency_us, std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - now).count());
+		m_stats.completed++;
+		return Queued;
+	}
+
+	if (m_max_queued && m_pending >= m_max_queued) {
+		m_stats.rejected_queue_full++;
+		return QueueFull;
+	}
+
+	m_stats.queued++;
+	++m_pending;
+
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		m_jobs.push(Job{std::move(work), std::move(done), now});
+	}
+
+	m_cv.notify_one();
+
+	return Queued;
+}
+
+bool LoginVerifyPool::CheckRateLimit(uint32 ip, Clock::time_point now)
+{
+	if (m_max_per_ip == 0) {
+		return true;
+	}
+
+	// drop windows that have run out so the map only holds addresses that failed recently
+	if (now - m_last_ip_prune >= m_ip_window) {
+		for (auto iter = m_ip_windows.begin(); iter != m_ip_windows.end();) {
+			if (now - iter->second.start >= m_ip_window) {
+				iter = m_ip_windows.erase(iter);
+			}
+			else {
+				++iter;
+			}
+		}
+
+		m_last_ip_prune = now;
+	}
+
+	auto iter = m_ip_windows.find(ip);
+	if (iter == m_ip_windows.end() || now - iter->second.start >= m_ip_window) {
+		return true;
+	}
+
+	return iter->second.failures < m_max_per_ip;
+}
+
+void LoginVerifyPool::RecordFailure(uint32 ip)
+{
+	if (m_max_per_ip == 0) {
+		return;
+	}
+
+	auto now  = Clock::now();
+	auto iter = m_ip_windows.find(ip);
+	if (iter == m_ip_windows.end()) {
+		m_ip_windows[ip] = IPWindow{now, 1};
+		return;
+	}
+
+	auto &w = iter->second;
+	if (now - w.start >= m_ip_window) {
+		w.start    = now;
+		w.failures = 0;
+	}
+
+	w.failures++;
+}
+
+void LoginVerifyPool::ProcessWork()
+{
+	for (;;) {
+		Job job;
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_cv.wait(lock, [this] { return !m_running || !m_jobs.empty(); });
+
+			if (m_jobs.empty()) {
+				return;
+			}
+
+			job = std::move(m_jobs.front());
+			m_jobs.pop();
+		}
+
+		auto started = Clock::now();
+		RecordTime(m_stats.total_wait_us, m_stats.max_wait_us, std::chrono::duration_cast<std::chrono::microseconds>(started - job.queued_at).count());
+
+		job.work();
+
+		RecordTime(m_stats.total_verify_us, m_stats.max_verify_us, std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - started).count());
+
+		--m_pending;
+
+		{
+			std::unique_lock<std::mutex> lock(m_completed_lock);
+			m_completed.push_back(Completed{std::move(job.done), job.queued_at});
+		}
+
+		uv_async_send(m_async);
+	}
+}
+
+void LoginVerifyPool::ProcessCompleted()
+{
+	std::vector<Completed> completed;
+
+	{
+		std::unique_lock<std::mutex> lock(m_completed_lock);
+		completed.swap(m_completed);
+	}
+
+	for (auto &c : completed) {
+		c.done();
+		RecordTime(m_stats.total_latency_us, m_stats.max_latency_us, std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - c.queued_at).count());
+	}
+
+	m_stats.completed += completed.size();
+}
+
+void LoginVerifyPool::RecordTime(std::atomic<uint64> &total, std::atomic<uint64> &max, uint64 us)
+{
+	total += us;
+
+	uint64 current = max.load(std::memory_order_relaxed);
+	while (us > current && !max.compare_exchange_weak(current, us, std::memory_order_relaxed)) {
+	}
+}
@@ -0,0 +1,115 @@
+#ifndef EQEMU_LOGIN_VERIFY_POOL_H
+#define EQEMU_LOGIN_VERIFY_POOL_H
+
+#include "../common/types.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <uv.h>
+
+/**
+ * Bounded pool of threads for password hash verification
+ *
+ * Argon2 and scrypt are slow on purpose, run inline they stall every other login behind them.
+ * Work runs on a pool thread and its completion is handed back to the event loop, so completions
+ * may touch server state. Enqueue and Stop must be called from the event loop thread
+ */
+class LoginVerifyPool {
+public:
+	typedef std::function<void()> WorkFn;
+	typedef std::function<void()> DoneFn;
+
+	enum EnqueueResult {
+		Queued,
+		QueueFull,
+		RateLimited
+	};
+
+	// counters are written from pool threads and read by the web api, all times are microseconds
+	struct Stats {
+		std::atomic<uint64> queued{0};
+		std::atomic<uint64> completed{0};
+		std::atomic<uint64> rejected_queue_full{0};
+		std::atomic<uint64> rejected_rate_limited{0};
+		std::atomic<uint64> total_wait_us{0};
+		std::atomic<uint64> max_wait_us{0};
+		std::atomic<uint64> total_verify_us{0};
+		std::atomic<uint64> max_verify_us{0};
+		std::atomic<uint64> total_latency_us{0};
+		std::atomic<uint64> max_latency_us{0};
+	};
+
+	LoginVerifyPool();
+	~LoginVerifyPool();
+
+	/**
+	 * @param threads pool threads, 0 verifies inline on the event loop
+	 * @param max_queued verifications waiting for a thread before new ones are turned away
+	 * @param max_per_ip failed verifications one address may have per window before it is turned away, 0 disables the limit
+	 * @param ip_window_seconds length of the rate limit window
+	 */
+	void Start(uint32 threads, uint32 max_queued, uint32 max_per_ip, uint32 ip_window_seconds);
+	void Stop();
+
+	EnqueueResult Enqueue(uint32 ip, WorkFn work, DoneFn done);
+
+	// counts a failed verification against the address, successful logins are never limited
+	void RecordFailure(uint32 ip);
+
+	inline uint32 GetThreadCount() const { return static_cast<uint32>(m_threads.size()); }
+	inline uint32 GetPendingCount() const { return m_pending; }
+	inline const Stats &GetStats() const { return m_stats; }
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	struct Job {
+		WorkFn            work;
+		DoneFn            done;
+		Clock::time_point queued_at;
+	};
+
+	struct Completed {
+		DoneFn            done;
+		Clock::time_point queued_at;
+	};
+
+	struct IPWindow {
+		Clock::time_point start;
+		uint32            failures;
+	};
+
+	bool CheckRateLimit(uint32 ip, Clock::time_point now);
+	void ProcessWork();
+	void ProcessCompleted();
+
+	static void RecordTime(std::atomic<uint64> &total, std::atomic<uint64> &max, uint64 us);
+
+	std::vector<std::thread> m_threads;
+	std::mutex               m_lock;
+	std::condition_variable  m_cv;
+	std::queue<Job>          m_jobs;
+	bool                     m_running;
+	std::atomic<uint32>      m_pending;
+	uint32                   m_max_queued;
+
+	// only touched from the event loop
+	std::unordered_map<uint32, IPWindow> m_ip_windows;
+	uint32                               m_max_per_ip;
+	std::chrono::seconds                 m_ip_window;
+	Clock::time_point                    m_last_ip_prune;
+
+	std::mutex             m_completed_lock;
+	std::vector<Completed> m_completed;
+	uv_async_t             *m_async;
+
+	Stats m_stats;
+};
+
+#endif
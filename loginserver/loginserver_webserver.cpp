@@ -298,6 +298,33 @@ namespace LoginserverWebserver {
 			}
 		);
 
+		api.Get(
+			"/v1/metrics/login_verify", [](const httplib::Request &request, httplib::Response &res) {
+				if (!LoginserverWebserver::TokenManager::AuthCanRead(request, res)) {
+					return;
+				}
+
+				const auto   &stats    = server.verify_pool->GetStats();
+				const uint64 completed = stats.completed;
+
+				Json::Value response;
+				response["threads"]               = server.verify_pool->GetThreadCount();
+				response["pending"]               = server.verify_pool->GetPendingCount();
+				response["queued"]                = Json::UInt64(stats.queued);
+				response["completed"]             = Json::UInt64(completed);
+				response["rejected_queue_full"]   = Json::UInt64(stats.rejected_queue_full);
+				response["rejected_rate_limited"] = Json::UInt64(stats.rejected_rate_limited);
+				response["avg_wait_us"]           = Json::UInt64(completed ? stats.total_wait_us / completed : 0);
+				response["max_wait_us"]           = Json::UInt64(stats.max_wait_us);
+				response["avg_verify_us"]         = Json::UInt64(completed ? stats.total_verify_us / completed : 0);
+				response["max_verify_us"]         = Json::UInt64(stats.max_verify_us);
+				response["avg_latency_us"]        = Json::UInt64(completed ? stats.total_latency_us / completed : 0);
+				response["max_latency_us"]        = Json::UInt64(stats.max_latency_us);
+
+				LoginserverWebserver::SendResponse(response, res);
+			}
+		);
+
 		api.Get(
 			"/probes/healthcheck", [](const httplib::Request &request, httplib::Response &res) {
 				Json::Value response;
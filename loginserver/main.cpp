@@ -246,6 +246,18 @@ int main(int argc, char **argv)
 		return 1;
 	}
 
+	/**
+	 * password hashes are verified off the event loop
+	 */
+	LogInfo("Login Verify Pool Init");
+	server.verify_pool = new LoginVerifyPool();
+	server.verify_pool->Start(
+		server.config.GetVariableInt("security", "verify_threads", 2),
+		server.config.GetVariableInt("security", "verify_queue_max", 256),
+		server.config.GetVariableInt("security", "verify_max_per_ip", 0),
+		server.config.GetVariableInt("security", "verify_ip_window_seconds", 60)
+	);
+
 #ifdef WIN32
 #ifdef UNICODE
 		SetConsoleTitle(L"EQEmu Login Server");
@@ -313,9 +325,14 @@ int main(int argc, char **argv)
 
 	LogInfo("Server Shutdown");
 
+	LogInfo("Login Verify Pool Shutdown");
+	server.verify_pool->Stop();
+
 	LogInfo("Client Manager Shutdown");
 	delete server.client_manager;
 
+	delete server.verify_pool;
+
 	LogInfo("Server Manager Shutdown");
 	delete server.server_manager;
 
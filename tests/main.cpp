@@ -32,6 +32,8 @@
 #include "data_verification_test.h"
 #include "skills_util_test.h"
 #include "task_state_test.h"
+#include "mob_movement_queue_test.h"
+#include "map_height_field_test.h"
 
 const EQEmuConfig *Config;
 EQEmuLogSys       LogSys;
@@ -58,6 +60,8 @@ int main()
 		tests.add(new DataVerificationTest());
 		tests.add(new SkillsUtilsTest());
 		tests.add(new TaskStateTest());
+		tests.add(new MobMovementQueueTest());
+		tests.add(new MapHeightFieldTest());
 		tests.run(*output, true);
 	}
 	catch (std::exception &ex) {
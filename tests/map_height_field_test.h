@@ -0,0 +1,110 @@
+#ifndef __EQEMU_TESTS_MAP_HEIGHT_FIELD_H
+#define __EQEMU_TESTS_MAP_HEIGHT_FIELD_H
+
+#include "cppunit/cpptest.h"
+#include "../zone/map_height_field.h"
+#include "../zone/raycast_mesh.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+class MapHeightFieldTest : public Test::Suite {
+	typedef void(MapHeightFieldTest::*TestFunction)(void);
+public:
+	MapHeightFieldTest() {
+		TEST_ADD(MapHeightFieldTest::MatchesRaycast);
+	}
+
+	~MapHeightFieldTest() {
+	}
+
+private:
+	std::vector<RmReal>   m_verts;
+	std::vector<RmUint32> m_indices;
+
+	void AddQuad(float x0, float y0, float x1, float y1, float z00, float z10, float z01, float z11) {
+		auto base = static_cast<RmUint32>(m_verts.size() / 3);
+		RmReal v[] = {x0, y0, z00, x1, y0, z10, x0, y1, z01, x1, y1, z11};
+		m_verts.insert(m_verts.end(), v, v + 12);
+
+		RmUint32 i[] = {base, base + 1, base + 2, base + 1, base + 3, base + 2};
+		m_indices.insert(m_indices.end(), i, i + 6);
+	}
+
+	// what Map::FindBestZ gets from the raycaster, the first surface below and failing that above
+	float RaycastBestZ(RaycastMesh *rm, float x, float y, float z) {
+		RmReal from[3] = {x, y, z};
+		RmReal to[3]   = {x, y, -99999.0f};
+		RmReal hit[3];
+
+		if (rm->raycast(from, to, hit, nullptr, nullptr)) {
+			return hit[2];
+		}
+
+		to[2] = 99999.0f;
+		if (rm->raycast(from, to, hit, nullptr, nullptr)) {
+			return hit[2];
+		}
+
+		return -99999.0f;
+	}
+
+	void MatchesRaycast() {
+		m_verts.clear();
+		m_indices.clear();
+
+		// a slope that bends at x = 32 with a flat bridge over it between x = 10 and x = 20
+		AddQuad(0.0f, 0.0f, 32.0f, 64.0f, 0.0f, 16.0f, 16.0f, 32.0f);
+		AddQuad(32.0f, 0.0f, 64.0f, 64.0f, 16.0f, 19.2f, 32.0f, 35.2f);
+		AddQuad(10.0f, 0.0f, 20.0f, 64.0f, 40.0f, 40.0f, 40.0f, 40.0f);
+
+		RaycastMesh *rm = createRaycastMesh(
+			static_cast<RmUint32>(m_verts.size() / 3),
+			m_verts.data(),
+			static_cast<RmUint32>(m_indices.size() / 3),
+			m_indices.data()
+		);
+
+		const std::string filename = "test_height_field.hfield";
+
+		uint32 resolved = 0;
+		uint32 total    = 0;
+		TEST_ASSERT(MapHeightField::Build(rm, filename, 3.0f, 0.5f, resolved, total));
+		TEST_ASSERT(resolved > 0);
+		TEST_ASSERT(resolved < total);
+
+		{
+			MapHeightField field;
+			TEST_ASSERT(field.Load(filename, rm->getBoundMin(), rm->getBoundMax()));
+
+			uint32 answered = 0;
+			uint32 seed     = 12345;
+			auto   next     = [&seed](float lo, float hi) {
+				seed = seed * 1103515245u + 12345u;
+				return lo + (hi - lo) * static_cast<float>((seed >> 8) & 0xFFFF) / 65535.0f;
+			};
+
+			for (int i = 0; i < 20000; ++i) {
+				const float x = next(0.0f, 63.9f);
+				const float y = next(0.0f, 63.9f);
+				const float z = next(-5.0f, 50.0f);
+
+				float best_z;
+				if (!field.FindBestZ(x, y, z, best_z)) {
+					continue;
+				}
+
+				answered++;
+				TEST_ASSERT(std::fabs(best_z - RaycastBestZ(rm, x, y, z)) < 0.02f);
+			}
+
+			TEST_ASSERT(answered > 0);
+		}
+
+		rm->release();
+		std::remove(filename.c_str());
+	}
+};
+
+#endif
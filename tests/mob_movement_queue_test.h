@@ -0,0 +1,114 @@
+#ifndef __EQEMU_TESTS_MOB_MOVEMENT_QUEUE_H
+#define __EQEMU_TESTS_MOB_MOVEMENT_QUEUE_H
+
+#include "cppunit/cpptest.h"
+#include "../zone/mob_movement_queue.h"
+
+#include <algorithm>
+
+class MobMovementQueueTest : public Test::Suite {
+	typedef void(MobMovementQueueTest::*TestFunction)(void);
+public:
+	MobMovementQueueTest() {
+		TEST_ADD(MobMovementQueueTest::MergesPerMob);
+		TEST_ADD(MobMovementQueueTest::HoldsUntilDue);
+		TEST_ADD(MobMovementQueueTest::DeathWhileHeld);
+		TEST_ADD(MobMovementQueueTest::RemoveKeepsOthers);
+	}
+
+	~MobMovementQueueTest() {
+	}
+
+private:
+	struct FakeMob {
+		int id;
+	};
+
+	typedef MovementUpdateQueue<int> Queue;
+
+	std::vector<int> FlushAll(Queue &queue, uint32 now) {
+		std::vector<int> sent;
+		queue.Flush(now, [&](Queue::Entry &e) { sent.push_back(e.update); });
+		return sent;
+	}
+
+	void MergesPerMob() {
+		FakeMob a{1}, b{2};
+		Queue   queue;
+
+		TEST_ASSERT(!queue.Queue(&a, 10, true, 0));
+		TEST_ASSERT(!queue.Queue(&b, 20, true, 0));
+		TEST_ASSERT(queue.Queue(&a, 11, true, 0));
+		TEST_ASSERT_EQUALS(queue.GetPendingCount(), 2);
+
+		auto sent = FlushAll(queue, 1000);
+		TEST_ASSERT_EQUALS(sent.size(), 2);
+		TEST_ASSERT_EQUALS(sent[0], 11);
+		TEST_ASSERT_EQUALS(sent[1], 20);
+		TEST_ASSERT(queue.Empty());
+
+		uint32 last = 0;
+		TEST_ASSERT(queue.GetLastSent(&a, last));
+		TEST_ASSERT_EQUALS(last, 1000);
+	}
+
+	void HoldsUntilDue() {
+		FakeMob a{1};
+		Queue   queue;
+
+		queue.Queue(&a, 10, true, 1500);
+
+		TEST_ASSERT(FlushAll(queue, 1000).empty());
+		TEST_ASSERT_EQUALS(queue.GetPendingCount(), 1);
+
+		auto sent = FlushAll(queue, 1500);
+		TEST_ASSERT_EQUALS(sent.size(), 1);
+		TEST_ASSERT_EQUALS(sent[0], 10);
+		TEST_ASSERT(queue.Empty());
+	}
+
+	// the npc dies with its update held, its id goes to the corpse and the mob is freed
+	void DeathWhileHeld() {
+		auto  npc = new FakeMob{42};
+		Queue queue;
+
+		queue.Queue(npc, 1, true, 0);
+		FlushAll(queue, 1000);
+		queue.Queue(npc, 2, true, 1250);
+		TEST_ASSERT(FlushAll(queue, 1100).empty());
+
+		npc->id = 0;
+		queue.Remove(npc);
+
+		uint32 last = 0;
+		TEST_ASSERT(!queue.GetLastSent(npc, last));
+
+		delete npc;
+
+		TEST_ASSERT(queue.Empty());
+		TEST_ASSERT(FlushAll(queue, 2000).empty());
+	}
+
+	void RemoveKeepsOthers() {
+		FakeMob a{1}, b{2}, c{3};
+		Queue   queue;
+
+		queue.Queue(&a, 10, false, 0);
+		queue.Queue(&b, 20, false, 0);
+		queue.Queue(&c, 30, false, 0);
+		queue.Remove(&a);
+
+		TEST_ASSERT(queue.Queue(&c, 31, false, 0));
+		TEST_ASSERT_EQUALS(queue.GetPendingCount(), 2);
+
+		auto sent = FlushAll(queue, 1000);
+		TEST_ASSERT_EQUALS(sent.size(), 2);
+		TEST_ASSERT(std::find(sent.begin(), sent.end(), 20) != sent.end());
+		TEST_ASSERT(std::find(sent.begin(), sent.end(), 31) != sent.end());
+
+		uint32 last = 0;
+		TEST_ASSERT(!queue.GetLastSent(&b, last));
+	}
+};
+
+#endif
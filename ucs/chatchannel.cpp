@@ -58,13 +58,6 @@ ChatChannel::ChatChannel(const std::string& inName, const std::string& inOwner,
 }
 
 ChatChannel::~ChatChannel() {
-
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements())
-		iterator.RemoveCurrent(false);
 }
 
 ChatChannel *ChatChannelList::CreateChannel(
@@ -255,18 +248,11 @@ int ChatChannel::MemberCount(int Status) {
 
 	int Count = 0;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
-
-		if(ChannelClient && (!ChannelClient->GetHideMe() || (ChannelClient->GetAccountStatus() < Status)))
-			Count++;
-
-		iterator.Advance();
+	for (auto &members : m_clients_in_channel) {
+		for (auto ChannelClient : members) {
+			if(!ChannelClient->GetHideMe() || (ChannelClient->GetAccountStatus() < Status))
+				Count++;
+		}
 	}
 
 	return Count;
@@ -323,22 +309,18 @@ void ChatChannel::AddClient(Client *c) {
 
 	LogDebug("Adding [{}] to channel [{}]", c->GetName().c_str(), m_name.c_str());
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *CurrentClient = iterator.GetData();
-
-		if(CurrentClient && CurrentClient->IsAnnounceOn())
-			if(!HideMe || (CurrentClient->GetAccountStatus() > AccountStatus))
-				CurrentClient->AnnounceJoin(this, c);
-
-		iterator.Advance();
+	for (auto &members : m_clients_in_channel) {
+		for (auto CurrentClient : members) {
+			if(CurrentClient->IsAnnounceOn())
+				if(!HideMe || (CurrentClient->GetAccountStatus() > AccountStatus))
+					CurrentClient->AnnounceJoin(this, c);
+		}
 	}
 
-	m_clients_in_channel.Insert(c);
+	auto version = static_cast<uint32>(c->GetClientVersion());
+
+	m_clients_in_channel[version].push_back(c);
+	m_member_version[c] = version;
 
 }
 
@@ -354,28 +336,28 @@ bool ChatChannel::RemoveClient(Client *c) {
 
 	int players_in_channel = 0;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
+	auto member = m_member_version.find(c);
+	if (member != m_member_version.end()) {
+		auto &members = m_clients_in_channel[member->second];
 
-	while(iterator.MoreElements()) {
+		auto it = std::find(members.begin(), members.end(), c);
+		if (it != members.end()) {
+			*it = members.back();
+			members.pop_back();
+		}
 
-		auto *current_client = iterator.GetData();
+		m_member_version.erase(member);
+	}
 
-		if(current_client == c) {
-			iterator.RemoveCurrent(false);
-		}
-		else if(current_client) {
+	for (auto &members : m_clients_in_channel) {
+		for (auto current_client : members) {
 
 			players_in_channel++;
 
 			if(current_client->IsAnnounceOn())
 				if(!hide_me || (current_client->GetAccountStatus() > account_status))
 					current_client->AnnounceLeave(this, c);
-
-			iterator.Advance();
 		}
-
 	}
 
 	if((players_in_channel == 0) && !m_permanent) {
@@ -426,38 +408,30 @@ void ChatChannel::SendChannelMembers(Client *c) {
 
 	int MembersInLine = 0;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
+	for (auto &members : m_clients_in_channel) {
+		for (auto ChannelClient : members) {
 
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
-
-		// Don't list hidden characters with status higher or equal than the character requesting the list.
-		//
-		if(!ChannelClient || (ChannelClient->GetHideMe() && (ChannelClient->GetAccountStatus() >= AccountStatus))) {
-			iterator.Advance();
-			continue;
-		}
+			// Don't list hidden characters with status higher or equal than the character requesting the list.
+			//
+			if(ChannelClient->GetHideMe() && (ChannelClient->GetAccountStatus() >= AccountStatus))
+				continue;
 
-		if(MembersInLine > 0)
-			Message += ", ";
+			if(MembersInLine > 0)
+				Message += ", ";
 
-		Message += ChannelClient->GetName();
+			Message += ChannelClient->GetName();
 
-		MembersInLine++;
+			MembersInLine++;
 
-		if(MembersInLine == 6) {
+			if(MembersInLine == 6) {
 
-			c->GeneralChannelMessage(Message);
+				c->GeneralChannelMessage(Message);
 
-			MembersInLine = 0;
+				MembersInLine = 0;
 
-			Message.clear();
+				Message.clear();
+			}
 		}
-
-		iterator.Advance();
 	}
 
 	if(MembersInLine > 0)
@@ -469,47 +443,48 @@ void ChatChannel::SendMessageToChannel(const std::string& Message, Client* Sende
 
 	if(!Sender) return;
 
-	std::string cv_messages[EQ::versions::ClientVersionCount];
-
 	ChatMessagesSent++;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
+	std::string cv_message;
 
-	iterator.Reset();
+	// one conversion and one packet per client version, every member of that version is queued the same packet.
+	// chat streams are not proxied so there is no struct encode, each member's stream still writes the
+	// opcode and payload into its own connection buffer
+	for (uint32 version = 0; version < EQ::versions::ClientVersionCount; version++) {
 
-	while(iterator.MoreElements()) {
+		auto &members = m_clients_in_channel[version];
 
-		auto *channel_client = iterator.GetData();
-
-		if(channel_client)
-		{
-			LogDebug("Sending message to [{}] from [{}]",
-				channel_client->GetName().c_str(), Sender->GetName().c_str());
-
-			if (cv_messages[static_cast<uint32>(channel_client->GetClientVersion())].length() == 0) {
-				switch (channel_client->GetClientVersion()) {
-				case EQ::versions::ClientVersion::Titanium:
-					ServerToClient45SayLink(cv_messages[static_cast<uint32>(channel_client->GetClientVersion())], Message);
-					break;
-				case EQ::versions::ClientVersion::SoF:
-				case EQ::versions::ClientVersion::SoD:
-				case EQ::versions::ClientVersion::UF:
-					ServerToClient50SayLink(cv_messages[static_cast<uint32>(channel_client->GetClientVersion())], Message);
-					break;
-				case EQ::versions::ClientVersion::RoF:
-					ServerToClient55SayLink(cv_messages[static_cast<uint32>(channel_client->GetClientVersion())], Message);
-					break;
-				case EQ::versions::ClientVersion::RoF2:
-				default:
-					cv_messages[static_cast<uint32>(channel_client->GetClientVersion())] = Message;
-					break;
-				}
-			}
+		if (members.empty())
+			continue;
 
-			channel_client->SendChannelMessage(m_name, cv_messages[static_cast<uint32>(channel_client->GetClientVersion())], Sender);
+		const std::string *text = &cv_message;
+
+		cv_message.clear();
+
+		switch (static_cast<EQ::versions::ClientVersion>(version)) {
+		case EQ::versions::ClientVersion::Titanium:
+			ServerToClient45SayLink(cv_message, Message);
+			break;
+		case EQ::versions::ClientVersion::SoF:
+		case EQ::versions::ClientVersion::SoD:
+		case EQ::versions::ClientVersion::UF:
+			ServerToClient50SayLink(cv_message, Message);
+			break;
+		case EQ::versions::ClientVersion::RoF:
+			ServerToClient55SayLink(cv_message, Message);
+			break;
+		case EQ::versions::ClientVersion::RoF2:
+		default:
+			text = &Message;
+			break;
 		}
 
-		iterator.Advance();
+		LogDebug("Sending message to [{}] members of [{}] from [{}]", members.size(), m_name, Sender->GetName());
+
+		auto outapp = Client::MakeChannelMessagePacket(m_name, *text, Sender, members.front()->IsUnderfootOrLater());
+
+		for (auto channel_client : members)
+			channel_client->QueuePacket(outapp.get());
 	}
 }
 
@@ -517,23 +492,13 @@ void ChatChannel::SetModerated(bool inModerated) {
 
 	m_moderated = inModerated;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
-
-		if(ChannelClient) {
-
+	for (auto &members : m_clients_in_channel) {
+		for (auto ChannelClient : members) {
 			if(m_moderated)
 				ChannelClient->GeneralChannelMessage("Channel " + m_name + " is now moderated.");
 			else
 				ChannelClient->GeneralChannelMessage("Channel " + m_name + " is no longer moderated.");
 		}
-
-		iterator.Advance();
 	}
 
 }
@@ -541,19 +506,7 @@ bool ChatChannel::IsClientInChannel(Client *c) {
 
 	if(!c) return false;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		if(iterator.GetData() == c)
-			return true;
-
-		iterator.Advance();
-	}
-
-	return false;
+	return m_member_version.find(c) != m_member_version.end();
 }
 
 ChatChannel *ChatChannelList::AddClientToChannel(std::string channel_name, Client *c, bool command_directed) {
@@ -711,33 +664,28 @@ void ChatChannelList::Process() {
 
 void ChatChannel::AddInvitee(const std::string &Invitee)
 {
-	if (!IsInvitee(Invitee)) {
-		m_invitees.push_back(Invitee);
+	if (m_invitees.insert(Invitee).second) {
 
 		LogDebug("Added [{}] as invitee to channel [{}]", Invitee.c_str(), m_name.c_str());
 	}
 
 }
 
-void ChatChannel::RemoveInvitee(std::string Invitee)
+void ChatChannel::RemoveInvitee(const std::string &Invitee)
 {
-	auto it = std::find(std::begin(m_invitees), std::end(m_invitees), Invitee);
-
-	if(it != std::end(m_invitees)) {
-		m_invitees.erase(it);
+	if (m_invitees.erase(Invitee)) {
 		LogDebug("Removed [{}] as invitee to channel [{}]", Invitee.c_str(), m_name.c_str());
 	}
 }
 
-bool ChatChannel::IsInvitee(std::string Invitee)
+bool ChatChannel::IsInvitee(const std::string &Invitee)
 {
-	return std::find(std::begin(m_invitees), std::end(m_invitees), Invitee) != std::end(m_invitees);
+	return m_invitees.find(Invitee) != m_invitees.end();
 }
 
 void ChatChannel::AddModerator(const std::string &Moderator)
 {
-	if (!IsModerator(Moderator)) {
-		m_moderators.push_back(Moderator);
+	if (m_moderators.insert(Moderator).second) {
 
 		LogInfo("Added [{}] as moderator to channel [{}]", Moderator.c_str(), m_name.c_str());
 	}
@@ -746,23 +694,19 @@ void ChatChannel::AddModerator(const std::string &Moderator)
 
 void ChatChannel::RemoveModerator(const std::string &Moderator)
 {
-	auto it = std::find(std::begin(m_moderators), std::end(m_moderators), Moderator);
-
-	if (it != std::end(m_moderators)) {
-		m_moderators.erase(it);
+	if (m_moderators.erase(Moderator)) {
 		LogInfo("Removed [{}] as moderator to channel [{}]", Moderator.c_str(), m_name.c_str());
 	}
 }
 
-bool ChatChannel::IsModerator(std::string Moderator)
+bool ChatChannel::IsModerator(const std::string &Moderator)
 {
-	return std::find(std::begin(m_moderators), std::end(m_moderators), Moderator) != std::end(m_moderators);
+	return m_moderators.find(Moderator) != m_moderators.end();
 }
 
 void ChatChannel::AddVoice(const std::string &inVoiced)
 {
-	if (!HasVoice(inVoiced)) {
-		m_voiced.push_back(inVoiced);
+	if (m_voiced.insert(inVoiced).second) {
 
 		LogInfo("Added [{}] as voiced to channel [{}]", inVoiced.c_str(), m_name.c_str());
 	}
@@ -770,18 +714,15 @@ void ChatChannel::AddVoice(const std::string &inVoiced)
 
 void ChatChannel::RemoveVoice(const std::string &inVoiced)
 {
-	auto it = std::find(std::begin(m_voiced), std::end(m_voiced), inVoiced);
-
-	if (it != std::end(m_voiced)) {
-		m_voiced.erase(it);
+	if (m_voiced.erase(inVoiced)) {
 
 		LogInfo("Removed [{}] as voiced to channel [{}]", inVoiced.c_str(), m_name.c_str());
 	}
 }
 
-bool ChatChannel::HasVoice(std::string inVoiced)
+bool ChatChannel::HasVoice(const std::string &inVoiced)
 {
-	return std::find(std::begin(m_voiced), std::end(m_voiced), inVoiced) != std::end(m_voiced);
+	return m_voiced.find(inVoiced) != m_voiced.end();
 }
 
 std::string CapitaliseName(const std::string& inString) {
@@ -4,7 +4,10 @@
 //#include "clientlist.h"
 #include "../common/linked_list.h"
 #include "../common/timer.h"
+#include "../common/emu_versions.h"
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 class Client;
@@ -38,14 +41,14 @@ public:
 	bool ReadyToDelete() { return m_delete_timer.Check(); }
 	void SendOPList(Client *c);
 	void AddInvitee(const std::string &Invitee);
-	void RemoveInvitee(std::string Invitee);
-	bool IsInvitee(std::string Invitee);
+	void RemoveInvitee(const std::string &Invitee);
+	bool IsInvitee(const std::string &Invitee);
 	void AddModerator(const std::string &Moderator);
 	void RemoveModerator(const std::string &Moderator);
-	bool IsModerator(std::string Moderator);
+	bool IsModerator(const std::string &Moderator);
 	void AddVoice(const std::string &Voiced);
 	void RemoveVoice(const std::string &Voiced);
-	bool HasVoice(std::string Voiced);
+	bool HasVoice(const std::string &Voiced);
 	inline bool IsModerated() { return m_moderated; }
 	void SetModerated(bool inModerated);
 
@@ -64,11 +67,14 @@ private:
 
 	Timer m_delete_timer;
 
-	LinkedList<Client*> m_clients_in_channel;
+	// members are kept grouped by the client version they joined with so a message is converted
+	// and packed once per version, m_member_version remembers which group a member sits in
+	std::vector<Client*>                m_clients_in_channel[EQ::versions::ClientVersionCount];
+	std::unordered_map<Client*, uint32> m_member_version;
 
-	std::vector<std::string> m_moderators;
-	std::vector<std::string> m_invitees;
-	std::vector<std::string> m_voiced;
+	std::unordered_set<std::string> m_moderators;
+	std::unordered_set<std::string> m_invitees;
+	std::unordered_set<std::string> m_voiced;
 
 };
 
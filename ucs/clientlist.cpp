@@ -21,6 +21,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "../common/strings.h"
 #include "../common/eqemu_logsys.h"
 #include "../common/misc_functions.h"
+#include "../common/data_verification.h"
 
 #include "ucsconfig.h"
 #include "clientlist.h"
@@ -474,6 +475,8 @@ Clientlist::Clientlist(int ChatPort) {
 	chat_opts.daybreak_options.resend_delay_factor = RuleR(Network, ResendDelayFactor);
 	chat_opts.daybreak_options.resend_delay_min = RuleI(Network, ResendDelayMinMS);
 	chat_opts.daybreak_options.resend_delay_max = RuleI(Network, ResendDelayMaxMS);
+	chat_opts.daybreak_options.batched_io = RuleB(Network, BatchedUDP);
+	chat_opts.daybreak_options.batch_size = static_cast<size_t>(EQ::Clamp(RuleI(Network, BatchedUDPSize), 1, 1024));
 
 	chatsf = new EQ::Net::EQStreamManager(chat_opts);
 
@@ -1525,6 +1528,14 @@ void Client::SendChannelMessage(const std::string& ChannelName, const std::strin
 
 	if (!Sender) return;
 
+	auto outapp = MakeChannelMessagePacket(ChannelName, Message, Sender, UnderfootOrLater);
+
+	QueuePacket(outapp.get());
+}
+
+// built apart from any one recipient so a channel can queue the same packet to every member of a client version
+std::unique_ptr<EQApplicationPacket> Client::MakeChannelMessagePacket(const std::string& ChannelName, const std::string& Message, Client *Sender, bool UnderfootOrLater) {
+
 	std::string FQSenderName = WorldShortName + "." + Sender->GetName();
 
 	int PacketLength = ChannelName.length() + Message.length() + FQSenderName.length() + 3;
@@ -1532,7 +1543,7 @@ void Client::SendChannelMessage(const std::string& ChannelName, const std::strin
 	if (UnderfootOrLater)
 		PacketLength += 8;
 
-	auto outapp = new EQApplicationPacket(OP_ChannelMessage, PacketLength);
+	auto outapp = std::make_unique<EQApplicationPacket>(OP_ChannelMessage, PacketLength);
 
 	char *PacketBuffer = (char *)outapp->pBuffer;
 
@@ -1543,9 +1554,7 @@ void Client::SendChannelMessage(const std::string& ChannelName, const std::strin
 	if (UnderfootOrLater)
 		VARSTRUCT_ENCODE_STRING(PacketBuffer, "SPAM:0:");
 
-	QueuePacket(outapp);
-
-	safe_delete(outapp);
+	return outapp;
 }
 
 void Client::ToggleAnnounce(const std::string& State)
@@ -99,6 +99,7 @@ public:
 	void RemoveFromChannelList(ChatChannel *JoinedChannel);
 	void SendChannelMessage(std::string Message);
 	void SendChannelMessage(const std::string& ChannelName, const std::string& Message, Client *Sender);
+	static std::unique_ptr<EQApplicationPacket> MakeChannelMessagePacket(const std::string& ChannelName, const std::string& Message, Client *Sender, bool UnderfootOrLater);
 	void SendChannelMessageByNumber(std::string Message);
 	void SendChannelList();
 	void CloseConnection();
@@ -144,6 +145,7 @@ public:
 	void SetConnectionType(char c);
 	ConnectionType GetConnectionType() { return TypeOfConnection; }
 	EQ::versions::ClientVersion GetClientVersion() { return ClientVersion_; }
+	inline bool IsUnderfootOrLater() { return UnderfootOrLater; }
 
 	inline bool IsMailConnection() { return (TypeOfConnection == ConnectionTypeMail) || (TypeOfConnection == ConnectionTypeCombined); }
 	void SendNotification(int MailBoxNumber, const std::string& Subject, const std::string& From, int MessageID);
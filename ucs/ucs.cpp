@@ -75,6 +75,8 @@ void Shutdown() {
 	LogInfo("Shutting down...");
 	ChannelList->RemoveAllChannels();
 	g_Clientlist->CloseAllConnections();
+	database.StopAsyncPool();
+	LogSys.StopAsyncWriter();
 	LogSys.CloseFileLogs();
 }
 
@@ -90,6 +92,7 @@ void CatchSignal(int sig_num) {
 		LogInfo("In a signal handler loop and process is incapable of exiting properly, forcefully cleaning up");
 		ChannelList->RemoveAllChannels();
 		g_Clientlist->CloseAllConnections();
+		LogSys.StopAsyncWriter();
 		LogSys.CloseFileLogs();
 		std::exit(0);
 	}
@@ -139,11 +142,21 @@ int main() {
 		return 1;
 	}
 
+	database.SetPreparedStatementsEnabled(Config->DatabasePreparedStatements);
+
+	if (Config->DatabaseAsyncConnections > 0) {
+		database.StartAsyncPool(Config->DatabaseAsyncConnections);
+	}
+
 	LogSys.SetDatabase(&database)
 		->SetLogPath(path.GetLogPath())
 		->LoadLogDatabaseSettings()
 		->StartFileLogs();
 
+	if (Config->LogAsyncWriter) {
+		LogSys.StartAsyncWriter(Config->LogAsyncQueueSize, Config->LogAsyncBlockWhenFull);
+	}
+
 	player_event_logs.SetDatabase(&database)->Init();
 
 	char tmp[64];
@@ -223,6 +223,7 @@ foreach my $table_to_generate (@tables) {
     my $cereal_columns             = "";
     my $update_one_entries         = "";
     my $all_entries                = "";
+    my $bind_column_entries        = "";
     my $index                      = 0;
     my %table_data                 = ();
     my %table_primary_key          = ();
@@ -274,6 +275,9 @@ foreach my $table_to_generate (@tables) {
             $cereal_columns .= sprintf("\t\t\t\tCEREAL_NVP(%s),\n", $column_name_formatted);
         }
 
+        # prepared statement result binding
+        $bind_column_entries .= sprintf("\t\tb.Bind(e.%s);\n", $column_name_formatted);
+
         # new entity
         $default_entries .= sprintf("\t\te.%-${longest_column_length}s = %s;\n", $column_name_formatted, $default_value);
 
@@ -439,6 +443,7 @@ foreach my $table_to_generate (@tables) {
     chomp($insert_one_entries);
     chomp($insert_many_entries);
     chomp($all_entries);
+    chomp($bind_column_entries);
 
     use POSIX qw(strftime);
     my $generated_date = strftime "%b%e, %Y", localtime;
@@ -465,6 +470,7 @@ foreach my $table_to_generate (@tables) {
     $new_base_repository =~ s/\{\{INSERT_ONE_ENTRIES}}/$insert_one_entries/g;
     $new_base_repository =~ s/\{\{INSERT_MANY_ENTRIES}}/$insert_many_entries/g;
     $new_base_repository =~ s/\{\{ALL_ENTRIES}}/$all_entries/g;
+    $new_base_repository =~ s/\{\{BIND_COLUMN_ENTRIES}}/$bind_column_entries/g;
     $new_base_repository =~ s/\{\{GENERATED_DATE}}/$generated_date/g;
     $new_base_repository =~ s/\{\{ADDITIONAL_INCLUDES}}/$additional_includes/g;
 
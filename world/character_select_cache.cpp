@@ -0,0 +1,92 @@
+#include "character_select_cache.h"
+#include "../common/eq_packet.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/rulesys.h"
+#include <algorithm>
+
+EQApplicationPacket *CharacterSelectCache::Get(uint32 account_id, uint32 client_version_bit)
+{
+	if (RuleI(World, CharacterSelectCacheSeconds) <= 0) {
+		return nullptr;
+	}
+
+	auto account = m_accounts.find(account_id);
+	if (account == m_accounts.end()) {
+		m_misses++;
+		return nullptr;
+	}
+
+	auto entry = account->second.find(client_version_bit);
+	if (entry == account->second.end()) {
+		m_misses++;
+		return nullptr;
+	}
+
+	if (entry->second.expires <= time(nullptr)) {
+		account->second.erase(entry);
+		if (account->second.empty()) {
+			m_accounts.erase(account);
+		}
+
+		m_misses++;
+		return nullptr;
+	}
+
+	m_hits++;
+
+	return entry->second.app->Copy();
+}
+
+void CharacterSelectCache::Store(uint32 account_id, uint32 client_version_bit, const EQApplicationPacket *app)
+{
+	int ttl = RuleI(World, CharacterSelectCacheSeconds);
+	if (ttl <= 0 || !app) {
+		return;
+	}
+
+	time_t now = time(nullptr);
+
+	// expired entries are only found on a hit, sweep once the map has grown enough to be worth it
+	if (m_accounts.size() >= m_prune_at) {
+		PruneExpired(now);
+		m_prune_at = std::max(PRUNE_MINIMUM, m_accounts.size() * 2);
+	}
+
+	auto &e   = m_accounts[account_id][client_version_bit];
+	e.app     = std::unique_ptr<EQApplicationPacket>(app->Copy());
+	e.expires = now + ttl;
+}
+
+void CharacterSelectCache::Invalidate(uint32 account_id)
+{
+	if (m_accounts.erase(account_id)) {
+		LogDebug("Character select cache invalidated for account [{}]", account_id);
+	}
+}
+
+void CharacterSelectCache::Clear()
+{
+	m_accounts.clear();
+	m_prune_at = PRUNE_MINIMUM;
+}
+
+void CharacterSelectCache::PruneExpired(time_t now)
+{
+	for (auto account = m_accounts.begin(); account != m_accounts.end();) {
+		for (auto entry = account->second.begin(); entry != account->second.end();) {
+			if (entry->second.expires <= now) {
+				entry = account->second.erase(entry);
+			}
+			else {
+				++entry;
+			}
+		}
+
+		if (account->second.empty()) {
+			account = m_accounts.erase(account);
+		}
+		else {
+			++account;
+		}
+	}
+}
@@ -0,0 +1,52 @@
+#ifndef EQEMU_CHARACTER_SELECT_CACHE_H
+#define EQEMU_CHARACTER_SELECT_CACHE_H
+
+#include "../common/types.h"
+#include <ctime>
+#include <memory>
+#include <unordered_map>
+
+class EQApplicationPacket;
+
+/**
+ * Built OP_SendCharInfo packets per account and client version
+ *
+ * Entries are dropped when a zone reports one of the account's characters saved, when world creates,
+ * deletes or moves one, and otherwise after World:CharacterSelectCacheSeconds. Time and rule dependent
+ * buttons are set again by the caller on every hit
+ */
+class CharacterSelectCache {
+public:
+	CharacterSelectCache() : m_prune_at(PRUNE_MINIMUM), m_hits(0), m_misses(0) { }
+
+	// returns a copy the caller owns, nullptr when there is nothing usable cached
+	EQApplicationPacket *Get(uint32 account_id, uint32 client_version_bit);
+	void Store(uint32 account_id, uint32 client_version_bit, const EQApplicationPacket *app);
+	void Invalidate(uint32 account_id);
+	void Clear();
+
+	inline size_t GetAccountCount() const { return m_accounts.size(); }
+	inline uint64 GetHits() const { return m_hits; }
+	inline uint64 GetMisses() const { return m_misses; }
+
+private:
+	static constexpr size_t PRUNE_MINIMUM = 1024;
+
+	struct Entry {
+		std::unique_ptr<EQApplicationPacket> app;
+		time_t                               expires;
+	};
+
+	void PruneExpired(time_t now);
+
+	// account id -> client version bit -> packet, an account rarely has more than one version cached
+	std::unordered_map<uint32, std::unordered_map<uint32, Entry>> m_accounts;
+
+	size_t m_prune_at;
+	uint64 m_hits;
+	uint64 m_misses;
+};
+
+extern CharacterSelectCache character_select_cache;
+
+#endif
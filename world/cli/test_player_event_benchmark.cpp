@@ -0,0 +1,115 @@
+#include <cereal/archives/json.hpp>
+#include "../../common/events/player_event_logs.h"
+#include "../../common/json/json_archive_single_line.h"
+#include "../../common/net/packet.h"
+#include "../../common/timer.h"
+
+void WorldserverCLI::TestPlayerEventBenchmarkCommand(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Compares player event encoding throughput of the json and binary paths";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const int iterations = 1000000;
+
+	auto p = PlayerEvent::PlayerEvent{
+		.account_id = 1,
+		.account_name = "account",
+		.character_id = 1,
+		.character_name = "Character",
+		.guild_id = 1,
+		.guild_name = "Guild",
+		.zone_id = 202,
+		.zone_short_name = "poknowledge",
+		.zone_long_name = "The Plane of Knowledge",
+		.instance_id = 0,
+		.x = 100.0f,
+		.y = 200.0f,
+		.z = -10.0f,
+		.heading = 128.0f
+	};
+
+	auto e = PlayerEvent::LootItemEvent{
+		.item_id = 1001,
+		.item_name = "Cloth Cap",
+		.charges = 1,
+		.npc_id = 202001,
+		.corpse_name = "a_gnoll's_corpse"
+	};
+
+	BenchTimer benchmark;
+	size_t     bytes = 0;
+
+	// previous path, json rendered in zone for every event before shipping to world
+	for (int i = 0; i < iterations; i++) {
+		auto n = PlayerEventLogsRepository::NewEntity();
+		n.event_type_id = PlayerEvent::LOOT_ITEM;
+
+		std::stringstream ss;
+		{
+			cereal::JSONOutputArchiveSingleLine ar(ss);
+			e.serialize(ar);
+		}
+
+		n.event_type_name = PlayerEvent::EventName[PlayerEvent::LOOT_ITEM];
+		n.event_data      = Strings::Contains(ss.str(), "noop") ? "{}" : ss.str();
+		n.created_at      = std::time(nullptr);
+
+		EQ::Net::DynamicPacket dyn_pack;
+		dyn_pack.PutSerialize(0, PlayerEvent::PlayerEventContainer{.player_event = p, .player_event_log = n});
+		bytes += dyn_pack.Length();
+	}
+
+	double elapsed = benchmark.elapsed();
+	LogInfo(
+		"{:<20} | [{}] events per second [{}] average packet bytes [{}]",
+		"Json record",
+		Strings::Commify(iterations),
+		Strings::Commify(static_cast<int64>(iterations / elapsed)),
+		bytes / iterations
+	);
+
+	benchmark.reset();
+	bytes = 0;
+
+	for (int i = 0; i < iterations; i++) {
+		auto pack = player_event_logs.RecordEvent(PlayerEvent::LOOT_ITEM, p, e);
+		bytes += pack->size;
+	}
+
+	elapsed = benchmark.elapsed();
+	LogInfo(
+		"{:<20} | [{}] events per second [{}] average packet bytes [{}]",
+		"Binary record",
+		Strings::Commify(iterations),
+		Strings::Commify(static_cast<int64>(iterations / elapsed)),
+		bytes / iterations
+	);
+
+	// the json work that moved to the batch writer
+	std::stringstream ss;
+	{
+		cereal::BinaryOutputArchive ar(ss);
+		e.serialize(ar);
+	}
+
+	const std::string event_data = ss.str();
+
+	benchmark.reset();
+	bytes = 0;
+
+	for (int i = 0; i < iterations; i++) {
+		bytes += PlayerEventLogs::GetEventDataJson(PlayerEvent::LOOT_ITEM, event_data).size();
+	}
+
+	elapsed = benchmark.elapsed();
+	LogInfo(
+		"{:<20} | [{}] events per second [{}] average json bytes [{}]",
+		"Batch json render",
+		Strings::Commify(iterations),
+		Strings::Commify(static_cast<int64>(iterations / elapsed)),
+		bytes / iterations
+	);
+}
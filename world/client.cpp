@@ -51,6 +51,7 @@
 #include "../common/repositories/account_repository.h"
 #include "../common/repositories/player_event_logs_repository.h"
 #include "../common/events/player_event_logs.h"
+#include "character_select_cache.h"
 
 #include <iostream>
 #include <iomanip>
@@ -821,6 +822,7 @@ bool Client::HandleEnterWorldPacket(const EQApplicationPacket *app) {
 
 			if (home_enabled) {
 				zone_id = database.MoveCharacterToBind(charid, 4);
+				character_select_cache.Invalidate(GetAccountID());
 			} else {
 				LogInfo("[{}] is trying to go home before they're able.", char_name);
 				RecordPossibleHack("[MQGoHome] player tried to go home before they were able");
@@ -871,6 +873,7 @@ bool Client::HandleEnterWorldPacket(const EQApplicationPacket *app) {
 		) {
 			zone_id = database.MoveCharacterToInstanceSafeReturn(charid, zone_id, instance_id);
 			instance_id = 0;
+			character_select_cache.Invalidate(GetAccountID());
 		}
 	}
 
@@ -998,6 +1001,7 @@ bool Client::HandleDeleteCharacterPacket(const EQApplicationPacket *app) {
 	if(char_acct_id == GetAccountID()) {
 		LogInfo("Delete character: [{}]", (const char*)app->pBuffer);
 		database.DeleteCharacter((char *)app->pBuffer);
+		character_select_cache.Invalidate(GetAccountID());
 		SendCharInfo();
 	}
 
@@ -1334,6 +1338,7 @@ void Client::EnterWorld(bool TryBootup) {
 		{
 			instance_id = 0;
 			database.MoveCharacterToInstanceSafeReturn(GetCharID(), zone_id, instance_id);
+			character_select_cache.Invalidate(GetAccountID());
 			TellClientZoneUnavailable();
 			return;
 		}
@@ -1825,7 +1830,12 @@ bool Client::OPCharCreate(char *name, CharCreate_Struct *cc)
 
 	// now we give the pp and the inv we made to StoreCharacter
 	// to see if we can store it
-	if (!StoreCharacter(GetAccountID(), &pp, &inv)) {
+	bool stored = StoreCharacter(GetAccountID(), &pp, &inv);
+
+	// a failed store may still have left rows behind for the caller to delete
+	character_select_cache.Invalidate(GetAccountID());
+
+	if (!stored) {
 		LogInfo("Character creation failed: [{}]", pp.name);
 		return false;
 	}
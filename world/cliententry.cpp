@@ -130,6 +130,8 @@ void ClientListEntry::SetChar(uint32 iCharID, const char *iCharName)
 {
 	pcharid = iCharID;
 	strn0cpy(pname, iCharName, sizeof(pname));
+
+	client_list.CLEKeysChanged(this);
 }
 
 void ClientListEntry::SetOnline(CLE_Status iOnline)
@@ -216,6 +218,8 @@ void ClientListEntry::Update(ZoneServer *iZS, ServerClientList_Struct *scl, CLE_
 		pLSID = scl->LSAccountID;
 		strn0cpy(plskey, scl->lskey, sizeof(plskey));
 	}
+
+	client_list.CLEKeysChanged(this);
 	padmin         = scl->Admin;
 	plevel         = scl->level;
 	pclass_        = scl->class_;
@@ -287,6 +291,8 @@ void ClientListEntry::ClearVars(bool iAll)
 		safe_delete_array(elem);
 	}
 	tell_queue.clear();
+
+	client_list.CLEKeysChanged(this);
 }
 
 void ClientListEntry::Camp(ZoneServer *iZS)
@@ -357,6 +363,8 @@ bool ClientListEntry::CheckAuth(uint32 loginserver_account_id, const char *key_p
 			}
 			strn0cpy(paccountname, loginserver_account_name, sizeof(paccountname));
 			padmin = default_account_status;
+
+			client_list.CLEKeysChanged(this);
 		}
 		std::string lsworldadmin;
 		if (database.GetVariable("honorlsworldadmin", lsworldadmin)) {
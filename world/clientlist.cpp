@@ -50,6 +50,9 @@ ClientList::ClientList()
 }
 
 ClientList::~ClientList() {
+	for (auto cle : clientlist) {
+		delete cle;
+	}
 }
 
 void ClientList::Process() {
@@ -73,15 +76,11 @@ void ClientList::Process() {
 }
 
 void ClientList::CLERemoveZSRef(ZoneServer* iZS) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->Server() == iZS) {
-			iterator.GetData()->ClearServer(); // calling this before LeavingZone() makes CLE not update the number of players in a zone
-			iterator.GetData()->LeavingZone();
+	for (auto cle : clientlist) {
+		if (cle->Server() == iZS) {
+			cle->ClearServer(); // calling this before LeavingZone() makes CLE not update the number of players in a zone
+			cle->LeavingZone();
 		}
-		iterator.Advance();
 	}
 }
 
@@ -89,13 +88,12 @@ void ClientList::CLERemoveZSRef(ZoneServer* iZS) {
 
 void ClientList::GetCLEIP(uint32 in_ip) {
 	ClientListEntry* cle = nullptr;
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
 
 	int count = 0;
-	iterator.Reset();
+	size_t i = 0;
 
-	while (iterator.MoreElements()) {
-		cle = iterator.GetData();
+	while (i < clientlist.size()) {
+		cle = clientlist[i];
 		if (
 			cle->GetIP() == in_ip &&
 			(
@@ -126,7 +124,7 @@ void ClientList::GetCLEIP(uint32 in_ip) {
 					} else {
 						LogClientLogin("Disconnect: Account [{}] on IP [{}]", cle->LSName(), ip_string);
 						cle->SetOnline(CLE_Status::Offline);
-						iterator.RemoveCurrent();
+						RemoveCLE(i);
 						continue;
 					}
 				}
@@ -153,7 +151,7 @@ void ClientList::GetCLEIP(uint32 in_ip) {
 							} else {
 								LogClientLogin("Disconnect: Account [{}] on IP [{}]", cle->LSName(), ip_string);
 								cle->SetOnline(CLE_Status::Offline); // Remove the connection
-								iterator.RemoveCurrent();
+								RemoveCLE(i);
 								continue;
 							}
 						}
@@ -168,7 +166,7 @@ void ClientList::GetCLEIP(uint32 in_ip) {
 						} else {
 							LogClientLogin("Disconnect: Account [{}] on IP [{}]", cle->LSName(), ip_string);
 							cle->SetOnline(CLE_Status::Offline); // Remove the connection
-							iterator.RemoveCurrent();
+							RemoveCLE(i);
 							continue;
 						}
 					} else if (
@@ -182,7 +180,7 @@ void ClientList::GetCLEIP(uint32 in_ip) {
 						} else {
 							LogClientLogin("Disconnect: Account [{}] on IP [{}]", cle->LSName(), ip_string);
 							cle->SetOnline(CLE_Status::Offline); // Remove the connection
-							iterator.RemoveCurrent();
+							RemoveCLE(i);
 							continue;
 						}
 					}
@@ -190,17 +188,16 @@ void ClientList::GetCLEIP(uint32 in_ip) {
 			}
 		}
 
-		iterator.Advance();
+		i++;
 	}
 }
 
 void ClientList::DisconnectByIP(uint32 in_ip) {
 	ClientListEntry* cle = nullptr;
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	iterator.Reset();
+	size_t i = 0;
 
-	while (iterator.MoreElements()) {
-		cle = iterator.GetData();
+	while (i < clientlist.size()) {
+		cle = clientlist[i];
 		if (cle->GetIP() == in_ip) {
 			if (strlen(cle->name())) {
 				auto pack = new ServerPacket(ServerOP_KickPlayer, sizeof(ServerKickPlayer_Struct));
@@ -212,54 +209,38 @@ void ClientList::DisconnectByIP(uint32 in_ip) {
 				safe_delete(pack);
 			}
 			cle->SetOnline(CLE_Status::Offline);
-			iterator.RemoveCurrent();
+			RemoveCLE(i);
+			continue;
 		}
-		iterator.Advance();
+		i++;
 	}
 }
 
 ClientListEntry* ClientList::FindCharacter(const char* name) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-
-	iterator.Reset();
-	while(iterator.MoreElements())
-	{
-		if (strcasecmp(iterator.GetData()->name(), name) == 0) {
-			return iterator.GetData();
-		}
-		iterator.Advance();
+	if (!name || !name[0]) {
+		return nullptr;
 	}
-	return nullptr;
+
+	return m_cle_by_name.Find(Strings::ToLower(name));
 }
 
 ClientListEntry* ClientList::FindCLEByAccountID(uint32 iAccID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->AccountID() == iAccID) {
-			return iterator.GetData();
-		}
-		iterator.Advance();
+	if (!iAccID) {
+		return nullptr;
 	}
-	return nullptr;
+
+	return m_cle_by_account_id.Find(iAccID);
 }
 
 ClientListEntry* ClientList::FindCLEByCharacterID(uint32 iCharID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->CharID() == iCharID) {
-			return iterator.GetData();
-		}
-		iterator.Advance();
+	if (!iCharID) {
+		return nullptr;
 	}
-	return nullptr;
+
+	return m_cle_by_char_id.Find(iCharID);
 }
 
 void ClientList::SendCLEList(const int16& admin, const char* to, WorldTCPConnection* connection, const char* iName) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
 	int x = 0, y = 0;
 	int namestrlen = iName == 0 ? 0 : strlen(iName);
 	bool addnewline = false;
@@ -270,9 +251,7 @@ void ClientList::SendCLEList(const int16& admin, const char* to, WorldTCPConnect
 		strcpy(newline, "^");
 
 	auto out = fmt::memory_buffer();
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		ClientListEntry* cle = iterator.GetData();
+	for (auto cle : clientlist) {
 		if (admin >= cle->Admin() && (iName == 0 || namestrlen == 0 || strncasecmp(cle->name(), iName, namestrlen) == 0 || strncasecmp(cle->AccountName(), iName, namestrlen) == 0 || strncasecmp(cle->LSName(), iName, namestrlen) == 0)) {
 			struct in_addr in;
 			in.s_addr = cle->GetIP();
@@ -300,7 +279,6 @@ void ClientList::SendCLEList(const int16& admin, const char* to, WorldTCPConnect
 			}
 			y++;
 		}
-		iterator.Advance();
 		x++;
 	}
 	fmt::format_to(std::back_inserter(out), "{}{} CLEs in memory. {} CLEs listed. numplayers = {}.", newline, x, y, numplayers);
@@ -317,42 +295,109 @@ void ClientList::SendCLEList(const int16& admin, const char* to, WorldTCPConnect
 void ClientList::CLEAdd(uint32 iLSID, const char *iLoginServerName, const char* iLoginName, const char* iLoginKey, int16 iWorldAdmin, uint32 ip, uint8 local) {
 	auto tmp = new ClientListEntry(GetNextCLEID(), iLSID, iLoginServerName, iLoginName, iLoginKey, iWorldAdmin, ip, local);
 
-	clientlist.Append(tmp);
+	AddCLE(tmp);
 }
 
-void ClientList::CLCheckStale() {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+void ClientList::AddCLE(ClientListEntry* cle) {
+	clientlist.push_back(cle);
 
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->CheckStale()) {
-			iterator.RemoveCurrent();
+	auto &indexed = m_cle_by_id[cle->GetID()];
+	indexed.cle        = cle;
+	indexed.name       = Strings::ToLower(cle->name());
+	indexed.account_id = cle->AccountID();
+	indexed.char_id    = cle->CharID();
+
+	if (!indexed.name.empty()) {
+		m_cle_by_name.Add(indexed.name, cle);
+	}
+	if (indexed.account_id) {
+		m_cle_by_account_id.Add(indexed.account_id, cle);
+	}
+	if (indexed.char_id) {
+		m_cle_by_char_id.Add(indexed.char_id, cle);
+	}
+}
+
+void ClientList::RemoveCLE(size_t index) {
+	ClientListEntry* cle = clientlist[index];
+
+	auto iter = m_cle_by_id.find(cle->GetID());
+	if (iter != m_cle_by_id.end()) {
+		m_cle_by_name.Remove(iter->second.name, cle);
+		m_cle_by_account_id.Remove(iter->second.account_id, cle);
+		m_cle_by_char_id.Remove(iter->second.char_id, cle);
+		m_cle_by_id.erase(iter);
+	}
+
+	clientlist[index] = clientlist.back();
+	clientlist.pop_back();
+
+	// unindexed before the delete, the destructor clears its own keys on the way out
+	delete cle;
+}
+
+void ClientList::CLEKeysChanged(ClientListEntry* cle) {
+	auto iter = m_cle_by_id.find(cle->GetID());
+	if (iter == m_cle_by_id.end() || iter->second.cle != cle) {
+		return;
+	}
+
+	auto &indexed = iter->second;
+
+	std::string name = Strings::ToLower(cle->name());
+	if (name != indexed.name) {
+		m_cle_by_name.Remove(indexed.name, cle);
+		indexed.name = name;
+		if (!indexed.name.empty()) {
+			m_cle_by_name.Add(indexed.name, cle);
+		}
+	}
+
+	if (cle->AccountID() != indexed.account_id) {
+		m_cle_by_account_id.Remove(indexed.account_id, cle);
+		indexed.account_id = cle->AccountID();
+		if (indexed.account_id) {
+			m_cle_by_account_id.Add(indexed.account_id, cle);
+		}
+	}
+
+	if (cle->CharID() != indexed.char_id) {
+		m_cle_by_char_id.Remove(indexed.char_id, cle);
+		indexed.char_id = cle->CharID();
+		if (indexed.char_id) {
+			m_cle_by_char_id.Add(indexed.char_id, cle);
+		}
+	}
+}
+
+void ClientList::CLCheckStale() {
+	size_t i = 0;
+	while (i < clientlist.size()) {
+		if (clientlist[i]->CheckStale()) {
+			RemoveCLE(i);
 		}
 		else
-			iterator.Advance();
+			i++;
 	}
 }
 
 void ClientList::ClientUpdate(ZoneServer *zoneserver, ServerClientList_Struct *scl)
 {
-	LinkedListIterator<ClientListEntry *> iterator(clientlist);
-	ClientListEntry                       *cle;
-	iterator.Reset();
-	while (iterator.MoreElements()) {
-		if (iterator.GetData()->GetID() == scl->wid) {
-			cle = iterator.GetData();
-			if (scl->remove == 2) {
-				cle->LeavingZone(zoneserver, CLE_Status::Offline);
-			}
-			else if (scl->remove == 1) {
-				cle->LeavingZone(zoneserver, CLE_Status::Zoning);
-			}
-			else {
-				cle->Update(zoneserver, scl);
-			}
-			return;
+	ClientListEntry *cle;
+
+	auto iter = m_cle_by_id.find(scl->wid);
+	if (iter != m_cle_by_id.end()) {
+		cle = iter->second.cle;
+		if (scl->remove == 2) {
+			cle->LeavingZone(zoneserver, CLE_Status::Offline);
 		}
-		iterator.Advance();
+		else if (scl->remove == 1) {
+			cle->LeavingZone(zoneserver, CLE_Status::Zoning);
+		}
+		else {
+			cle->Update(zoneserver, scl);
+		}
+		return;
 	}
 	if (scl->remove == 2) {
 		cle = new ClientListEntry(GetNextCLEID(), zoneserver, scl, CLE_Status::Online);
@@ -418,34 +463,25 @@ void ClientList::ClientUpdate(ZoneServer *zoneserver, ServerClientList_Struct *s
 		scl->LFGComments
 	);
 
-	clientlist.Insert(cle);
+	AddCLE(cle);
 	zoneserver->ChangeWID(scl->charid, cle->GetID());
 }
 
 void ClientList::CLEKeepAlive(uint32 numupdates, uint32* wid) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	uint32 i;
-
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		for (i=0; i<numupdates; i++) {
-			if (wid[i] == iterator.GetData()->GetID())
-				iterator.GetData()->KeepAlive();
+	for (uint32 i = 0; i < numupdates; i++) {
+		auto iter = m_cle_by_id.find(wid[i]);
+		if (iter != m_cle_by_id.end()) {
+			iter->second.cle->KeepAlive();
 		}
-		iterator.Advance();
 	}
 }
 
 ClientListEntry *ClientList::CheckAuth(uint32 iLSID, const char *iKey)
 {
-	LinkedListIterator<ClientListEntry *> iterator(clientlist);
-
-	iterator.Reset();
-	while (iterator.MoreElements()) {
-		if (iterator.GetData()->CheckAuth(iLSID, iKey)) {
-			return iterator.GetData();
+	for (auto cle : clientlist) {
+		if (cle->CheckAuth(iLSID, iKey)) {
+			return cle;
 		}
-		iterator.Advance();
 	}
 
 	return 0;
@@ -464,26 +500,15 @@ void ClientList::SendOnlineGuildMembers(uint32 FromID, uint32 GuildID)
 		return;
 	}
 
-	LinkedListIterator<ClientListEntry*> Iterator(clientlist);
-
-	Iterator.Reset();
-
-	while(Iterator.MoreElements())
+	for (auto CLE : clientlist)
 	{
-		ClientListEntry* CLE = Iterator.GetData();
-
 		if(CLE && (CLE->GuildID() == GuildID))
 		{
 			PacketLength += (strlen(CLE->name()) + 5);
 			++Count;
 		}
-
-		Iterator.Advance();
-
 	}
 
-	Iterator.Reset();
-
 	auto pack = new ServerPacket(ServerOP_OnlineGuildMembersResponse, PacketLength);
 
 	char *Buffer = (char *)pack->pBuffer;
@@ -491,17 +516,13 @@ void ClientList::SendOnlineGuildMembers(uint32 FromID, uint32 GuildID)
 	VARSTRUCT_ENCODE_TYPE(uint32, Buffer, FromID);
 	VARSTRUCT_ENCODE_TYPE(uint32, Buffer, Count);
 
-	while(Iterator.MoreElements())
+	for (auto CLE : clientlist)
 	{
-		ClientListEntry* CLE = Iterator.GetData();
-
 		if(CLE && (CLE->GuildID() == GuildID))
 		{
 			VARSTRUCT_ENCODE_STRING(Buffer, CLE->name());
 			VARSTRUCT_ENCODE_TYPE(uint32, Buffer, CLE->zone());
 		}
-
-		Iterator.Advance();
 	}
 	zoneserver_list.SendPacket(from->zone(), from->instance(), pack);
 	safe_delete(pack);
@@ -510,10 +531,6 @@ void ClientList::SendOnlineGuildMembers(uint32 FromID, uint32 GuildID)
 
 void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_Struct* whom, WorldTCPConnection* connection) {
 	try{
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	LinkedListIterator<ClientListEntry*> countclients(clientlist);
-	ClientListEntry* cle = 0;
-	ClientListEntry* countcle = 0;
 	//char tmpgm[25] = "";
 	//char accinfo[150] = "";
 	char line[300] = "";
@@ -551,9 +568,7 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 
 	uint32 totalusers=0;
 	uint32 totallength=0;
-	countclients.Reset();
-	while(countclients.MoreElements()){
-		countcle = countclients.GetData();
+	for (auto countcle : clientlist) {
 		const char* tmpZone = ZoneName(countcle->zone());
 		if (
 	(countcle->Online() >= CLE_Status::Zoning) &&
@@ -582,7 +597,6 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 					totallength=totallength+strlen(countcle->name())+strlen(guild_mgr.GetGuildName(countcle->GuildID()))+5;
 			}
 		}
-		countclients.Advance();
 	}
 	uint32 plid=fromid;
 	uint32 playerineqstring=5001;
@@ -629,10 +643,8 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 	memcpy(bufptr,&totalusers, sizeof(uint32));
 	bufptr+=sizeof(uint32);
 
-	iterator.Reset();
 	int idx=-1;
-	while(iterator.MoreElements()) {
-		cle = iterator.GetData();
+	for (auto cle : clientlist) {
 		const char* tmpZone = ZoneName(cle->zone());
 
 		if (
@@ -655,7 +667,6 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 			uint32 rankstring = 0xFFFFFFFF;
 				if((cle->Anon()==1 && cle->GetGM() && cle->Admin()>admin) || (idx>=20 && admin < AccountStatus::GMAdmin)){ //hide gms that are anon from lesser gms and normal players, cut off at 20
 					rankstring = 0;
-					iterator.Advance();
 					continue;
 				} else if (cle->GetGM()) {
 					if (cle->Admin() >= AccountStatus::GMImpossible)
@@ -770,7 +781,6 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 	memcpy(bufptr,&ending, sizeof(uint32));
 	bufptr+=sizeof(uint32);
 		}
-		iterator.Advance();
 	}
 	//zoneserver_list.SendPacket(pack2); // NO NO NO WHY WOULD YOU SEND IT TO EVERY ZONE SERVER?!?
 	SendPacket(to,pack2);
@@ -929,15 +939,12 @@ void ClientList::SendLFGMatches(ServerLFGMatchesRequest_Struct *smrs) {
 
 	// Send back matches when someone searches player's Looking For A Group.
 
-	LinkedListIterator<ClientListEntry*> Iterator(clientlist);
 	ClientListEntry* CLE = 0;
 	int Matches = 0;
 
-	Iterator.Reset();
-
 	// We run the ClientList twice. The first time is to determine how big the outgoing packet needs to be.
-	while(Iterator.MoreElements()) {
-		CLE = Iterator.GetData();
+	for (size_t i = 0; i < clientlist.size(); i++) {
+		CLE = clientlist[i];
 		if(CLE->LFG()) {
 			unsigned int BitMask = 1 << CLE->class_();
 			// First we check that the player meets the level and class criteria of the person
@@ -955,7 +962,6 @@ void ClientList::SendLFGMatches(ServerLFGMatchesRequest_Struct *smrs) {
 								(smrs->QuerierLevel <= CLE->GetLFGToLevel())))
 					Matches++;
 		}
-		Iterator.Advance();
 	}
 	auto Pack = new ServerPacket(ServerOP_LFGMatches, (sizeof(ServerLFGMatchesResponse_Struct) * Matches) + 4);
 
@@ -965,11 +971,9 @@ void ClientList::SendLFGMatches(ServerLFGMatchesRequest_Struct *smrs) {
 
 	ServerLFGMatchesResponse_Struct* Buffer = (ServerLFGMatchesResponse_Struct*)Buf;
 
-	Iterator.Reset();
-
 	if(Matches) {
-		while(Iterator.MoreElements() && (Matches > 0)) {
-			CLE = Iterator.GetData();
+		for (size_t i = 0; i < clientlist.size() && (Matches > 0); i++) {
+			CLE = clientlist[i];
 			if(CLE->LFG()) {
 				unsigned int BitMask = 1 << CLE->class_();
 				if((CLE->level() >= smrs->FromLevel) && (CLE->level() <= smrs->ToLevel) &&
@@ -988,7 +992,6 @@ void ClientList::SendLFGMatches(ServerLFGMatchesRequest_Struct *smrs) {
 					Buffer++;
 				}
 			}
-			Iterator.Advance();
 		}
 	}
 	SendPacket(smrs->FromName,Pack);
@@ -996,8 +999,6 @@ void ClientList::SendLFGMatches(ServerLFGMatchesRequest_Struct *smrs) {
 }
 
 void ClientList::ConsoleSendWhoAll(const char* to, int16 admin, Who_All_Struct* whom, WorldTCPConnection* connection) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	ClientListEntry* cle = 0;
 	char tmpgm[25] = "";
 	char accinfo[150] = "";
 	char line[300] = "";
@@ -1014,9 +1015,7 @@ void ClientList::ConsoleSendWhoAll(const char* to, int16 admin, Who_All_Struct*
 		fmt::format_to(std::back_inserter(out), "\r\n");
 	else
 		fmt::format_to(std::back_inserter(out), "\n");
-	iterator.Reset();
-	while (iterator.MoreElements()) {
-		cle = iterator.GetData();
+	for (auto cle : clientlist) {
 		const char* tmpZone = ZoneName(cle->zone());
 		if (
 			(cle->Online() >= CLE_Status::Zoning)
@@ -1090,7 +1089,6 @@ void ClientList::ConsoleSendWhoAll(const char* to, int16 admin, Who_All_Struct*
 				if (admin >= AccountStatus::GMAdmin && admin >= cle->Admin())
 					sprintf(line, "  %s[RolePlay %i %s] %s (%s)%s zone: %s%s%s", tmpgm, cle->level(), GetClassIDName(cle->class_(), cle->level()), cle->name(), GetRaceIDName(cle->race()), tmpguild, tmpZone, LFG, accinfo);
 				else if (cle->Admin() >= AccountStatus::QuestTroupe && admin < AccountStatus::QuestTroupe && cle->GetGM()) {
-					iterator.Advance();
 					continue;
 				}
 				else
@@ -1100,7 +1098,6 @@ void ClientList::ConsoleSendWhoAll(const char* to, int16 admin, Who_All_Struct*
 				if (admin >= AccountStatus::GMAdmin && admin >= cle->Admin())
 					sprintf(line, "  %s[ANON %i %s] %s (%s)%s zone: %s%s%s", tmpgm, cle->level(), GetClassIDName(cle->class_(), cle->level()), cle->name(), GetRaceIDName(cle->race()), tmpguild, tmpZone, LFG, accinfo);
 				else if (cle->Admin() >= AccountStatus::QuestTroupe && cle->GetGM()) {
-					iterator.Advance();
 					continue;
 				}
 				else
@@ -1130,7 +1127,6 @@ void ClientList::ConsoleSendWhoAll(const char* to, int16 admin, Who_All_Struct*
 			if (x >= 20 && admin < AccountStatus::QuestTroupe)
 				break;
 		}
-		iterator.Advance();
 	}
 
 	if (x >= 20 && admin < AccountStatus::QuestTroupe)
@@ -1251,26 +1247,20 @@ bool ClientList::SendPacket(const char* to, ServerPacket* pack) {
 }
 
 void ClientList::UpdateClientGuild(uint32 char_id, uint32 guild_id) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+	if (!char_id) {
+		return;
+	}
 
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		ClientListEntry *cle = iterator.GetData();
-		if (cle->CharID() == char_id) {
-			cle->SetGuild(guild_id);
-		}
-		iterator.Advance();
+	for (auto cle : m_cle_by_char_id.FindAll(char_id)) {
+		cle->SetGuild(guild_id);
 	}
 }
 
 bool ClientList::IsAccountInGame(uint32 iLSID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	iterator.Reset();
-	while (iterator.MoreElements()) {
-		if (iterator.GetData()->LSID() == iLSID && iterator.GetData()->Online() == CLE_Status::InZone) {
+	for (auto cle : clientlist) {
+		if (cle->LSID() == iLSID && cle->Online() == CLE_Status::InZone) {
 			return true;
 		}
-		iterator.Advance();
 	}
 
 	return false;
@@ -1281,22 +1271,13 @@ int ClientList::GetClientCount() {
 }
 
 void ClientList::GetClients(const char *zone_name, std::vector<ClientListEntry *> &res) {
-	LinkedListIterator<ClientListEntry *> iterator(clientlist);
-	iterator.Reset();
-
 	if(zone_name[0] == '\0') {
-		while(iterator.MoreElements()) {
-			ClientListEntry* tmp = iterator.GetData();
-			res.push_back(tmp);
-			iterator.Advance();
-		}
+		res.insert(res.end(), clientlist.begin(), clientlist.end());
 	} else {
 		uint32 zoneid = ZoneID(zone_name);
-		while(iterator.MoreElements()) {
-			ClientListEntry* tmp = iterator.GetData();
+		for (auto tmp : clientlist) {
 			if(tmp->zone() == zoneid)
 				res.push_back(tmp);
-			iterator.Advance();
 		}
 	}
 }
@@ -1313,10 +1294,7 @@ void ClientList::SendClientVersionSummary(const char *Name)
 		{ EQ::versions::ClientVersion::RoF2, 0 }
 	};
 
-	LinkedListIterator<ClientListEntry*> Iterator(clientlist);
-	Iterator.Reset();
-	while (Iterator.MoreElements()) {
-		auto CLE = Iterator.GetData();
+	for (auto CLE : clientlist) {
 		if (CLE && CLE->zone()) {
 			auto client_version = CLE->GetClientVersion();
 			if (
@@ -1330,8 +1308,6 @@ void ClientList::SendClientVersionSummary(const char *Name)
 				unique_ips.push_back(CLE->GetIP());
 			}
 		}
-
-		Iterator.Advance();
 	}
 
 	uint32 total_clients = (
@@ -1446,14 +1422,8 @@ void ClientList::OnTick(EQ::Timer *t)
 	out["event"] = "EQW::ClientUpdate";
 	out["data"] = Json::Value();
 
-	LinkedListIterator<ClientListEntry*> Iterator(clientlist);
-
-	Iterator.Reset();
-
-	while (Iterator.MoreElements())
+	for (auto cle : clientlist)
 	{
-		ClientListEntry* cle = Iterator.GetData();
-
 		Json::Value outclient;
 
 		outclient["Online"] = cle->Online();
@@ -1514,8 +1484,6 @@ void ClientList::OnTick(EQ::Timer *t)
 		outclient["LFGComments"] = cle->GetLFGComments();
 		outclient["ClientVersion"] = cle->GetClientVersion();
 		out["data"].append(outclient);
-
-		Iterator.Advance();
 	}
 
 	web_interface.SendEvent(out);
@@ -1526,13 +1494,7 @@ void ClientList::OnTick(EQ::Timer *t)
  */
 void ClientList::GetClientList(Json::Value &response)
 {
-	LinkedListIterator<ClientListEntry *> Iterator(clientlist);
-
-	Iterator.Reset();
-
-	while (Iterator.MoreElements()) {
-		ClientListEntry *cle = Iterator.GetData();
-
+	for (auto cle : clientlist) {
 		Json::Value row;
 
 		row["account_id"]             = cle->AccountID();
@@ -1591,8 +1553,6 @@ void ClientList::GetClientList(Json::Value &response)
 		row["zone"]             = cle->zone();
 
 		response.append(row);
-
-		Iterator.Advance();
 	}
 }
 
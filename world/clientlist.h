@@ -9,8 +9,10 @@
 #include "../common/servertalk.h"
 #include "../common/event/timer.h"
 #include "../common/net/console_server_connection.h"
+#include "lookup_index.h"
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 class Client;
 class ZoneServer;
@@ -58,6 +60,7 @@ public:
 	void	CLCheckStale();
 	void	CLEKeepAlive(uint32 numupdates, uint32* wid);
 	void	CLEAdd(uint32 iLSID, const char* iLoginServerName, const char* iLoginName, const char* iLoginKey, int16 iWorldAdmin = AccountStatus::Player, uint32 ip = 0, uint8 local=0);
+	void	CLEKeysChanged(ClientListEntry* cle); // called by a cle after its name, account or character changes
 	void	UpdateClientGuild(uint32 char_id, uint32 guild_id);
 	bool    IsAccountInGame(uint32 iLSID);
 
@@ -77,13 +80,29 @@ private:
 	void OnTick(EQ::Timer *t);
 	inline uint32 GetNextCLEID() { return NextCLEID++; }
 
+	void AddCLE(ClientListEntry* cle);
+	void RemoveCLE(size_t index); // moves the last cle into index, loops removing while iterating should not advance
+
 	//this is the list of people actively connected to zone
 	LinkedList<Client*> list;
 
 	//this is the list of people in any zone, not nescesarily connected to world
 	Timer	CLStale_timer;
 	uint32 NextCLEID;
-	LinkedList<ClientListEntry *> clientlist;
+	std::vector<ClientListEntry *> clientlist;
+
+	// the keys each cle is filed under, so a change can be moved to the right bucket
+	struct IndexedCLE {
+		ClientListEntry* cle;
+		std::string      name;
+		uint32           account_id;
+		uint32           char_id;
+	};
+
+	std::unordered_map<uint32, IndexedCLE>  m_cle_by_id;
+	LookupIndex<std::string, ClientListEntry> m_cle_by_name; // lower case
+	LookupIndex<uint32, ClientListEntry>      m_cle_by_account_id;
+	LookupIndex<uint32, ClientListEntry>      m_cle_by_char_id;
 
 
 	std::unique_ptr<EQ::Timer> m_tick;
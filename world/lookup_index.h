@@ -0,0 +1,59 @@
+#ifndef WORLD_LOOKUP_INDEX_H
+#define WORLD_LOOKUP_INDEX_H
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Secondary hash index over entries owned by some other container
+ *
+ * Keys are not unique, every entry sharing a key is kept in the order it was added and Find returns the
+ * first. The owner adds and removes entries as their keys change, nothing here looks at the entry itself
+ */
+template <typename Key, typename Value>
+class LookupIndex {
+public:
+	void Add(const Key &key, Value *value)
+	{
+		m_buckets[key].push_back(value);
+	}
+
+	void Remove(const Key &key, Value *value)
+	{
+		auto iter = m_buckets.find(key);
+		if (iter == m_buckets.end()) {
+			return;
+		}
+
+		auto &bucket = iter->second;
+		bucket.erase(std::remove(bucket.begin(), bucket.end(), value), bucket.end());
+		if (bucket.empty()) {
+			m_buckets.erase(iter);
+		}
+	}
+
+	Value *Find(const Key &key) const
+	{
+		auto iter = m_buckets.find(key);
+		return iter != m_buckets.end() ? iter->second.front() : nullptr;
+	}
+
+	const std::vector<Value *> &FindAll(const Key &key) const
+	{
+		static const std::vector<Value *> empty;
+
+		auto iter = m_buckets.find(key);
+		return iter != m_buckets.end() ? iter->second : empty;
+	}
+
+	void Clear()
+	{
+		m_buckets.clear();
+	}
+
+private:
+	std::unordered_map<Key, std::vector<Value *>> m_buckets;
+};
+
+#endif
@@ -85,6 +85,8 @@
 #include "world_boot.h"
 #include "../common/path_manager.h"
 #include "../common/events/player_event_logs.h"
+#include "../common/data_verification.h"
+#include "character_select_cache.h"
 
 
 ZoneStore           zone_store;
@@ -108,6 +110,7 @@ WorldContentService content_service;
 WebInterfaceList    web_interface;
 PathManager         path;
 PlayerEventLogs     player_event_logs;
+CharacterSelectCache character_select_cache;
 
 void CatchSignal(int sig_num);
 
@@ -335,6 +338,8 @@ int main(int argc, char **argv)
 	opts.daybreak_options.resend_delay_min    = RuleI(Network, ResendDelayMinMS);
 	opts.daybreak_options.resend_delay_max    = RuleI(Network, ResendDelayMaxMS);
 	opts.daybreak_options.outgoing_data_rate  = RuleR(Network, ClientDataRate);
+	opts.daybreak_options.batched_io          = RuleB(Network, BatchedUDP);
+	opts.daybreak_options.batch_size          = static_cast<size_t>(EQ::Clamp(RuleI(Network, BatchedUDPSize), 1, 1024));
 
 	EQ::Net::EQStreamManager eqsm(opts);
 
@@ -463,10 +468,13 @@ int main(int argc, char **argv)
 	zoneserver_list.KillAll();
 	LogInfo("Zone (TCP) listener stopped");
 	LogInfo("Signaling HTTP service to stop");
-	LogSys.CloseFileLogs();
 
+	// the db async pool drains jobs that still log, so it goes before the log writer
 	WorldBoot::Shutdown();
 
+	LogSys.StopAsyncWriter();
+	LogSys.CloseFileLogs();
+
 	return 0;
 }
 
@@ -161,6 +161,13 @@ bool WorldBoot::LoadDatabaseConnections()
 		content_db.SetMutex(mutex);
 	}
 
+	database.SetPreparedStatementsEnabled(c->DatabasePreparedStatements);
+	content_db.SetPreparedStatementsEnabled(c->DatabasePreparedStatements);
+
+	if (c->DatabaseAsyncConnections > 0) {
+		database.StartAsyncPool(c->DatabaseAsyncConnections);
+	}
+
 	return true;
 }
 
@@ -302,6 +309,10 @@ bool WorldBoot::DatabaseLoadRoutines(int argc, char **argv)
 
 	logging->StartFileLogs();
 
+	if (c->LogAsyncWriter) {
+		logging->StartAsyncWriter(c->LogAsyncQueueSize, c->LogAsyncBlockWhenFull);
+	}
+
 	LogInfo("Loading variables");
 	database.LoadVariables();
 
@@ -650,6 +661,7 @@ void WorldBoot::CheckForPossibleConfigurationIssues()
 
 void WorldBoot::Shutdown()
 {
+	database.StopAsyncPool();
 	safe_delete(mutex);
 }
 
@@ -34,6 +34,7 @@ void WorldserverCLI::CommandHandler(int argc, char **argv)
 	function_map["test:repository2"]            = &WorldserverCLI::TestRepository2;
 	function_map["test:db-concurrency"]         = &WorldserverCLI::TestDatabaseConcurrency;
 	function_map["test:string-benchmark"]       = &WorldserverCLI::TestStringBenchmarkCommand;
+	function_map["test:player-event-benchmark"] = &WorldserverCLI::TestPlayerEventBenchmarkCommand;
 
 	EQEmuCommand::HandleMenu(function_map, cmd, argc, argv);
 }
@@ -55,4 +56,5 @@ void WorldserverCLI::CommandHandler(int argc, char **argv)
 #include "cli/test_repository.cpp"
 #include "cli/test_repository_2.cpp"
 #include "cli/test_string_benchmark.cpp"
+#include "cli/test_player_event_benchmark.cpp"
 #include "cli/version.cpp"
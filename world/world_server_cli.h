@@ -25,6 +25,7 @@ public:
 	static void TestRepository2(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestDatabaseConcurrency(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestStringBenchmarkCommand(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void TestPlayerEventBenchmarkCommand(int argc, char **argv, argh::parser &cmd, std::string &description);
 };
 
 
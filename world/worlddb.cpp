@@ -23,11 +23,13 @@
 #include "../common/rulesys.h"
 #include <iostream>
 #include <cstdlib>
+#include <unordered_map>
 #include <vector>
 #include "sof_char_create_data.h"
 #include "../common/repositories/character_instance_safereturns_repository.h"
 #include "../common/repositories/criteria/content_filter_criteria.h"
 #include "../common/zone_store.h"
+#include "character_select_cache.h"
 
 WorldDatabase database;
 WorldDatabase content_db;
@@ -36,12 +38,28 @@ extern std::vector<RaceClassCombos> character_create_race_class_combos;
 
 
 /**
+ * Character select is built from a fixed set of queries per account, the character rows and then
+ * the binds, tints and worn items of all of them at once. The finished packet is kept in
+ * character_select_cache until a zone reports one of the account's characters saved or world
+ * creates or deletes one
+ *
  * @param account_id
  * @param out_app
  * @param client_version_bit
  */
 void WorldDatabase::GetCharSelectInfo(uint32 account_id, EQApplicationPacket **out_app, uint32 client_version_bit)
 {
+	*out_app = character_select_cache.Get(account_id, client_version_bit);
+	if (*out_app) {
+		auto cs = (CharacterSelect_Struct *) (*out_app)->pBuffer;
+		auto e  = (CharacterSelectEntry_Struct *) ((*out_app)->pBuffer + sizeof(CharacterSelect_Struct));
+		for (uint32 i = 0; i < cs->CharCount; ++i) {
+			SetCharSelectButtons(&e[i]);
+		}
+
+		return;
+	}
+
 	EQ::versions::ClientVersion
 		   client_version  = EQ::versions::ConvertClientVersionBitToClientVersion(client_version_bit);
 	size_t character_limit = EQ::constants::StaticLookup(client_version)->CharacterCreationLimit;
@@ -98,9 +116,116 @@ void WorldDatabase::GetCharSelectInfo(uint32 account_id, EQApplicationPacket **o
 		CharacterSelect_Struct *cs = (CharacterSelect_Struct *) (*out_app)->pBuffer;
 		cs->CharCount = 0;
 		cs->TotalChars = character_limit;
+
+		if (results.Success()) {
+			character_select_cache.Store(account_id, client_version_bit, *out_app);
+		}
+
 		return;
 	}
 
+	struct CharSelectBinds {
+		uint32     count    = 0;
+		bool       has_home = false;
+		bool       has_bind = false;
+		BindStruct home     = {};
+	};
+
+	std::vector<std::string>                           character_ids;
+	std::unordered_map<uint32, CharSelectBinds>        binds;
+	std::unordered_map<uint32, EQ::TintProfile>        tints;
+	std::unordered_map<uint32, EQ::InventoryProfile>   inventories;
+
+	for (auto row = results.begin(); row != results.end(); ++row) {
+		uint32 character_id = Strings::ToUnsignedInt(row[0]);
+
+		character_ids.emplace_back(row[0]);
+		binds[character_id];
+		memset(&tints[character_id], 0, sizeof(EQ::TintProfile));
+
+		auto &inventory_profile = inventories[character_id];
+		inventory_profile.SetInventoryVersion(client_version);
+		inventory_profile.SetGMInventory(true); // charsel can not interact with items..but, no harm in setting to full expansion support
+	}
+
+	const std::string character_id_list = Strings::Join(character_ids, ",");
+
+	/**
+	 * Binds
+	 */
+	auto results_bind = database.QueryDatabase(
+		fmt::format(
+			SQL(
+				SELECT
+				`id`, `zone_id`, `instance_id`, `x`, `y`, `z`, `heading`, `slot`
+				FROM
+				`character_bind`
+				WHERE
+				`id` IN ({})
+			),
+			character_id_list
+		)
+	);
+	for (auto row_b = results_bind.begin(); row_b != results_bind.end(); ++row_b) {
+		auto iter = binds.find(Strings::ToUnsignedInt(row_b[0]));
+		if (iter == binds.end() || !row_b[7]) {
+			continue;
+		}
+
+		auto &b   = iter->second;
+		int  slot = Strings::ToInt(row_b[7]);
+
+		b.count++;
+
+		if (slot == 4) {
+			b.has_home          = true;
+			b.home.zone_id      = Strings::ToInt(row_b[1]);
+			b.home.instance_id  = Strings::ToInt(row_b[2]);
+			b.home.x            = Strings::ToFloat(row_b[3]);
+			b.home.y            = Strings::ToFloat(row_b[4]);
+			b.home.z            = Strings::ToFloat(row_b[5]);
+			b.home.heading      = Strings::ToFloat(row_b[6]);
+		}
+
+		if (slot == 0) {
+			b.has_bind = true;
+		}
+	}
+
+	/**
+	 * Tints
+	 */
+	auto results_material = database.QueryDatabase(
+		fmt::format(
+			SQL(
+				SELECT
+				`id`, `slot`, `red`, `green`, `blue`, `use_tint`
+				FROM
+				`character_material`
+				WHERE
+				`id` IN ({})
+			),
+			character_id_list
+		)
+	);
+	for (auto row_m = results_material.begin(); row_m != results_material.end(); ++row_m) {
+		auto iter = tints.find(Strings::ToUnsignedInt(row_m[0]));
+		uint32 slot = Strings::ToUnsignedInt(row_m[1]);
+		if (iter == tints.end() || slot >= EQ::textures::materialCount) {
+			continue;
+		}
+
+		iter->second.Slot[slot].Red     = Strings::ToInt(row_m[2]);
+		iter->second.Slot[slot].Green   = Strings::ToInt(row_m[3]);
+		iter->second.Slot[slot].Blue    = Strings::ToInt(row_m[4]);
+		iter->second.Slot[slot].UseTint = Strings::ToInt(row_m[5]);
+	}
+
+	bool inventory_loaded = GetCharSelInventory(character_id_list, inventories);
+	if (!inventory_loaded) {
+		LogError("Error loading character select inventory for account [{}]", account_id);
+	}
+
 	size_t packet_size = sizeof(CharacterSelect_Struct) + (sizeof(CharacterSelectEntry_Struct) * character_count);
 	*out_app = new EQApplicationPacket(OP_SendCharInfo, packet_size);
 
@@ -110,21 +235,17 @@ void WorldDatabase::GetCharSelectInfo(uint32 account_id, EQApplicationPacket **o
 	cs->CharCount = character_count;
 	cs->TotalChars = character_limit;
 
+	// missing binds are written back in one statement once every character has been built
+	std::vector<std::string> bind_replacements;
+
 	buff_ptr += sizeof(CharacterSelect_Struct);
 	for (auto row = results.begin(); row != results.end(); ++row) {
 		CharacterSelectEntry_Struct *p_character_select_entry_struct = (CharacterSelectEntry_Struct *) buff_ptr;
-		PlayerProfile_Struct        pp;
-		EQ::InventoryProfile        inventory_profile;
-
-		pp.SetPlayerProfileVersion(EQ::versions::ConvertClientVersionToMobVersion(client_version));
-		inventory_profile.SetInventoryVersion(client_version);
-		inventory_profile.SetGMInventory(true); // charsel can not interact with items..but, no harm in setting to full expansion support
 
 		uint32 character_id = Strings::ToUnsignedInt(row[0]);
-		uint8 has_home = 0;
-		uint8 has_bind = 0;
+		auto   &b           = binds[character_id];
+		auto   &item_tint   = tints[character_id];
 
-		memset(&pp, 0, sizeof(PlayerProfile_Struct));
 		memset(p_character_select_entry_struct->Name, 0, sizeof(p_character_select_entry_struct->Name));
 		strcpy(p_character_select_entry_struct->Name, row[1]);
 		p_character_select_entry_struct->Class = (uint8) Strings::ToUnsignedInt(row[4]);
@@ -167,51 +288,11 @@ void WorldDatabase::GetCharSelectInfo(uint32 account_id, EQApplicationPacket **o
 		p_character_select_entry_struct->LastLogin = (uint32) Strings::ToInt(row[7]);            // RoF2 value: 1212696584
 		p_character_select_entry_struct->Unknown2 = 0;
 
-		if (RuleB(World, EnableReturnHomeButton)) {
-			int now = time(nullptr);
-			if ((now - Strings::ToInt(row[7])) >= RuleI(World, MinOfflineTimeToReturnHome))
-				p_character_select_entry_struct->GoHome = 1;
-		}
-
-		if (RuleB(World, EnableTutorialButton) && (p_character_select_entry_struct->Level <= RuleI(World, MaxLevelForTutorial)))
-			p_character_select_entry_struct->Tutorial = 1;
-
-		/**
-		 * Bind
-		 */
-		character_list_query = fmt::format(
-			SQL(
-				SELECT
-				`zone_id`, `instance_id`, `x`, `y`, `z`, `heading`, `slot`
-				FROM
-				`character_bind`
-				WHERE
-				`id` = {}
-				LIMIT 5
-			),
-			character_id
-		);
-		auto results_bind = database.QueryDatabase(character_list_query);
-		auto bind_count = results_bind.RowCount();
-		for (auto row_b = results_bind.begin(); row_b != results_bind.end(); ++row_b) {
-			if (row_b[6] && Strings::ToInt(row_b[6]) == 4) {
-				has_home = 1;
-				// If our bind count is less than 5, we need to actually make use of this data so lets parse it
-				if (bind_count < 5) {
-					pp.binds[4].zone_id     = Strings::ToInt(row_b[0]);
-					pp.binds[4].instance_id = Strings::ToInt(row_b[1]);
-					pp.binds[4].x           = Strings::ToFloat(row_b[2]);
-					pp.binds[4].y           = Strings::ToFloat(row_b[3]);
-					pp.binds[4].z           = Strings::ToFloat(row_b[4]);
-					pp.binds[4].heading     = Strings::ToFloat(row_b[5]);
-				}
-			}
+		SetCharSelectButtons(p_character_select_entry_struct);
 
-			if (row_b[6] && Strings::ToInt(row_b[6]) == 0)
-				has_bind = 1;
-		}
+		BindStruct home = b.count < 5 ? b.home : BindStruct{};
 
-		if (has_home == 0 || has_bind == 0) {
+		if (!b.has_home || !b.has_bind) {
 			std::string character_list_query = fmt::format(
 				SQL(
 					SELECT
@@ -230,29 +311,29 @@ void WorldDatabase::GetCharSelectInfo(uint32 account_id, EQApplicationPacket **o
 				p_character_select_entry_struct->Race,
 				ContentFilterCriteria::apply().c_str()
 			);
-			auto results_bind = content_db.QueryDatabase(character_list_query);
-			for (auto row_d = results_bind.begin(); row_d != results_bind.end(); ++row_d) {
+			auto results_start = content_db.QueryDatabase(character_list_query);
+			for (auto row_d = results_start.begin(); row_d != results_start.end(); ++row_d) {
 				/* If a bind_id is specified, make them start there */
 				if (Strings::ToInt(row_d[1]) != 0) {
-					pp.binds[4].zone_id = (uint32) Strings::ToInt(row_d[1]);
+					home.zone_id = (uint32) Strings::ToInt(row_d[1]);
 
-					auto z = GetZone(pp.binds[4].zone_id);
+					auto z = GetZone(home.zone_id);
 					if (z) {
-						pp.binds[4].x       = z->safe_x;
-						pp.binds[4].y       = z->safe_y;
-						pp.binds[4].z       = z->safe_z;
-						pp.binds[4].heading = z->safe_heading;
+						home.x       = z->safe_x;
+						home.y       = z->safe_y;
+						home.z       = z->safe_z;
+						home.heading = z->safe_heading;
 					}
 				}
 					/* Otherwise, use the zone and coordinates given */
 				else {
-					pp.binds[4].zone_id = (uint32) Strings::ToInt(row_d[0]);
+					home.zone_id = (uint32) Strings::ToInt(row_d[0]);
 					float x = Strings::ToFloat(row_d[2]);
 					float y = Strings::ToFloat(row_d[3]);
 					float z = Strings::ToFloat(row_d[4]);
 					float heading = Strings::ToFloat(row_d[5]);
 					if (x == 0 && y == 0 && z == 0 && heading == 0) {
-						auto zone = GetZone(pp.binds[4].zone_id);
+						auto zone = GetZone(home.zone_id);
 						if (zone) {
 							x       = zone->safe_x;
 							y       = zone->safe_y;
@@ -260,104 +341,40 @@ void WorldDatabase::GetCharSelectInfo(uint32 account_id, EQApplicationPacket **o
 							heading = zone->safe_heading;
 						}
 					}
-					pp.binds[4].x       = x;
-					pp.binds[4].y       = y;
-					pp.binds[4].z       = z;
-					pp.binds[4].heading = heading;
+					home.x       = x;
+					home.y       = y;
+					home.z       = z;
+					home.heading = heading;
 				}
 			}
-			pp.binds[0] = pp.binds[4];
+
 			/* If no home bind set, set it */
-			if (has_home == 0) {
-				std::string query = fmt::format(
-					SQL(
-						REPLACE INTO
-						`character_bind`
-						(`id`, `zone_id`, `instance_id`, `x`, `y`, `z`, `heading`, `slot`)
-						VALUES ({}, {}, {}, {}, {}, {}, {}, {})
-					),
-					character_id,
-					pp.binds[4].zone_id,
-					0,
-					pp.binds[4].x,
-					pp.binds[4].y,
-					pp.binds[4].z,
-					pp.binds[4].heading,
-					4
+			if (!b.has_home) {
+				bind_replacements.emplace_back(
+					fmt::format("({}, {}, 0, {}, {}, {}, {}, 4)", character_id, home.zone_id, home.x, home.y, home.z, home.heading)
 				);
-				auto results_bset = QueryDatabase(query);
 			}
 			/* If no regular bind set, set it */
-			if (has_bind == 0) {
-				std::string query = fmt::format(
-					SQL(
-						REPLACE INTO
-						`character_bind`
-						(`id`, `zone_id`, `instance_id`, `x`, `y`, `z`, `heading`, `slot`)
-						VALUES ({}, {}, {}, {}, {}, {}, {}, {})
-					),
-					character_id,
-					pp.binds[0].zone_id,
-					0,
-					pp.binds[0].x,
-					pp.binds[0].y,
-					pp.binds[0].z,
-					pp.binds[0].heading,
-					0
+			if (!b.has_bind) {
+				bind_replacements.emplace_back(
+					fmt::format("({}, {}, 0, {}, {}, {}, {}, 0)", character_id, home.zone_id, home.x, home.y, home.z, home.heading)
 				);
-				auto results_bset = QueryDatabase(query);
 			}
 		}
 		/* If our bind count is less than 5, then we have null data that needs to be filled in. */
-		if (bind_count < 5) {
+		if (b.count < 5) {
 			// we know that home and main bind must be valid here, so we don't check those
 			// we also use home to fill in the null data like live does.
 			for (int i = 1; i < 4; i++) {
-				if (pp.binds[i].zone_id != 0) // we assume 0 is the only invalid one ...
-					continue;
-
-				std::string query = fmt::format(
-					SQL(
-						REPLACE INTO
-						`character_bind`
-						(`id`, `zone_id`, `instance_id`, `x`, `y`, `z`, `heading`, `slot`)
-						VALUES ({}, {}, {}, {}, {}, {}, {}, {})
-					),
-					character_id,
-					pp.binds[4].zone_id,
-					0,
-					pp.binds[4].x,
-					pp.binds[4].y,
-					pp.binds[4].z,
-					pp.binds[4].heading,
-					i
+				bind_replacements.emplace_back(
+					fmt::format("({}, {}, 0, {}, {}, {}, {}, {})", character_id, home.zone_id, home.x, home.y, home.z, home.heading, i)
 				);
-				auto results_bset = QueryDatabase(query);
 			}
 		}
 
-		character_list_query = fmt::format(
-			SQL(
-				SELECT
-				`slot`, `red`, `green`, `blue`, `use_tint`, `color`
-				FROM
-				`character_material`
-				WHERE
-				`id` = {}
-			),
-			character_id
-		);
-		auto results_b = database.QueryDatabase(character_list_query);
-		uint8 slot = 0;
-		for (auto row_b = results_b.begin(); row_b != results_b.end(); ++row_b) {
-			slot = Strings::ToInt(row_b[0]);
-			pp.item_tint.Slot[slot].Red     = Strings::ToInt(row_b[1]);
-			pp.item_tint.Slot[slot].Green   = Strings::ToInt(row_b[2]);
-			pp.item_tint.Slot[slot].Blue    = Strings::ToInt(row_b[3]);
-			pp.item_tint.Slot[slot].UseTint = Strings::ToInt(row_b[4]);
-		}
-
-		if (GetCharSelInventory(account_id, p_character_select_entry_struct->Name, &inventory_profile)) {
+		auto inventory = inventories.find(character_id);
+		if (inventory_loaded && inventory != inventories.end()) {
+			auto &inventory_profile = inventory->second;
 			const EQ::ItemData *item = nullptr;
 			const EQ::ItemInstance *inst = nullptr;
 			int16 inventory_slot = 0;
@@ -393,8 +410,8 @@ void WorldDatabase::GetCharSelectInfo(uint32 account_id, EQApplicationPacket **o
 				} else {
 					// Armor Materials/Models
 					uint32 color = (
-						pp.item_tint.Slot[matslot].UseTint ?
-						pp.item_tint.Slot[matslot].Color :
+						item_tint.Slot[matslot].UseTint ?
+						item_tint.Slot[matslot].Color :
 						inst->GetColor()
 					);
 					p_character_select_entry_struct->Equip[matslot].Material = item->Material;
@@ -403,11 +420,43 @@ void WorldDatabase::GetCharSelectInfo(uint32 account_id, EQApplicationPacket **o
 					p_character_select_entry_struct->Equip[matslot].Color = color;
 				}
 			}
-		} else {
-			printf("Error loading inventory for %s\n", p_character_select_entry_struct->Name);
 		}
 		buff_ptr += sizeof(CharacterSelectEntry_Struct);
 	}
+
+	if (!bind_replacements.empty()) {
+		QueryDatabase(
+			fmt::format(
+				SQL(
+					REPLACE INTO
+					`character_bind`
+					(`id`, `zone_id`, `instance_id`, `x`, `y`, `z`, `heading`, `slot`)
+					VALUES {}
+				),
+				Strings::Implode(", ", bind_replacements)
+			)
+		);
+	}
+
+	// a partial read is sent as is but built again next time
+	if (results_bind.Success() && results_material.Success() && inventory_loaded) {
+		character_select_cache.Store(account_id, client_version_bit, *out_app);
+	}
+}
+
+void WorldDatabase::SetCharSelectButtons(CharacterSelectEntry_Struct *e)
+{
+	e->GoHome   = 0;
+	e->Tutorial = 0;
+
+	if (RuleB(World, EnableReturnHomeButton)) {
+		int now = time(nullptr);
+		if ((now - static_cast<int>(e->LastLogin)) >= RuleI(World, MinOfflineTimeToReturnHome))
+			e->GoHome = 1;
+	}
+
+	if (RuleB(World, EnableTutorialButton) && (e->Level <= RuleI(World, MaxLevelForTutorial)))
+		e->Tutorial = 1;
 }
 
 int WorldDatabase::MoveCharacterToBind(int character_id, uint8 bind_number)
@@ -855,13 +904,15 @@ bool WorldDatabase::LoadCharacterCreateCombos()
 }
 
 // this is a slightly modified version of SharedDatabase::GetInventory(...) for character select use-only
-bool WorldDatabase::GetCharSelInventory(uint32 account_id, char *name, EQ::InventoryProfile *inv)
+// worn items of every listed character in one query, rows for characters not in inventories are skipped
+bool WorldDatabase::GetCharSelInventory(const std::string &character_ids, std::unordered_map<uint32, EQ::InventoryProfile> &inventories)
 {
-	if (!account_id || !name || !inv)
+	if (character_ids.empty())
 		return false;
 
 	std::string query = StringFormat(
 		"SELECT"
+		" charid,"
 		" slotid,"
 		" itemid,"
 		" charges,"
@@ -879,20 +930,13 @@ bool WorldDatabase::GetCharSelInventory(uint32 account_id, char *name, EQ::Inven
 		" ornament_hero_model "
 		"FROM"
 		" inventory "
-		"INNER JOIN"
-		" character_data ch "
-		"ON"
-		" ch.id = charid "
 		"WHERE"
-		" ch.name = '%s' "
-		"AND"
-		" ch.account_id = %i "
+		" charid IN (%s) "
 		"AND"
 		" slotid >= %i "
 		"AND"
 		" slotid <= %i",
-		name,
-		account_id,
+		character_ids.c_str(),
 		EQ::invslot::slotHead,
 		EQ::invslot::slotFeet
 	);
@@ -901,7 +945,11 @@ bool WorldDatabase::GetCharSelInventory(uint32 account_id, char *name, EQ::Inven
 		return false;
 
 	for (auto row = results.begin(); row != results.end(); ++row) {
-		int16 slot_id = Strings::ToInt(row[0]);
+		auto inv = inventories.find(Strings::ToUnsignedInt(row[0]));
+		if (inv == inventories.end())
+			continue;
+
+		int16 slot_id = Strings::ToInt(row[1]);
 
 		switch (slot_id) {
 		case EQ::invslot::slotFace:
@@ -916,22 +964,22 @@ bool WorldDatabase::GetCharSelInventory(uint32 account_id, char *name, EQ::Inven
 			break;
 		}
 
-		uint32 item_id = Strings::ToInt(row[1]);
-		int8 charges = Strings::ToInt(row[2]);
-		uint32 color = Strings::ToUnsignedInt(row[3]);
+		uint32 item_id = Strings::ToInt(row[2]);
+		int8 charges = Strings::ToInt(row[3]);
+		uint32 color = Strings::ToUnsignedInt(row[4]);
 
 		uint32 aug[EQ::invaug::SOCKET_COUNT];
-		aug[0] = (uint32)Strings::ToInt(row[4]);
-		aug[1] = (uint32)Strings::ToInt(row[5]);
-		aug[2] = (uint32)Strings::ToInt(row[6]);
-		aug[3] = (uint32)Strings::ToInt(row[7]);
-		aug[4] = (uint32)Strings::ToInt(row[8]);
-		aug[5] = (uint32)Strings::ToInt(row[9]);
-
-		bool instnodrop = ((row[10] && (uint16)Strings::ToInt(row[10])) ? true : false);
-		uint32 ornament_icon = (uint32)Strings::ToUnsignedInt(row[12]);
-		uint32 ornament_idfile = (uint32)Strings::ToUnsignedInt(row[13]);
-		uint32 ornament_hero_model = (uint32)Strings::ToUnsignedInt(row[14]);
+		aug[0] = (uint32)Strings::ToInt(row[5]);
+		aug[1] = (uint32)Strings::ToInt(row[6]);
+		aug[2] = (uint32)Strings::ToInt(row[7]);
+		aug[3] = (uint32)Strings::ToInt(row[8]);
+		aug[4] = (uint32)Strings::ToInt(row[9]);
+		aug[5] = (uint32)Strings::ToInt(row[10]);
+
+		bool instnodrop = ((row[11] && (uint16)Strings::ToInt(row[11])) ? true : false);
+		uint32 ornament_icon = (uint32)Strings::ToUnsignedInt(row[13]);
+		uint32 ornament_idfile = (uint32)Strings::ToUnsignedInt(row[14]);
+		uint32 ornament_hero_model = (uint32)Strings::ToUnsignedInt(row[15]);
 
 		const EQ::ItemData *item = content_db.GetItem(item_id);
 		if (!item)
@@ -944,8 +992,8 @@ bool WorldDatabase::GetCharSelInventory(uint32 account_id, char *name, EQ::Inven
 
 		inst->SetAttuned(instnodrop);
 
-		if (row[11]) {
-			std::string data_str(row[11]);
+		if (row[12]) {
+			std::string data_str(row[12]);
 			inst->SetCustomDataString(data_str);
 		}
 
@@ -965,7 +1013,7 @@ bool WorldDatabase::GetCharSelInventory(uint32 account_id, char *name, EQ::Inven
 			}
 		}
 
-		inv->PutItem(slot_id, *inst);
+		inv->second.PutItem(slot_id, *inst);
 
 		safe_delete(inst);
 	}
@@ -21,9 +21,12 @@
 #include "../common/shareddb.h"
 #include "../common/eq_packet.h"
 
+#include <unordered_map>
+
 struct PlayerProfile_Struct;
 struct CharCreate_Struct;
 struct CharacterSelect_Struct;
+struct CharacterSelectEntry_Struct;
 
 
 class WorldDatabase : public SharedDatabase {
@@ -43,7 +46,8 @@ private:
 	void SetTitaniumDefaultStartZone(PlayerProfile_Struct* in_pp, CharCreate_Struct* in_cc);
 	void SetSoFDefaultStartZone(PlayerProfile_Struct* in_pp, CharCreate_Struct* in_cc);
 
-	bool GetCharSelInventory(uint32 account_id, char* name, EQ::InventoryProfile* inv);
+	bool GetCharSelInventory(const std::string &character_ids, std::unordered_map<uint32, EQ::InventoryProfile> &inventories);
+	static void SetCharSelectButtons(CharacterSelectEntry_Struct *e);
 };
 
 extern WorldDatabase database;
@@ -65,15 +65,59 @@ void ZSList::ShowUpTime(WorldTCPConnection* con, const char* adminname) {
 
 void ZSList::Add(ZoneServer* zoneserver) {
 	zone_server_list.emplace_back(std::unique_ptr<ZoneServer>(zoneserver));
+	IndexZoneServer(zoneserver, m_zs_by_id[zoneserver->GetID()]);
 	zoneserver->SendGroupIDs();
 }
 
+void ZSList::IndexZoneServer(ZoneServer *zoneserver, IndexedZoneServer &indexed)
+{
+	indexed.zoneserver  = zoneserver;
+	indexed.zone_id     = zoneserver->GetZoneID();
+	indexed.instance_id = zoneserver->GetInstanceID();
+	indexed.port        = zoneserver->GetCPort();
+
+	if (indexed.zone_id) {
+		m_zs_by_zone_id.Add(indexed.zone_id, zoneserver);
+	}
+	if (indexed.instance_id) {
+		m_zs_by_instance_id.Add(indexed.instance_id, zoneserver);
+	}
+	if (indexed.port) {
+		m_zs_by_port.Add(indexed.port, zoneserver);
+	}
+}
+
+void ZSList::UnindexZoneServer(const IndexedZoneServer &indexed)
+{
+	m_zs_by_zone_id.Remove(indexed.zone_id, indexed.zoneserver);
+	m_zs_by_instance_id.Remove(indexed.instance_id, indexed.zoneserver);
+	m_zs_by_port.Remove(indexed.port, indexed.zoneserver);
+}
+
+void ZSList::ZoneServerKeysChanged(ZoneServer *zoneserver)
+{
+	auto iter = m_zs_by_id.find(zoneserver->GetID());
+	if (iter == m_zs_by_id.end() || iter->second.zoneserver != zoneserver) {
+		return;
+	}
+
+	UnindexZoneServer(iter->second);
+	IndexZoneServer(zoneserver, iter->second);
+}
+
 void ZSList::Remove(const std::string &uuid)
 {
 	auto iter = zone_server_list.begin();
 	while (iter != zone_server_list.end()) {
 		if ((*iter)->GetUUID().compare(uuid) == 0) {
 			auto port = (*iter)->GetCPort();
+
+			auto indexed = m_zs_by_id.find((*iter)->GetID());
+			if (indexed != m_zs_by_id.end()) {
+				UnindexZoneServer(indexed->second);
+				m_zs_by_id.erase(indexed);
+			}
+
 			zone_server_list.erase(iter);
 
 			if (port != 0) {
@@ -86,6 +130,11 @@ void ZSList::Remove(const std::string &uuid)
 }
 
 void ZSList::KillAll() {
+	m_zs_by_id.clear();
+	m_zs_by_zone_id.Clear();
+	m_zs_by_instance_id.Clear();
+	m_zs_by_port.Clear();
+
 	auto iterator = zone_server_list.begin();
 	while (iterator != zone_server_list.end()) {
 		(*iterator)->Disconnect();
@@ -130,43 +179,23 @@ bool ZSList::SendPacket(ServerPacket* pack) {
 }
 
 bool ZSList::SendPacket(uint32 ZoneID, ServerPacket* pack) {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		if ((*iterator)->GetZoneID() == ZoneID) {
-			ZoneServer* tmp = (*iterator).get();
-			tmp->SendPacket(pack);
-			return true;
-		}
-		iterator++;
+	if (!ZoneID) {
+		return false;
+	}
+
+	ZoneServer* tmp = m_zs_by_zone_id.Find(ZoneID);
+	if (tmp) {
+		tmp->SendPacket(pack);
+		return true;
 	}
 	return(false);
 }
 
 bool ZSList::SendPacket(uint32 ZoneID, uint16 instanceID, ServerPacket* pack) {
-	if (instanceID != 0)
-	{
-		auto iterator = zone_server_list.begin();
-		while (iterator != zone_server_list.end()) {
-			if ((*iterator)->GetInstanceID() == instanceID) {
-				ZoneServer* tmp = (*iterator).get();
-				tmp->SendPacket(pack);
-				return true;
-			}
-			iterator++;
-		}
-	}
-	else
-	{
-		auto iterator = zone_server_list.begin();
-		while (iterator != zone_server_list.end()) {
-			if ((*iterator)->GetZoneID() == ZoneID
-				&& (*iterator)->GetInstanceID() == 0) {
-				ZoneServer* tmp = (*iterator).get();
-				tmp->SendPacket(pack);
-				return true;
-			}
-			iterator++;
-		}
+	ZoneServer* tmp = instanceID != 0 ? FindByInstanceID(instanceID) : FindByZoneID(ZoneID);
+	if (tmp) {
+		tmp->SendPacket(pack);
+		return true;
 	}
 	return(false);
 }
@@ -184,52 +213,42 @@ ZoneServer* ZSList::FindByName(const char* zonename) {
 }
 
 ZoneServer* ZSList::FindByID(uint32 ZoneID) {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		if ((*iterator)->GetID() == ZoneID) {
-			ZoneServer* tmp = (*iterator).get();
-			return tmp;
-		}
-		iterator++;
+	auto iter = m_zs_by_id.find(ZoneID);
+	if (iter != m_zs_by_id.end()) {
+		return iter->second.zoneserver;
 	}
 	return 0;
 }
 
 ZoneServer* ZSList::FindByZoneID(uint32 ZoneID) {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		ZoneServer* tmp = (*iterator).get();
-		if (tmp->GetZoneID() == ZoneID && tmp->GetInstanceID() == 0) {
+	if (!ZoneID) {
+		return 0;
+	}
+
+	// the bucket holds every instance of the zone, only the base zone counts here
+	for (auto tmp : m_zs_by_zone_id.FindAll(ZoneID)) {
+		if (tmp->GetInstanceID() == 0) {
 			return tmp;
 		}
-		iterator++;
 	}
 	return 0;
 }
 
 ZoneServer* ZSList::FindByPort(uint16 port) {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		if ((*iterator)->GetCPort() == port) {
-			ZoneServer* tmp = (*iterator).get();
-			return tmp;
-		}
-		iterator++;
+	if (!port) {
+		return 0;
 	}
-	return 0;
+
+	return m_zs_by_port.Find(port);
 }
 
 ZoneServer* ZSList::FindByInstanceID(uint32 InstanceID)
 {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		if ((*iterator)->GetInstanceID() == InstanceID) {
-			ZoneServer* tmp = (*iterator).get();
-			return tmp;
-		}
-		iterator++;
+	if (!InstanceID) {
+		return 0;
 	}
-	return 0;
+
+	return m_zs_by_instance_id.Find(InstanceID);
 }
 
 bool ZSList::SetLockedZone(uint16 iZoneID, bool iLock) {
@@ -5,9 +5,12 @@
 #include "../common/eqtime.h"
 #include "../common/timer.h"
 #include "../common/event/timer.h"
+#include "lookup_index.h"
 #include <vector>
 #include <memory>
 #include <deque>
+#include <list>
+#include <unordered_map>
 
 class WorldTCPConnection;
 class ServerPacket;
@@ -42,6 +45,7 @@ public:
 	uint32 TriggerBootup(uint32 iZoneID, uint32 iInstanceID = 0);
 
 	void Add(ZoneServer *zoneserver);
+	void ZoneServerKeysChanged(ZoneServer *zoneserver); // called by a zone server after its zone, instance or port changes
 	void GetZoneIDList(std::vector<uint32> &zones);
 	void KillAll();
 	void ListLockedZones(const char *to, WorldTCPConnection *connection);
@@ -80,6 +84,22 @@ private:
 	std::unique_ptr<EQ::Timer> m_keepalive;
 
 	std::list<std::unique_ptr<ZoneServer>> zone_server_list;
+
+	// the keys each zone server is filed under, so a change can be moved to the right bucket
+	struct IndexedZoneServer {
+		ZoneServer *zoneserver;
+		uint32     zone_id;
+		uint32     instance_id;
+		uint16     port;
+	};
+
+	void IndexZoneServer(ZoneServer *zoneserver, IndexedZoneServer &indexed);
+	void UnindexZoneServer(const IndexedZoneServer &indexed);
+
+	std::unordered_map<uint32, IndexedZoneServer> m_zs_by_id;
+	LookupIndex<uint32, ZoneServer>               m_zs_by_zone_id; // every instance of the zone
+	LookupIndex<uint32, ZoneServer>               m_zs_by_instance_id;
+	LookupIndex<uint16, ZoneServer>               m_zs_by_port;
 };
 
 #endif /*ZONELIST_H_*/
@@ -47,6 +47,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "../common/events/player_event_logs.h"
 #include "../common/patches/patches.h"
 #include "../zone/data_bucket.h"
+#include "character_select_cache.h"
 
 extern ClientList client_list;
 extern GroupLFPList LFPGroupList;
@@ -123,6 +124,7 @@ bool ZoneServer::SetZone(uint32 in_zone_id, uint32 in_instance_id, bool in_is_st
 
 	zone_server_zone_id = in_zone_id;
 	instance_id = in_instance_id;
+	zoneserver_list.ZoneServerKeysChanged(this);
 	if (in_zone_id) {
 		zone_server_previous_zone_id = in_zone_id;
 	}
@@ -671,6 +673,8 @@ void ZoneServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p) {
 				LogInfo("Zone specified port [{}]", client_port);
 			}
 
+			zoneserver_list.ZoneServerKeysChanged(this);
+
 			if (sci->address[0]) {
 				strn0cpy(client_address, sci->address, 250);
 				LogInfo("Zone specified address [{}]", sci->address);
@@ -916,6 +920,16 @@ void ZoneServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p) {
 			client_list.ClientUpdate(this, scl);
 			break;
 		}
+		case ServerOP_CharacterSaved: {
+			if (pack->size != sizeof(ServerCharacterSaved_Struct)) {
+				LogInfo("Wrong size on ServerOP_CharacterSaved. Got: [{}], Expected: [{}]", pack->size, sizeof(ServerCharacterSaved_Struct));
+				break;
+			}
+
+			auto s = (ServerCharacterSaved_Struct*) pack->pBuffer;
+			character_select_cache.Invalidate(s->account_id);
+			break;
+		}
 		case ServerOP_ClientListKA: {
 			auto sclka = (ServerClientListKeepAlive_Struct*) pack->pBuffer;
 			if (pack->size < 4 || pack->size != 4 + (4 * sclka->numupdates)) {
@@ -1609,6 +1623,7 @@ void ZoneServer::TriggerBootup(uint32 in_zone_id, uint32 in_instance_id, const c
 	is_booting_up = true;
 	zone_server_zone_id = in_zone_id;
 	instance_id = in_instance_id;
+	zoneserver_list.ZoneServerKeysChanged(this);
 
 	auto pack = new ServerPacket(ServerOP_ZoneBootup, sizeof(ServerZoneStateChange_struct));
 	auto s = (ServerZoneStateChange_struct*) pack->pBuffer;
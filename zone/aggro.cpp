@@ -368,11 +368,11 @@ void NPC::DescribeAggro(Client *to_who, Mob *mob, bool verbose) {
 	);
 }
 
-/*
-	If you change this function, you should update the above function
-	to keep the #aggro command accurate.
-*/
-bool Mob::CheckWillAggro(Mob *mob) {
+/**
+ * The cheap checks at the top of CheckWillAggro, no logging, rolls or raycasts so the
+ * AI think phase can run it off the main thread to narrow down who is worth a full check
+ */
+bool Mob::CheckWillAggroPrefilter(Mob *mob) {
 	if(!mob) {
 		return false;
 	}
@@ -452,6 +452,18 @@ bool Mob::CheckWillAggro(Mob *mob) {
 		return false;
 	}
 
+	return true;
+}
+
+/*
+	If you change this function or CheckWillAggroPrefilter, you should update
+	NPC::DescribeAggro to keep the #aggro command accurate.
+*/
+bool Mob::CheckWillAggro(Mob *mob) {
+	if (!CheckWillAggroPrefilter(mob)) {
+		return false;
+	}
+
 	// Don't aggro new clients if we are already engaged unless PROX_AGGRO is set
 	if (IsEngaged() && (!GetSpecialAbility(PROX_AGGRO) || (GetSpecialAbility(PROX_AGGRO) && !CombatRange(mob)))) {
 		LogAggro(
@@ -470,6 +482,7 @@ bool Mob::CheckWillAggro(Mob *mob) {
 		return false;
 	}
 
+	float aggro_range = GetAggroRange();
 	float distance_squared = DistanceSquared(mob->GetPosition(), m_Position);
 	float aggro_range_squared = (aggro_range * aggro_range);
 
@@ -1064,10 +1077,13 @@ bool Mob::CombatRange(Mob* other, float fixed_size_mod, bool aeRampage, ExtraAtt
 			min_distance = min_distance * min_distance;
 		}
 
-		if ((DoLoSCheck && CheckLastLosState()) && (_DistNoRoot >= min_distance && _DistNoRoot <= max_dist)) {
-			SetPseudoRoot(true);
+		const bool pseudo_root = (DoLoSCheck && CheckLastLosState()) && (_DistNoRoot >= min_distance && _DistNoRoot <= max_dist);
+
+		// the ai think pass runs off the main thread, AI_Process applies it with the think result
+		if (m_ai_think.thinking) {
+			m_ai_think.pseudo_root = pseudo_root ? 1 : 0;
 		} else {
-			SetPseudoRoot(false);
+			SetPseudoRoot(pseudo_root);
 		}
 	}
 	
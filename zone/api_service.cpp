@@ -29,8 +29,16 @@
 #include "object.h"
 #include "zone.h"
 #include "doors.h"
+#include "map.h"
+#include "zone_profiler.h"
 #include <iostream>
 
+#ifdef LUA_EQEMU
+#include "lua_parser.h"
+
+extern const char *LuaEvents[_LargestEventID];
+#endif
+
 extern Zone *zone;
 
 /**
@@ -883,6 +891,199 @@ Json::Value ApiSetLoggingLevel(EQ::Net::WebsocketServerConnection *connection, J
 	return response;
 }
 
+Json::Value ApiProfileHistogram(const ZoneProfiler::Histogram &h)
+{
+	Json::Value row;
+
+	row["count"]    = h.count;
+	row["total_us"] = zone_profiler.TicksToMicroseconds(h.total_ticks);
+	row["avg_us"]   = h.count ? zone_profiler.TicksToMicroseconds(h.total_ticks) / h.count : 0.0;
+	row["max_us"]   = zone_profiler.TicksToMicroseconds(h.max_ticks);
+
+	Json::Value buckets;
+	for (uint32 i = 0; i < ZoneProfiler::HISTOGRAM_BUCKETS; i++) {
+		Json::Value bucket;
+
+		// upper bound of 0 marks the open ended last bucket
+		bucket["le_us"] = ZoneProfiler::GetBucketUpperMicroseconds(i);
+		bucket["count"] = h.buckets[i];
+
+		buckets.append(bucket);
+	}
+
+	row["buckets"] = buckets;
+
+	return row;
+}
+
+Json::Value ApiGetZoneProfile(EQ::Net::WebsocketServerConnection *connection, Json::Value params)
+{
+	if (!zone || (zone && zone->GetZoneID() == 0)) {
+		throw EQ::Net::WebsocketException("Zone must be loaded to invoke this call");
+	}
+
+	Json::Value response;
+
+	response["enabled"]        = zone_profiler.IsEnabled();
+	response["ticks"]          = zone_profiler.GetTickCount();
+	response["overruns"]       = zone_profiler.GetOverrunCount();
+	response["overrun_ms"]     = zone_profiler.GetOverrunBudgetMS();
+	response["dropped_frames"] = zone_profiler.GetDroppedFrameCount();
+
+	Json::Value sections;
+	for (uint16 i = 0; i < ZoneProfiler::MaxSection; i++) {
+		Json::Value row = ApiProfileHistogram(zone_profiler.GetHistogram(i));
+		row["name"] = ZoneProfiler::GetFrameName(i);
+		sections.append(row);
+	}
+
+	response["sections"] = sections;
+
+	Json::Value quest_events;
+	for (uint16 i = ZoneProfiler::QUEST_EVENT_FRAME_BASE; i < ZoneProfiler::MAX_FRAMES; i++) {
+		auto &h = zone_profiler.GetHistogram(i);
+		if (h.count == 0) {
+			continue;
+		}
+
+		Json::Value row = ApiProfileHistogram(h);
+		row["event_id"] = i - ZoneProfiler::QUEST_EVENT_FRAME_BASE;
+		row["name"]     = ZoneProfiler::GetFrameName(i);
+		quest_events.append(row);
+	}
+
+	response["quest_events"] = quest_events;
+
+	// folded stacks load straight into flamegraph.pl / speedscope
+	Json::Value stacks;
+	for (auto &e : zone_profiler.GetFoldedStacks()) {
+		Json::Value row;
+		row["stack"]   = e.first;
+		row["self_us"] = zone_profiler.TicksToMicroseconds(e.second);
+		stacks.append(row);
+	}
+
+	response["stacks"] = stacks;
+
+	Json::Value overruns;
+	for (auto &o : zone_profiler.GetOverruns()) {
+		Json::Value row;
+		row["tick"]    = o.tick_number;
+		row["tick_us"] = zone_profiler.TicksToMicroseconds(o.tick_ticks);
+
+		Json::Value breakdown;
+		for (uint16 i = 1; i < ZoneProfiler::MaxSection; i++) {
+			if (o.section_ticks[i] == 0) {
+				continue;
+			}
+
+			breakdown[ZoneProfiler::GetFrameName(i)] = zone_profiler.TicksToMicroseconds(o.section_ticks[i]);
+		}
+
+		row["sections"] = breakdown;
+
+		if (o.worst_mob.ticks) {
+			row["worst_mob"]["name"]        = o.worst_mob.name;
+			row["worst_mob"]["npc_type_id"] = o.worst_mob.npc_type_id;
+			row["worst_mob"]["us"]          = zone_profiler.TicksToMicroseconds(o.worst_mob.ticks);
+		}
+
+		if (o.worst_quest_event.ticks) {
+			auto &q = o.worst_quest_event;
+			row["worst_quest_event"]["event"]     = ZoneProfiler::GetFrameName(ZoneProfiler::QuestEventFrame(static_cast<QuestEventID>(q.event_id)));
+			row["worst_quest_event"]["source"]    = ZoneProfiler::GetQuestSourceName(q.source);
+			row["worst_quest_event"]["source_id"] = q.source_id;
+			row["worst_quest_event"]["us"]        = zone_profiler.TicksToMicroseconds(q.ticks);
+		}
+
+		overruns.append(row);
+	}
+
+	response["overrun_snapshots"] = overruns;
+
+	return response;
+}
+
+Json::Value ApiGetMapCacheStats(EQ::Net::WebsocketServerConnection *connection, Json::Value params)
+{
+	if (!zone || (zone && zone->GetZoneID() == 0)) {
+		throw EQ::Net::WebsocketException("Zone must be loaded to invoke this call");
+	}
+
+	if (!zone->zonemap) {
+		throw EQ::Net::WebsocketException("Zone has no map loaded");
+	}
+
+	auto stats = zone->zonemap->GetCacheStats();
+
+	Json::Value response;
+
+	response["height_field_loaded"]    = stats.height_field_loaded;
+	response["height_field_cells"]     = stats.height_field_cells;
+	response["height_field_resolved"]  = stats.height_field_resolved;
+	response["height_field_hits"]      = stats.height_field_hits;
+	response["height_field_fallbacks"] = stats.height_field_fallbacks;
+	response["los_cache_hits"]         = stats.los_hits;
+	response["los_cache_misses"]       = stats.los_misses;
+	response["los_cache_evictions"]    = stats.los_evictions;
+	response["los_cache_entries"]      = static_cast<Json::UInt64>(stats.los_entries);
+	response["los_cache_capacity"]     = stats.los_capacity;
+
+	return response;
+}
+
+Json::Value ApiResetZoneProfile(EQ::Net::WebsocketServerConnection *connection, Json::Value params)
+{
+	if (!zone || (zone && zone->GetZoneID() == 0)) {
+		throw EQ::Net::WebsocketException("Zone must be loaded to invoke this call");
+	}
+
+	zone_profiler.Reset();
+#ifdef LUA_EQEMU
+	LuaParser::Instance()->ResetDispatchStats();
+#endif
+
+	Json::Value response;
+	response["status"] = "Zone profile reset";
+
+	return response;
+}
+
+Json::Value ApiGetLuaDispatchStats(EQ::Net::WebsocketServerConnection *connection, Json::Value params)
+{
+	if (!zone || (zone && zone->GetZoneID() == 0)) {
+		throw EQ::Net::WebsocketException("Zone must be loaded to invoke this call");
+	}
+
+	Json::Value response;
+
+#ifdef LUA_EQEMU
+	auto parser = LuaParser::Instance();
+
+	for (int i = 0; i < _LargestEventID; i++) {
+		const auto &s = parser->GetDispatchStats(static_cast<QuestEventID>(i));
+		if (s.count == 0) {
+			continue;
+		}
+
+		Json::Value row;
+		row["event_id"] = i;
+		row["name"]     = LuaEvents[i];
+		row["count"]    = s.count;
+		row["errors"]   = s.errors;
+		row["total_us"] = s.total_ns / 1000.0;
+		row["avg_us"]   = s.total_ns / 1000.0 / s.count;
+		row["max_us"]   = s.max_ns / 1000.0;
+
+		response.append(row);
+	}
+#else
+	throw EQ::Net::WebsocketException("Zone was built without Lua support");
+#endif
+
+	return response;
+}
+
 void RegisterApiLogEvent(std::unique_ptr<EQ::Net::WebsocketServer> &server)
 {
 	LogSys.SetConsoleHandler(
@@ -909,6 +1110,10 @@ void RegisterApiService(std::unique_ptr<EQ::Net::WebsocketServer> &server)
 	server->SetMethodHandler("get_zone_attributes", &ApiGetZoneAttributes, 50);
 	server->SetMethodHandler("get_logsys_categories", &ApiGetLogsysCategories, 50);
 	server->SetMethodHandler("set_logging_level", &ApiSetLoggingLevel, 50);
+	server->SetMethodHandler("get_zone_profile", &ApiGetZoneProfile, 50);
+	server->SetMethodHandler("reset_zone_profile", &ApiResetZoneProfile, 50);
+	server->SetMethodHandler("get_map_cache_stats", &ApiGetMapCacheStats, 50);
+	server->SetMethodHandler("get_lua_dispatch_stats", &ApiGetLuaDispatchStats, 50);
 
 	RegisterApiLogEvent(server);
 }
@@ -34,6 +34,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "lua_parser.h"
 #include "fastmath.h"
 #include "mob.h"
+#include "mob_movement_manager.h"
 #include "npc.h"
 
 #include "bot.h"
@@ -2471,6 +2472,9 @@ bool NPC::Death(Mob* killer_mob, int64 damage, uint16 spell, EQ::skills::SkillTy
 		safe_delete(outapp);
 	}
 
+	// movement still waiting for the end of tick flush would land after OP_Death
+	mMovementManager->ClearPendingUpdates(this);
+
 	auto app = new EQApplicationPacket(OP_Death, sizeof(Death_Struct));
 	auto* d = (Death_Struct*) app->pBuffer;
 	d->spawn_id = GetID();
@@ -2733,6 +2737,7 @@ bool NPC::Death(Mob* killer_mob, int64 damage, uint16 spell, EQ::skills::SkillTy
 		// entity_list.RemoveMobFromCloseLists(this);
 		close_mobs.clear();
 		SetID(0);
+		mMovementManager->ClearPendingUpdates(this);
 		ApplyIllusionToCorpse(illusion_spell_id, corpse);
 
 		if (killer != 0 && emoteid != 0)
@@ -0,0 +1,458 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2016 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "bazaar_index.h"
+#include "zonedb.h"
+#include "../common/eq_constants.h"
+#include "../common/item_data.h"
+#include "../common/repositories/trader_repository.h"
+
+#include <algorithm>
+#include <cctype>
+
+static uint32 Trigram(const std::string &s, size_t i)
+{
+	return (static_cast<uint32>(static_cast<uint8>(s[i])) << 16) |
+		   (static_cast<uint32>(static_cast<uint8>(s[i + 1])) << 8) |
+		   static_cast<uint32>(static_cast<uint8>(s[i + 2]));
+}
+
+std::string BazaarIndex::NormalizeName(const std::string &name)
+{
+	std::string out;
+	out.reserve(name.size());
+
+	for (auto c : name) {
+		if (c == '\'') {
+			continue;
+		}
+
+		out.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+	}
+
+	return out;
+}
+
+void BazaarIndex::Load()
+{
+	m_loaded = true;
+
+	m_listings.clear();
+	m_trader_listings.clear();
+	m_items.clear();
+	m_trigrams.clear();
+
+	for (auto &e : TraderRepository::All(database)) {
+		AddListing(Listing{e.char_id, e.item_id, e.serialnumber, e.charges, e.item_cost, e.slot_id});
+	}
+
+	LogTrading(
+		"Loaded bazaar index with [{}] listing(s) of [{}] item(s)",
+		m_listings.size(),
+		m_items.size()
+	);
+}
+
+void BazaarIndex::AddListing(const Listing &l)
+{
+	const uint64 key = ListingKey(l.char_id, l.slot_id);
+
+	// a slot is replaced the same way REPLACE INTO replaces the row
+	if (m_listings.find(key) != m_listings.end()) {
+		RemoveListing(key);
+	}
+
+	m_listings[key] = l;
+	m_trader_listings[l.char_id].push_back(key);
+
+	auto iter = m_items.find(l.item_id);
+	if (iter == m_items.end()) {
+		const auto *item = database.GetItem(l.item_id);
+		if (!item) {
+			return;
+		}
+
+		ListedItem li;
+		li.item = item;
+		li.name = NormalizeName(item->Name);
+
+		for (size_t i = 0; i + 3 <= li.name.size(); ++i) {
+			m_trigrams[Trigram(li.name, i)].insert(l.item_id);
+		}
+
+		iter = m_items.emplace(l.item_id, std::move(li)).first;
+	}
+
+	iter->second.listings.push_back(key);
+}
+
+void BazaarIndex::RemoveListing(uint64 key)
+{
+	auto listing = m_listings.find(key);
+	if (listing == m_listings.end()) {
+		return;
+	}
+
+	const auto l = listing->second;
+	m_listings.erase(listing);
+
+	auto trader = m_trader_listings.find(l.char_id);
+	if (trader != m_trader_listings.end()) {
+		auto &keys = trader->second;
+		keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+		if (keys.empty()) {
+			m_trader_listings.erase(trader);
+		}
+	}
+
+	auto item = m_items.find(l.item_id);
+	if (item == m_items.end()) {
+		return;
+	}
+
+	auto &keys = item->second.listings;
+	keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+
+	if (!keys.empty()) {
+		return;
+	}
+
+	// last listing of the item is gone, take its name out of the trigram index
+	const auto &name = item->second.name;
+	for (size_t i = 0; i + 3 <= name.size(); ++i) {
+		auto t = m_trigrams.find(Trigram(name, i));
+		if (t == m_trigrams.end()) {
+			continue;
+		}
+
+		t->second.erase(l.item_id);
+		if (t->second.empty()) {
+			m_trigrams.erase(t);
+		}
+	}
+
+	m_items.erase(item);
+}
+
+void BazaarIndex::SaveItem(uint32 char_id, uint32 item_id, uint32 serial_number, int32 charges, uint32 item_cost, uint8 slot_id)
+{
+	if (!m_loaded) {
+		return;
+	}
+
+	AddListing(Listing{char_id, item_id, serial_number, charges, item_cost, slot_id});
+}
+
+void BazaarIndex::UpdateCharges(uint32 char_id, uint32 serial_number, int32 charges)
+{
+	if (!m_loaded) {
+		return;
+	}
+
+	auto trader = m_trader_listings.find(char_id);
+	if (trader == m_trader_listings.end()) {
+		return;
+	}
+
+	for (auto &key : trader->second) {
+		auto &l = m_listings[key];
+		if (l.serial_number == serial_number) {
+			l.charges = charges;
+		}
+	}
+}
+
+void BazaarIndex::UpdatePrice(uint32 char_id, uint32 item_id, int32 charges, uint32 item_cost)
+{
+	if (!m_loaded) {
+		return;
+	}
+
+	const auto *item = database.GetItem(item_id);
+	if (!item) {
+		return;
+	}
+
+	auto trader = m_trader_listings.find(char_id);
+	if (trader == m_trader_listings.end()) {
+		return;
+	}
+
+	// copied, a price of zero removes listings out of the list being walked
+	const auto keys = trader->second;
+	for (auto &key : keys) {
+		auto &l = m_listings[key];
+		if (l.item_id != item_id) {
+			continue;
+		}
+
+		if (item_cost == 0) {
+			RemoveListing(key);
+			continue;
+		}
+
+		if (item->Stackable || l.charges == charges) {
+			l.item_cost = item_cost;
+		}
+	}
+}
+
+void BazaarIndex::RemoveTrader(uint32 char_id)
+{
+	if (!m_loaded) {
+		return;
+	}
+
+	if (char_id == 0) {
+		m_listings.clear();
+		m_trader_listings.clear();
+		m_items.clear();
+		m_trigrams.clear();
+		return;
+	}
+
+	auto trader = m_trader_listings.find(char_id);
+	if (trader == m_trader_listings.end()) {
+		return;
+	}
+
+	const auto keys = trader->second;
+	for (auto &key : keys) {
+		RemoveListing(key);
+	}
+}
+
+void BazaarIndex::RemoveItem(uint32 char_id, uint8 slot_id)
+{
+	if (!m_loaded) {
+		return;
+	}
+
+	RemoveListing(ListingKey(char_id, slot_id));
+}
+
+bool BazaarIndex::GetStatValue(const EQ::ItemData *item, uint32 item_stat, int32 &value)
+{
+	switch (item_stat) {
+		case STAT_AC:            value = item->AC; break;
+		case STAT_AGI:           value = item->AAgi; break;
+		case STAT_CHA:           value = item->ACha; break;
+		case STAT_DEX:           value = item->ADex; break;
+		case STAT_INT:           value = item->AInt; break;
+		case STAT_STA:           value = item->ASta; break;
+		case STAT_STR:           value = item->AStr; break;
+		case STAT_WIS:           value = item->AWis; break;
+		case STAT_COLD:          value = item->CR; break;
+		case STAT_DISEASE:       value = item->DR; break;
+		case STAT_FIRE:          value = item->FR; break;
+		case STAT_MAGIC:         value = item->MR; break;
+		case STAT_POISON:        value = item->PR; break;
+		case STAT_HP:            value = item->HP; break;
+		case STAT_MANA:          value = item->Mana; break;
+		case STAT_ENDURANCE:     value = item->Endur; break;
+		case STAT_ATTACK:        value = item->Attack; break;
+		case STAT_HP_REGEN:      value = item->Regen; break;
+		case STAT_MANA_REGEN:    value = item->ManaRegen; break;
+		case STAT_HASTE:         value = item->Haste; break;
+		case STAT_DAMAGE_SHIELD: value = item->DamageShield; break;
+		default:
+			value = 0;
+			return false;
+	}
+
+	return true;
+}
+
+bool BazaarIndex::PassesItemFilters(const EQ::ItemData *item, const BazaarSearchCriteria &criteria, int32 &stat_value)
+{
+	// class, race and slot come from the client one based, as bit positions of the item bitfields
+	if (criteria.in_class != 0xFFFFFFFF) {
+		if (criteria.in_class == 0 || criteria.in_class > 32 || !(item->Classes & (1u << (criteria.in_class - 1)))) {
+			return false;
+		}
+	}
+
+	if (criteria.in_race != 0xFFFFFFFF) {
+		if (criteria.in_race == 0 || criteria.in_race > 32 || !(item->Races & (1u << (criteria.in_race - 1)))) {
+			return false;
+		}
+	}
+
+	if (criteria.item_slot != 0xFFFFFFFF) {
+		if (criteria.item_slot >= 32 || !(item->Slots & (1u << criteria.item_slot))) {
+			return false;
+		}
+	}
+
+	switch (criteria.item_type) {
+		case 0xFFFFFFFF:
+			break;
+		case 0:
+			// 1H Slashing
+			if (item->ItemType != EQ::item::ItemType1HSlash || item->Damage == 0) {
+				return false;
+			}
+			break;
+		case 31:
+			if (item->ItemClass != EQ::item::ItemClassBook) {
+				return false;
+			}
+			break;
+		case 46:
+			if (item->Scroll.Effect <= 0 || item->Scroll.Effect >= 65000) {
+				return false;
+			}
+			break;
+		case 47:
+			if (item->Worn.Effect != 998) {
+				return false;
+			}
+			break;
+		case 48:
+			if (item->Worn.Effect < 1298 || item->Worn.Effect > 1307) {
+				return false;
+			}
+			break;
+		case 49:
+			if (item->Focus.Effect <= 0) {
+				return false;
+			}
+			break;
+		default:
+			if (item->ItemType != criteria.item_type) {
+				return false;
+			}
+	}
+
+	if (GetStatValue(item, criteria.item_stat, stat_value) && stat_value <= 0) {
+		return false;
+	}
+
+	return true;
+}
+
+std::vector<BazaarSearchResult> BazaarIndex::Search(const BazaarSearchCriteria &criteria)
+{
+	if (!m_loaded) {
+		Load();
+	}
+
+	std::vector<BazaarSearchResult> results;
+
+	const std::string name = NormalizeName(criteria.item_name);
+
+	// names of three or more letters start from the rarest trigram, shorter ones check every listed item
+	const std::unordered_set<uint32> *candidates = nullptr;
+	if (name.size() >= 3) {
+		for (size_t i = 0; i + 3 <= name.size(); ++i) {
+			auto t = m_trigrams.find(Trigram(name, i));
+			if (t == m_trigrams.end()) {
+				return results;
+			}
+
+			if (!candidates || t->second.size() < candidates->size()) {
+				candidates = &t->second;
+			}
+		}
+	}
+
+	auto search_item = [&](uint32 item_id, const ListedItem &li) {
+		if (!name.empty() && li.name.find(name) == std::string::npos) {
+			return;
+		}
+
+		int32 stat_value = 0;
+		if (!PassesItemFilters(li.item, criteria, stat_value)) {
+			return;
+		}
+
+		const size_t first = results.size();
+
+		for (auto &key : li.listings) {
+			const auto &l = m_listings[key];
+
+			if (criteria.trader_char_id && l.char_id != criteria.trader_char_id) {
+				continue;
+			}
+
+			if (criteria.min_price && l.item_cost < criteria.min_price) {
+				continue;
+			}
+
+			if (criteria.max_price && l.item_cost > criteria.max_price) {
+				continue;
+			}
+
+			auto r = std::find_if(
+				results.begin() + first,
+				results.end(),
+				[&](const BazaarSearchResult &e) {
+					return e.char_id == l.char_id && e.charges == l.charges;
+				}
+			);
+
+			if (r != results.end()) {
+				r->count++;
+				r->total_charges += l.charges;
+				continue;
+			}
+
+			if (criteria.max_results && results.size() >= criteria.max_results) {
+				return;
+			}
+
+			BazaarSearchResult e;
+			e.char_id       = l.char_id;
+			e.item_id       = item_id;
+			e.serial_number = l.serial_number;
+			e.item_cost     = l.item_cost;
+			e.count         = 1;
+			e.charges       = l.charges;
+			e.total_charges = l.charges;
+			e.stat_value    = stat_value;
+			e.stackable     = li.item->Stackable;
+			e.item_name     = li.item->Name;
+
+			results.push_back(e);
+		}
+	};
+
+	if (candidates) {
+		for (auto &item_id : *candidates) {
+			auto li = m_items.find(item_id);
+			if (li != m_items.end()) {
+				search_item(item_id, li->second);
+			}
+
+			if (criteria.max_results && results.size() >= criteria.max_results) {
+				break;
+			}
+		}
+	}
+	else {
+		for (auto &li : m_items) {
+			search_item(li.first, li.second);
+
+			if (criteria.max_results && results.size() >= criteria.max_results) {
+				break;
+			}
+		}
+	}
+
+	return results;
+}
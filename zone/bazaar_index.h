@@ -0,0 +1,116 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2016 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+#ifndef BAZAAR_INDEX_H
+#define BAZAAR_INDEX_H
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "../common/types.h"
+
+namespace EQ {
+	struct ItemData;
+}
+
+struct BazaarSearchCriteria {
+	uint32      trader_char_id = 0;
+	uint32      in_class       = 0xFFFFFFFF;
+	uint32      in_race        = 0xFFFFFFFF;
+	uint32      item_stat      = 0;
+	uint32      item_slot      = 0xFFFFFFFF;
+	uint32      item_type      = 0xFFFFFFFF;
+	std::string item_name;
+	uint32      min_price      = 0;
+	uint32      max_price      = 0;
+	uint32      max_results    = 0;
+};
+
+// one line of the search window, listings of the same item with the same charges from the same trader
+struct BazaarSearchResult {
+	uint32      char_id;
+	uint32      item_id;
+	uint32      serial_number;
+	uint32      item_cost;
+	uint32      count;
+	int32       charges;
+	int32       total_charges;
+	int32       stat_value;
+	bool        stackable;
+	std::string item_name;
+};
+
+/**
+ * In memory copy of the trader table for bazaar searches
+ *
+ * The table is read once on the first search and then kept in step by the ZoneDatabase trader
+ * writes. Listed item names carry a trigram index, the class, race, slot, type and stat filters
+ * test the item's own bitfields and values, so a search never goes to MySQL
+ */
+class BazaarIndex {
+public:
+	BazaarIndex() : m_loaded(false) { }
+
+	void SaveItem(uint32 char_id, uint32 item_id, uint32 serial_number, int32 charges, uint32 item_cost, uint8 slot_id);
+	void UpdateCharges(uint32 char_id, uint32 serial_number, int32 charges);
+	void UpdatePrice(uint32 char_id, uint32 item_id, int32 charges, uint32 item_cost);
+	void RemoveTrader(uint32 char_id);
+	void RemoveItem(uint32 char_id, uint8 slot_id);
+
+	std::vector<BazaarSearchResult> Search(const BazaarSearchCriteria &criteria);
+
+	inline size_t GetListingCount() const { return m_listings.size(); }
+	inline size_t GetListedItemCount() const { return m_items.size(); }
+
+private:
+	struct Listing {
+		uint32 char_id;
+		uint32 item_id;
+		uint32 serial_number;
+		int32  charges;
+		uint32 item_cost;
+		uint8  slot_id;
+	};
+
+	struct ListedItem {
+		const EQ::ItemData  *item;
+		std::string         name;     // lower case with apostrophes removed, the form searches are made in
+		std::vector<uint64> listings; // keys into m_listings in the order they were listed
+	};
+
+	static uint64 ListingKey(uint32 char_id, uint8 slot_id) { return (static_cast<uint64>(char_id) << 8) | slot_id; }
+	static std::string NormalizeName(const std::string &name);
+	static bool GetStatValue(const EQ::ItemData *item, uint32 item_stat, int32 &value);
+	static bool PassesItemFilters(const EQ::ItemData *item, const BazaarSearchCriteria &criteria, int32 &stat_value);
+
+	void Load();
+	void AddListing(const Listing &l);
+	void RemoveListing(uint64 key);
+
+	bool m_loaded;
+
+	std::unordered_map<uint64, Listing>                     m_listings;
+	std::unordered_map<uint32, std::vector<uint64>>         m_trader_listings;
+	std::unordered_map<uint32, ListedItem>                  m_items;
+	std::unordered_map<uint32, std::unordered_set<uint32>> m_trigrams;
+};
+
+extern BazaarIndex bazaar_index;
+
+#endif
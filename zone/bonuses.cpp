@@ -137,6 +137,10 @@ int Mob::CalcRecommendedLevelBonus(uint8 current_level, uint8 recommended_level,
 }
 
 void Mob::CalcItemBonuses(StatBonuses* b) {
+	if (m_focus_index) {
+		m_focus_index->items_dirty = true;
+	}
+
 	ClearItemFactionBonuses();
 	SetShieldEquipped(false);
 	SetTwoHandBluntEquipped(false);
@@ -791,6 +795,10 @@ void Mob::CalcAABonuses(StatBonuses *newbon)
 {
 	memset(newbon, 0, sizeof(StatBonuses)); // start fresh
 
+	if (m_focus_index) {
+		m_focus_index->aas_dirty = true;
+	}
+
 	for (const auto &aa : aa_ranks) {
 		auto ability_rank = zone->GetAlternateAdvancementAbilityAndRank(aa.first, aa.second.first);
 		auto ability = ability_rank.first;
@@ -2030,6 +2038,10 @@ void Mob::CalcSpellBonuses(StatBonuses* newbon)
 	newbon->AggroRange = -1;
 	newbon->AssistRange = -1;
 
+	if (m_focus_index) {
+		m_focus_index->buffs_dirty = true;
+	}
+
 	int buff_count = GetMaxTotalSlots();
 	for (i = 0; i < buff_count; i++) {
 		if (IsValidSpell(buffs[i].spellid)) {
@@ -7434,6 +7434,7 @@ void EntityList::AddBot(Bot *new_bot, bool send_spawn_packet, bool dont_queue) {
 		new_bot->SetID(GetFreeID());
 		bot_list.push_back(new_bot);
 		mob_list.insert(std::pair<uint16, Mob*>(new_bot->GetID(), new_bot));
+		m_entity_grid.Add(new_bot);
 
 		if (parse->BotHasQuestSub(EVENT_SPAWN)) {
 			parse->EventBot(EVENT_SPAWN, new_bot, nullptr, "", 0);
@@ -7480,6 +7481,7 @@ bool EntityList::RemoveBot(uint16 entityID) {
 		for (std::list<Bot*>::iterator botListItr = bot_list.begin(); botListItr != bot_list.end(); ++botListItr) {
 			Bot* tempBot = *botListItr;
 			if (tempBot && tempBot->GetID() == entityID) {
+				m_entity_grid.Remove(tempBot);
 				bot_list.erase(botListItr);
 				Result = true;
 				break;
@@ -7605,19 +7607,18 @@ void EntityList::ShowSpawnWindow(Client* client, int Distance, bool NamedOnly) {
  */
 void EntityList::ScanCloseClientMobs(std::unordered_map<uint16, Mob*>& close_mobs, Mob* scanning_mob)
 {
-	float scan_range = RuleI(Range, MobCloseScanDistance) * RuleI(Range, MobCloseScanDistance);
+	const float scan_distance = RuleI(Range, MobCloseScanDistance);
+	const float scan_range = scan_distance * scan_distance;
 
 	close_mobs.clear();
 
-	for (auto& e : mob_list) {
-		auto mob = e.second;
-
+	auto add_close_client = [&](Mob* mob) {
 		if (!mob->IsClient()) {
-			continue;
+			return;
 		}
 
 		if (mob->GetID() <= 0) {
-			continue;
+			return;
 		}
 
 		float distance = DistanceSquared(scanning_mob->GetPosition(), mob->GetPosition());
@@ -7627,6 +7628,16 @@ void EntityList::ScanCloseClientMobs(std::unordered_map<uint16, Mob*>& close_mob
 		else if (mob->GetAggroRange() >= scan_range) {
 			close_mobs.insert(std::pair<uint16, Mob*>(mob->GetID(), mob));
 		}
+	};
+
+	m_entity_grid.SetCellSize(scan_distance);
+	m_entity_grid.ForEachInRange(scanning_mob->GetX(), scanning_mob->GetY(), scan_distance, add_close_client);
+
+	for (const auto& e : m_wide_aggro_mobs) {
+		auto it = mob_list.find(e);
+		if (it != mob_list.end() && !close_mobs.count(e)) {
+			add_close_client(it->second);
+		}
 	}
 
 	LogAIScanCloseDetail("Close Client Mob List Size [{}] for mob [{}]", close_mobs.size(), scanning_mob->GetCleanName());
@@ -424,9 +424,9 @@ public:
 	ProcessBotGroupAdd(Group* group, Raid* raid, Client* client = nullptr, bool new_raid = false, bool initial = false);
 
 
-	static std::list<BotSpell> GetBotSpellsForSpellEffect(Bot* botCaster, int spellEffect);
-	static std::list<BotSpell> GetBotSpellsForSpellEffectAndTargetType(Bot* botCaster, int spellEffect, SpellTargetType targetType);
-	static std::list<BotSpell> GetBotSpellsBySpellType(Bot* botCaster, uint32 spellType);
+	static const std::vector<BotSpell>& GetBotSpellsForSpellEffect(Bot* botCaster, int spellEffect);
+	static const std::vector<BotSpell>& GetBotSpellsForSpellEffectAndTargetType(Bot* botCaster, int spellEffect, SpellTargetType targetType);
+	static const std::vector<BotSpell>& GetBotSpellsBySpellType(Bot* botCaster, uint32 spellType);
 	static std::list<BotSpell_wPriority> GetPrioritizedBotSpellsBySpellType(Bot* botCaster, uint32 spellType);
 
 	static BotSpell GetFirstBotSpellBySpellType(Bot* botCaster, uint32 spellType);
@@ -829,6 +829,15 @@ protected:
 	std::vector<BotSpells_Struct> AIBot_spells_enforced;
 
 private:
+	// selection lists built from AIBot_spells the first time each one is asked for, so AI cast
+	// checks only walk a short prebuilt list, cleared whenever the spell list is reloaded
+	std::unordered_map<uint32, std::vector<BotSpell>> m_bot_spells_by_type;
+	std::unordered_map<int, std::vector<BotSpell>>    m_bot_spells_by_effect;
+	std::unordered_map<uint32, std::vector<BotSpell>> m_bot_spells_by_effect_target;
+
+	const std::vector<BotSpell>& BuildBotSpellIndex(std::vector<BotSpell>& index, const std::function<bool(const BotSpells_Struct&)>& matches);
+	void ClearBotSpellIndex();
+
 	// Class Members
 	uint32 _botID;
 	uint32 _botOwnerCharacterID;
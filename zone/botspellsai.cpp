@@ -427,7 +427,7 @@ bool Bot::BotCastDOT(Mob* tar, uint8 botLevel, const BotSpell& botSpell, const b
 			}
 		}
 		else {
-			std::list<BotSpell> dotList = GetBotSpellsBySpellType(this, SpellType_DOT);
+			const auto& dotList = GetBotSpellsBySpellType(this, SpellType_DOT);
 
 			const int maxDotSelect = 5;
 			int dotSelectCounter = 0;
@@ -527,7 +527,7 @@ bool Bot::BotCastCombatBuff(Mob* tar, uint8 botLevel, uint8 botClass) {
 
 	bool casted_spell = false;
 	if (tar->DontBuffMeBefore() < Timer::GetCurrentTime()) {
-		std::list<BotSpell> buffSpellList = GetBotSpellsBySpellType(this, SpellType_InCombatBuff);
+		const auto& buffSpellList = GetBotSpellsBySpellType(this, SpellType_InCombatBuff);
 
 		for (const auto& s : buffSpellList) {
 
@@ -845,7 +845,7 @@ bool Bot::BotCastEscape(Mob*& tar, uint8 botClass, BotSpell& botSpell, uint32 iS
 bool Bot::BotCastBuff(Mob* tar, uint8 botLevel, uint8 botClass) {
 	bool casted_spell = false;
 	if (tar->DontBuffMeBefore() < Timer::GetCurrentTime()) {
-		std::list<BotSpell> buffSpellList = GetBotSpellsBySpellType(this, SpellType_Buff);
+		const auto& buffSpellList = GetBotSpellsBySpellType(this, SpellType_Buff);
 
 		for(const auto& s : buffSpellList) {
 
@@ -1881,121 +1881,133 @@ bool Bot::AIHealRotation(Mob* tar, bool useFastHeals) {
 	return castedSpell;
 }
 
-std::list<BotSpell> Bot::GetBotSpellsForSpellEffect(Bot* botCaster, int spellEffect) {
-	std::list<BotSpell> result;
+const std::vector<BotSpell>& Bot::GetBotSpellsForSpellEffect(Bot* botCaster, int spellEffect) {
+	static const std::vector<BotSpell> empty;
 
 	if (!botCaster) {
-		return result;
+		return empty;
 	}
 
 	if (auto bot_owner = botCaster->GetBotOwner(); !bot_owner) {
-		return result;
+		return empty;
 	}
 
-	if (botCaster->AI_HasSpells()) {
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
-
-		for (int i = botSpellList.size() - 1; i >= 0; i--) {
-			if (!IsValidSpell(botSpellList[i].spellid)) {
-				// this is both to quit early to save cpu and to avoid casting bad spells
-				// Bad info from database can trigger this incorrectly, but that should be fixed in DB, not here
-				continue;
-			}
-
-			if (IsEffectInSpell(botSpellList[i].spellid, spellEffect) || GetSpellTriggerSpellID(botSpellList[i].spellid, spellEffect)) {
-				BotSpell botSpell;
-				botSpell.SpellId = botSpellList[i].spellid;
-				botSpell.SpellIndex = i;
-				botSpell.ManaCost = botSpellList[i].manacost;
+	if (!botCaster->AI_HasSpells()) {
+		return empty;
+	}
 
-				result.push_back(botSpell);
-			}
-		}
+	auto it = botCaster->m_bot_spells_by_effect.find(spellEffect);
+	if (it != botCaster->m_bot_spells_by_effect.end()) {
+		return it->second;
 	}
 
-	return result;
+	return botCaster->BuildBotSpellIndex(
+		botCaster->m_bot_spells_by_effect[spellEffect],
+		[spellEffect](const BotSpells_Struct& s) {
+			return IsEffectInSpell(s.spellid, spellEffect) || GetSpellTriggerSpellID(s.spellid, spellEffect);
+		}
+	);
 }
 
-std::list<BotSpell> Bot::GetBotSpellsForSpellEffectAndTargetType(Bot* botCaster, int spellEffect, SpellTargetType targetType) {
-	std::list<BotSpell> result;
+const std::vector<BotSpell>& Bot::GetBotSpellsForSpellEffectAndTargetType(Bot* botCaster, int spellEffect, SpellTargetType targetType) {
+	static const std::vector<BotSpell> empty;
 
 	if (!botCaster) {
-		return result;
+		return empty;
 	}
 
 	if (auto bot_owner = botCaster->GetBotOwner(); !bot_owner) {
-		return result;
+		return empty;
 	}
 
-	if (botCaster->AI_HasSpells()) {
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
+	if (!botCaster->AI_HasSpells()) {
+		return empty;
+	}
 
-		for (int i = botSpellList.size() - 1; i >= 0; i--) {
-			if (!IsValidSpell(botSpellList[i].spellid)) {
-				// this is both to quit early to save cpu and to avoid casting bad spells
-				// Bad info from database can trigger this incorrectly, but that should be fixed in DB, not here
-				continue;
-			}
+	const uint32 key = (static_cast<uint32>(spellEffect) << 8) | static_cast<uint8>(targetType);
 
-			if (
+	auto it = botCaster->m_bot_spells_by_effect_target.find(key);
+	if (it != botCaster->m_bot_spells_by_effect_target.end()) {
+		return it->second;
+	}
+
+	return botCaster->BuildBotSpellIndex(
+		botCaster->m_bot_spells_by_effect_target[key],
+		[spellEffect, targetType](const BotSpells_Struct& s) {
+			return (
 				(
-					IsEffectInSpell(botSpellList[i].spellid, spellEffect) ||
-					GetSpellTriggerSpellID(botSpellList[i].spellid, spellEffect)
+					IsEffectInSpell(s.spellid, spellEffect) ||
+					GetSpellTriggerSpellID(s.spellid, spellEffect)
 				) &&
-				spells[botSpellList[i].spellid].target_type == targetType
-			) {
-				BotSpell botSpell;
-				botSpell.SpellId = botSpellList[i].spellid;
-				botSpell.SpellIndex = i;
-				botSpell.ManaCost = botSpellList[i].manacost;
-				result.push_back(botSpell);
-			}
+				spells[s.spellid].target_type == targetType
+			);
 		}
-	}
-
-	return result;
+	);
 }
 
-std::list<BotSpell> Bot::GetBotSpellsBySpellType(Bot* botCaster, uint32 spellType) {
-	std::list<BotSpell> result;
+const std::vector<BotSpell>& Bot::GetBotSpellsBySpellType(Bot* botCaster, uint32 spellType) {
+	static const std::vector<BotSpell> empty;
 
 	if (!botCaster) {
-		return result;
+		return empty;
 	}
 
 	if (auto bot_owner = botCaster->GetBotOwner(); !bot_owner) {
-		return result;
+		return empty;
 	}
 
-	if (botCaster->AI_HasSpells()) {
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
+	if (!botCaster->AI_HasSpells()) {
+		return empty;
+	}
 
-		for (int i = botSpellList.size() - 1; i >= 0; i--) {
-			if (!IsValidSpell(botSpellList[i].spellid)) {
-				// this is both to quit early to save cpu and to avoid casting bad spells
-				// Bad info from database can trigger this incorrectly, but that should be fixed in DB, not here
-				continue;
-			}
+	auto it = botCaster->m_bot_spells_by_type.find(spellType);
+	if (it != botCaster->m_bot_spells_by_type.end()) {
+		return it->second;
+	}
 
-			if (botSpellList[i].type & spellType) {
-				BotSpell botSpell;
-				botSpell.SpellId = botSpellList[i].spellid;
-				botSpell.SpellIndex = i;
-				botSpell.ManaCost = botSpellList[i].manacost;
+	return botCaster->BuildBotSpellIndex(
+		botCaster->m_bot_spells_by_type[spellType],
+		[spellType](const BotSpells_Struct& s) {
+			return (s.type & spellType) != 0;
+		}
+	);
+}
 
-				result.push_back(botSpell);
-			}
+const std::vector<BotSpell>& Bot::BuildBotSpellIndex(std::vector<BotSpell>& index, const std::function<bool(const BotSpells_Struct&)>& matches) {
+	// walked back to front to keep the order the selection lists have always been handed out in
+	for (int i = AIBot_spells.size() - 1; i >= 0; i--) {
+		if (!IsValidSpell(AIBot_spells[i].spellid)) {
+			// this is both to quit early to save cpu and to avoid casting bad spells
+			// Bad info from database can trigger this incorrectly, but that should be fixed in DB, not here
+			continue;
+		}
+
+		if (matches(AIBot_spells[i])) {
+			BotSpell botSpell;
+			botSpell.SpellId = AIBot_spells[i].spellid;
+			botSpell.SpellIndex = i;
+			botSpell.ManaCost = AIBot_spells[i].manacost;
+
+			index.push_back(botSpell);
 		}
 	}
 
-	return result;
+	index.shrink_to_fit();
+
+	return index;
+}
+
+void Bot::ClearBotSpellIndex() {
+	m_bot_spells_by_type.clear();
+	m_bot_spells_by_effect.clear();
+	m_bot_spells_by_effect_target.clear();
 }
 
 std::list<BotSpell_wPriority> Bot::GetPrioritizedBotSpellsBySpellType(Bot* botCaster, uint32 spellType) {
 	std::list<BotSpell_wPriority> result;
 
 	if (botCaster && botCaster->AI_HasSpells()) {
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
+		const auto& botSpellList = botCaster->AIBot_spells;
 
 		for (int i = botSpellList.size() - 1; i >= 0; i--) {
 			if (!IsValidSpell(botSpellList[i].spellid)) {
@@ -2035,7 +2047,7 @@ BotSpell Bot::GetFirstBotSpellBySpellType(Bot* botCaster, uint32 spellType) {
 	result.ManaCost = 0;
 
 	if (botCaster && botCaster->AI_HasSpells()) {
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
+		const auto& botSpellList = botCaster->AIBot_spells;
 
 		for (int i = botSpellList.size() - 1; i >= 0; i--) {
 			if (!IsValidSpell(botSpellList[i].spellid)) {
@@ -2065,7 +2077,7 @@ BotSpell Bot::GetBestBotSpellForFastHeal(Bot *botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CurrentHP);
+		const auto& botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CurrentHP);
 
 		for (auto botSpellListItr : botSpellList) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
@@ -2090,8 +2102,8 @@ BotSpell Bot::GetBestBotSpellForHealOverTime(Bot* botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botHoTSpellList = GetBotSpellsForSpellEffect(botCaster, SE_HealOverTime);
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
+		const auto& botHoTSpellList = GetBotSpellsForSpellEffect(botCaster, SE_HealOverTime);
+		const auto& botSpellList = botCaster->AIBot_spells;
 
 		for (auto botSpellListItr : botHoTSpellList) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
@@ -2130,7 +2142,7 @@ BotSpell Bot::GetBestBotSpellForPercentageHeal(Bot *botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster && botCaster->AI_HasSpells()) {
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
+		const auto& botSpellList = botCaster->AIBot_spells;
 
 		for (int i = botSpellList.size() - 1; i >= 0; i--) {
 			if (!IsValidSpell(botSpellList[i].spellid)) {
@@ -2159,9 +2171,9 @@ BotSpell Bot::GetBestBotSpellForRegularSingleTargetHeal(Bot* botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CurrentHP);
+		const auto& botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CurrentHP);
 
-		for (std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (IsRegularSingleTargetHealSpell(botSpellListItr->SpellId) && CheckSpellRecastTimers(botCaster, botSpellListItr->SpellIndex)) {
 				result.SpellId = botSpellListItr->SpellId;
@@ -2183,9 +2195,9 @@ BotSpell Bot::GetFirstBotSpellForSingleTargetHeal(Bot* botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CurrentHP);
+		const auto& botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CurrentHP);
 
-		for (std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (
 				(
@@ -2213,9 +2225,9 @@ BotSpell Bot::GetBestBotSpellForGroupHeal(Bot* botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CurrentHP);
+		const auto& botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CurrentHP);
 
-		for (std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (
 				IsRegularGroupHealSpell(botSpellListItr->SpellId) &&
@@ -2240,10 +2252,10 @@ BotSpell Bot::GetBestBotSpellForGroupHealOverTime(Bot* botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botHoTSpellList = GetBotSpellsForSpellEffect(botCaster, SE_HealOverTime);
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
+		const auto& botHoTSpellList = GetBotSpellsForSpellEffect(botCaster, SE_HealOverTime);
+		const auto& botSpellList = botCaster->AIBot_spells;
 
-		for (std::list<BotSpell>::iterator botSpellListItr = botHoTSpellList.begin(); botSpellListItr != botHoTSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botHoTSpellList.begin(); botSpellListItr != botHoTSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (IsGroupHealOverTimeSpell(botSpellListItr->SpellId)) {
 
@@ -2281,9 +2293,9 @@ BotSpell Bot::GetBestBotSpellForGroupCompleteHeal(Bot* botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CompleteHeal);
+		const auto& botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_CompleteHeal);
 
-		for(std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (
 				IsGroupCompleteHealSpell(botSpellListItr->SpellId) &&
@@ -2308,9 +2320,9 @@ BotSpell Bot::GetBestBotSpellForMez(Bot* botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_Mez);
+		const auto& botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_Mez);
 
-		for (std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (
 				IsMesmerizeSpell(botSpellListItr->SpellId) &&
@@ -2336,9 +2348,9 @@ BotSpell Bot::GetBestBotSpellForMagicBasedSlow(Bot* botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_AttackSpeed);
+		const auto& botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_AttackSpeed);
 
-		for (std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (
 				IsSlowSpell(botSpellListItr->SpellId) &&
@@ -2364,9 +2376,9 @@ BotSpell Bot::GetBestBotSpellForDiseaseBasedSlow(Bot* botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_AttackSpeed);
+		const auto& botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_AttackSpeed);
 
-		for (std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (
 				IsSlowSpell(botSpellListItr->SpellId) &&
@@ -2431,11 +2443,11 @@ BotSpell Bot::GetBestBotMagicianPetSpell(Bot *botCaster) {
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_SummonPet);
+		const auto& botSpellList = GetBotSpellsForSpellEffect(botCaster, SE_SummonPet);
 
 		std::string petType = GetBotMagicianPetType(botCaster);
 
-		for(std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (IsSummonPetSpell(botSpellListItr->SpellId) && CheckSpellRecastTimers(botCaster, botSpellListItr->SpellIndex)) {
 				if (!strncmp(spells[botSpellListItr->SpellId].teleport_zone, petType.c_str(), petType.length())) {
@@ -2542,9 +2554,9 @@ BotSpell Bot::GetBestBotSpellForNukeByTargetType(Bot* botCaster, SpellTargetType
 	result.ManaCost = 0;
 
 	if (botCaster) {
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffectAndTargetType(botCaster, SE_CurrentHP, targetType);
+		const auto& botSpellList = GetBotSpellsForSpellEffectAndTargetType(botCaster, SE_CurrentHP, targetType);
 
-		for(std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if ((IsPureNukeSpell(botSpellListItr->SpellId) || IsDamageSpell(botSpellListItr->SpellId)) && CheckSpellRecastTimers(botCaster, botSpellListItr->SpellIndex)) {
 				result.SpellId = botSpellListItr->SpellId;
@@ -2569,9 +2581,9 @@ BotSpell Bot::GetBestBotSpellForStunByTargetType(Bot* botCaster, SpellTargetType
 
 	if (botCaster)
 	{
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffectAndTargetType(botCaster, SE_Stun, targetType);
+		const auto& botSpellList = GetBotSpellsForSpellEffectAndTargetType(botCaster, SE_Stun, targetType);
 
-		for(std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr)
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr)
 		{
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			if (IsStunSpell(botSpellListItr->SpellId) && CheckSpellRecastTimers(botCaster, botSpellListItr->SpellIndex))
@@ -2603,14 +2615,14 @@ BotSpell Bot::GetBestBotWizardNukeSpellByTargetResists(Bot* botCaster, Mob* targ
 			selectLureNuke = true;
 
 
-		std::list<BotSpell> botSpellList = GetBotSpellsForSpellEffectAndTargetType(botCaster, SE_CurrentHP, ST_Target);
+		const auto& botSpellList = GetBotSpellsForSpellEffectAndTargetType(botCaster, SE_CurrentHP, ST_Target);
 
 		BotSpell firstWizardMagicNukeSpellFound;
 		firstWizardMagicNukeSpellFound.SpellId = 0;
 		firstWizardMagicNukeSpellFound.SpellIndex = 0;
 		firstWizardMagicNukeSpellFound.ManaCost = 0;
 
-		for(std::list<BotSpell>::iterator botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
+		for (auto botSpellListItr = botSpellList.begin(); botSpellListItr != botSpellList.end(); ++botSpellListItr) {
 			// Assuming all the spells have been loaded into this list by level and in descending order
 			bool spellSelected = false;
 
@@ -2670,7 +2682,7 @@ BotSpell Bot::GetDebuffBotSpell(Bot* botCaster, Mob *tar) {
 		return result;
 
 	if (botCaster->AI_HasSpells()) {
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
+		const auto& botSpellList = botCaster->AIBot_spells;
 
 		for (int i = botSpellList.size() - 1; i >= 0; i--) {
 			if (!IsValidSpell(botSpellList[i].spellid)) {
@@ -2718,7 +2730,7 @@ BotSpell Bot::GetBestBotSpellForResistDebuff(Bot* botCaster, Mob *tar) {
 	bool needsDiseaseResistDebuff = (tar->GetDR() + level_mod) > 100;
 
 	if (botCaster->AI_HasSpells()) {
-		std::vector<BotSpells_Struct> botSpellList = botCaster->AIBot_spells;
+		const auto& botSpellList = botCaster->AIBot_spells;
 
 		for (int i = botSpellList.size() - 1; i >= 0; i--) {
 			if (!IsValidSpell(botSpellList[i].spellid)) {
@@ -3030,6 +3042,7 @@ bool Bot::AI_AddBotSpells(uint32 bot_spell_id) {
 	npc_spells_id = bot_spell_id;
 	AIBot_spells.clear();
 	AIBot_spells_enforced.clear();
+	ClearBotSpellIndex();
 	if (!bot_spell_id) {
 		AIautocastspell_timer->Disable();
 		return false;
@@ -3464,6 +3477,7 @@ void Bot::AddSpellToBotList(
 	t.bucket_comparison = in_bucket_comparison;
 
 	AIBot_spells.push_back(t);
+	ClearBotSpellIndex();
 
 	// If we're going from an empty list, we need to start the timer
 	if (AIBot_spells.empty()) {
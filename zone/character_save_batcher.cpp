@@ -0,0 +1,152 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2016 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "character_save_batcher.h"
+#include "../common/database.h"
+#include "../common/eqemu_logsys.h"
+
+#include <fmt/format.h>
+
+void CharacterSaveBatcher::Queue(
+	const std::string &table,
+	const std::string &columns,
+	const std::string &key,
+	const std::string &values
+)
+{
+	if (m_pending_rows == 0) {
+		m_first_queued = std::chrono::steady_clock::now();
+	}
+
+	auto &t = m_tables[table];
+	if (t.columns.empty()) {
+		t.columns = columns;
+	}
+
+	auto r = t.rows.find(key);
+	if (r != t.rows.end()) {
+		r->second = values;
+		m_pending_coalesced++;
+		return;
+	}
+
+	t.rows.emplace(key, values);
+	m_pending_rows++;
+}
+
+bool CharacterSaveBatcher::ShouldFlush(uint32 interval_ms, uint32 max_rows) const
+{
+	if (m_pending_rows == 0) {
+		return false;
+	}
+
+	if (max_rows > 0 && m_pending_rows >= max_rows) {
+		return true;
+	}
+
+	return std::chrono::steady_clock::now() - m_first_queued >= std::chrono::milliseconds(interval_ms);
+}
+
+CharacterSaveBatcher::FlushStats CharacterSaveBatcher::Flush(Database &db)
+{
+	FlushStats stats;
+	if (m_pending_rows == 0) {
+		return stats;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	std::string query;
+	for (auto &t : m_tables) {
+		if (t.second.rows.empty()) {
+			continue;
+		}
+
+		stats.tables++;
+
+		uint32 chunk_rows = 0;
+		for (auto &r : t.second.rows) {
+			if (chunk_rows == 0) {
+				query = fmt::format("REPLACE INTO `{}` ({}) VALUES ", t.first, t.second.columns);
+			}
+			else {
+				query += ", ";
+			}
+
+			query += "(";
+			query += r.second;
+			query += ")";
+
+			chunk_rows++;
+
+			if (chunk_rows == MAX_ROWS_PER_STATEMENT) {
+				stats.bytes += query.size();
+				stats.statements++;
+				if (!db.QueryDatabase(query).Success()) {
+					stats.failures++;
+				}
+
+				stats.rows += chunk_rows;
+				chunk_rows = 0;
+			}
+		}
+
+		if (chunk_rows > 0) {
+			stats.bytes += query.size();
+			stats.statements++;
+			if (!db.QueryDatabase(query).Success()) {
+				stats.failures++;
+			}
+
+			stats.rows += chunk_rows;
+		}
+
+		t.second.rows.clear();
+	}
+
+	stats.coalesced = m_pending_coalesced;
+	stats.duration_us = static_cast<uint64>(
+		std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()
+	);
+
+	m_pending_rows      = 0;
+	m_pending_coalesced = 0;
+
+	m_flush_count++;
+	m_rows_written += stats.rows;
+	m_statements_written += stats.statements;
+	m_rows_coalesced += stats.coalesced;
+	m_last_flush = stats;
+
+	LogDebug(
+		"Character save batch flushed tables [{}] rows [{}] statements [{}] coalesced [{}] bytes [{}] failures [{}] took [{}] us",
+		stats.tables,
+		stats.rows,
+		stats.statements,
+		stats.coalesced,
+		stats.bytes,
+		stats.failures,
+		stats.duration_us
+	);
+
+	if (stats.failures > 0) {
+		LogError("Character save batch had [{}] failed statement(s) out of [{}]", stats.failures, stats.statements);
+	}
+
+	return stats;
+}
@@ -0,0 +1,82 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2016 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+#ifndef CHARACTER_SAVE_BATCHER_H
+#define CHARACTER_SAVE_BATCHER_H
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "../common/types.h"
+
+class Database;
+
+/**
+ * Write-behind buffer for character sub-record saves (skills, currency, bandolier, ...)
+ *
+ * Rows are keyed by their primary key so repeated writes to the same row between flushes
+ * collapse into the latest value. A flush emits one multi-row REPLACE INTO per table, split
+ * into chunks of MAX_ROWS_PER_STATEMENT to stay well under max_allowed_packet
+ */
+class CharacterSaveBatcher {
+public:
+	struct FlushStats {
+		uint32 tables      = 0;
+		uint32 rows        = 0;
+		uint32 statements  = 0;
+		uint32 failures    = 0;
+		uint32 coalesced   = 0;
+		uint64 bytes       = 0;
+		uint64 duration_us = 0;
+	};
+
+	void Queue(const std::string &table, const std::string &columns, const std::string &key, const std::string &values);
+
+	bool ShouldFlush(uint32 interval_ms, uint32 max_rows) const;
+	FlushStats Flush(Database &db);
+
+	inline bool IsEmpty() const { return m_pending_rows == 0; }
+	inline uint32 GetPendingRowCount() const { return m_pending_rows; }
+
+	inline uint64 GetFlushCount() const { return m_flush_count; }
+	inline uint64 GetRowsWritten() const { return m_rows_written; }
+	inline uint64 GetStatementsWritten() const { return m_statements_written; }
+	inline uint64 GetRowsCoalesced() const { return m_rows_coalesced; }
+	inline const FlushStats &GetLastFlushStats() const { return m_last_flush; }
+
+private:
+	static constexpr uint32 MAX_ROWS_PER_STATEMENT = 500;
+
+	struct Table {
+		std::string                                  columns;
+		std::unordered_map<std::string, std::string> rows;
+	};
+
+	std::map<std::string, Table>          m_tables;
+	std::chrono::steady_clock::time_point m_first_queued;
+	uint32                                m_pending_rows       = 0;
+	uint32                                m_pending_coalesced  = 0;
+	uint64                                m_flush_count        = 0;
+	uint64                                m_rows_written       = 0;
+	uint64                                m_statements_written = 0;
+	uint64                                m_rows_coalesced     = 0;
+	FlushStats                            m_last_flush;
+};
+
+#endif
@@ -447,6 +447,9 @@ Client::~Client() {
 	// will need this data right away
 	Save(2); // This fails when database destructor is called first on shutdown
 
+	// the next zone loads this character straight from the database, nothing can stay buffered
+	database.FlushCharacterSaveBatch();
+
 	safe_delete(task_state);
 	safe_delete(KarmaUpdateTimer);
 	safe_delete(GlobalChatLimiterTimer);
@@ -734,6 +737,18 @@ bool Client::Save(uint8 iCommitNow) {
 
 	database.SaveCharacterData(this, &m_pp, &m_epp); /* Save Character Data */
 
+	/* Let world drop the character select it built for this account */
+	if (worldserver.Connected() && RuleI(World, CharacterSelectCacheSeconds) > 0) {
+		auto pack = new ServerPacket(ServerOP_CharacterSaved, sizeof(ServerCharacterSaved_Struct));
+		auto s    = (ServerCharacterSaved_Struct *) pack->pBuffer;
+
+		s->account_id   = AccountID();
+		s->character_id = CharacterID();
+
+		worldserver.SendPacket(pack);
+		safe_delete(pack);
+	}
+
 	return true;
 }
 
@@ -795,7 +810,7 @@ bool Client::SendAllPackets() {
 	return true;
 }
 
-void Client::QueuePacket(const EQApplicationPacket* app, bool ack_req, CLIENT_CONN_STATUS required_state, eqFilterType filter) {
+void Client::QueuePacket(const EQApplicationPacket* app, bool ack_req, CLIENT_CONN_STATUS required_state, eqFilterType filter, EncodedPacketCache *cache) {
 	if (filter != FilterNone && GetFilter(filter) == FilterHide) {
 		return;
 	}
@@ -811,7 +826,12 @@ void Client::QueuePacket(const EQApplicationPacket* app, bool ack_req, CLIENT_CO
 		AddPacket(app, ack_req);
 	}
 	else if (eqs) {
-		eqs->QueuePacket(app, ack_req);
+		if (cache) {
+			eqs->QueueBroadcastPacket(app, ack_req, *cache);
+		}
+		else {
+			eqs->QueuePacket(app, ack_req);
+		}
 	}
 }
 
@@ -126,6 +126,20 @@ Doors::~Doors()
 {
 }
 
+void Doors::SetOpenState(bool st)
+{
+	if (m_is_open == st) {
+		return;
+	}
+
+	m_is_open = st;
+
+	// routes cached through a doorway are only good for the state they were found in
+	if (zone && zone->pathing) {
+		zone->pathing->InvalidatePathCache();
+	}
+}
+
 bool Doors::Process()
 {
 	if (m_close_timer.Enabled() && m_close_timer.Check() && IsDoorOpen()) {
@@ -595,12 +609,12 @@ void Doors::Open(Mob *sender, bool alt_mode)
 				if (!m_disable_timer) {
 					m_close_timer.Start();
 				}
-				m_is_open = true;
+				SetOpenState(true);
 			}
 			else {
 				m_close_timer.Disable();
 				if (!m_disable_timer) {
-					m_is_open = false;
+					SetOpenState(false);
 				}
 			}
 		}
@@ -608,7 +622,7 @@ void Doors::Open(Mob *sender, bool alt_mode)
 			if (!m_disable_timer) {
 				m_close_timer.Start();
 			}
-			m_is_open = true;
+			SetOpenState(true);
 		}
 	}
 }
@@ -628,13 +642,13 @@ void Doors::ForceOpen(Mob *sender, bool alt_mode)
 				LogDoorsDetail("door_id [{}] starting timer", m_door_id);
 				m_close_timer.Start();
 			}
-			m_is_open = true;
+			SetOpenState(true);
 		}
 		else {
 			LogDoorsDetail("door_id [{}] disable timer", m_door_id);
 			m_close_timer.Disable();
 			if (!m_disable_timer) {
-				m_is_open = false;
+				SetOpenState(false);
 			}
 		}
 	}
@@ -643,7 +657,7 @@ void Doors::ForceOpen(Mob *sender, bool alt_mode)
 			LogDoorsDetail("door_id [{}] alt starting timer", m_door_id);
 			m_close_timer.Start();
 		}
-		m_is_open = true;
+		SetOpenState(true);
 	}
 }
 
@@ -662,11 +676,11 @@ void Doors::ForceClose(Mob *sender, bool alt_mode)
 			if (!m_disable_timer) {
 				m_close_timer.Start();
 			}
-			m_is_open = true;
+			SetOpenState(true);
 		}
 		else {
 			m_close_timer.Disable();
-			m_is_open = false;
+			SetOpenState(false);
 		}
 	}
 	else { // alternative function
@@ -690,11 +704,11 @@ void Doors::ToggleState(Mob *sender)
 
 	if (!m_is_open) {
 		move_door_packet->action = static_cast<uint8>(m_invert_state == 0 ? OPEN_DOOR : OPEN_INVDOOR);
-		m_is_open = true;
+		SetOpenState(true);
 	}
 	else {
 		move_door_packet->action = static_cast<uint8>(m_invert_state == 0 ? CLOSE_DOOR : CLOSE_INVDOOR);
-		m_is_open = false;
+		SetOpenState(false);
 	}
 
 	entity_list.QueueClients(sender, outapp, false);
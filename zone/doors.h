@@ -55,7 +55,7 @@ public:
 	void SetLocation(float x, float y, float z);
 	void SetLockpick(uint16 in) { m_lockpick = in; }
 	void SetNoKeyring(uint8 in) { m_no_key_ring = in; }
-	void SetOpenState(bool st) { m_is_open = st; }
+	void SetOpenState(bool st);
 	void SetOpenType(uint8 in);
 	void SetPosition(const glm::vec4 &position);
 	void SetSize(uint16 size);
@@ -94,7 +94,7 @@ private:
 	int       m_invert_state;
 	uint32    m_entity_id;
 	bool      m_disable_timer;
-	bool      m_is_open;
+	bool      m_is_open = false;
 	Timer     m_close_timer;
 	char      m_destination_zone_name[16];
 	int       m_destination_instance_id;
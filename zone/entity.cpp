@@ -30,6 +30,7 @@
 
 #include "../common/features.h"
 #include "../common/guilds.h"
+#include "../common/eq_stream_proxy.h"
 
 #include "entity.h"
 #include "dynamic_zone.h"
@@ -42,6 +43,8 @@
 #include "water_map.h"
 #include "npc_scale_manager.h"
 #include "dialogue_window.h"
+#include "zone_profiler.h"
+#include "../common/event/work_stealing_pool.h"
 
 #ifdef _WINDOWS
 	#define snprintf	_snprintf
@@ -331,6 +334,7 @@ void EntityList::AddClient(Client *client)
 	client->SetID(GetFreeID());
 	client_list.emplace(std::pair<uint16, Client *>(client->GetID(), client));
 	mob_list.emplace(std::pair<uint16, Mob *>(client->GetID(), client));
+	m_entity_grid.Add(client);
 }
 
 
@@ -469,15 +473,107 @@ void EntityList::CorpseProcess()
 	}
 }
 
+// times a single mob's Process and offers it as the tick's slowest mob
+static bool ProcessMobProfiled(Mob *mob)
+{
+	if (!zone_profiler.Enter(mob->IsClient() ? ZoneProfiler::ClientProcess : ZoneProfiler::NPCProcess)) {
+		return mob->Process();
+	}
+
+	const bool alive = mob->Process();
+	const uint64 ticks = zone_profiler.Leave();
+
+	if (!mob->IsClient()) {
+		zone_profiler.NoteMob(ticks, mob->GetNPCTypeID(), mob->GetCleanName());
+	}
+
+	return alive;
+}
+
+/**
+ * Read only half of the NPC AI tick
+ *
+ * Every eligible NPC works out its top hate target and NPC to NPC aggro candidates on the
+ * think pool while nothing else in the zone moves, AI_Process then applies those answers
+ * serially. Anything that rolls the zone RNG, raycasts, logs, sends packets or fires quest
+ * events stays in AI_Process. NPCs flagged with SetSerialAI skip this and decide everything
+ * in AI_Process like before
+ */
+void EntityList::AIThinkProcess()
+{
+	// a new tick id every pass so results from a pass that ran earlier are never picked up.
+	// 0 is what a think result that never ran holds
+	if (++m_ai_think_tick == 0) {
+		m_ai_think_tick = 1;
+	}
+
+	const int threads = RuleI(Zone, AIThinkThreads);
+	if (threads <= 0) {
+		m_ai_think_pool.reset();
+		return;
+	}
+
+	if (!m_ai_think_pool || m_ai_think_pool->GetThreadCount() != static_cast<size_t>(threads)) {
+		m_ai_think_pool = std::make_unique<EQ::Event::WorkStealingPool>(threads);
+	}
+
+	m_ai_think_npcs.clear();
+	for (auto &e : npc_list) {
+		NPC *npc = e.second;
+		if (
+			!npc->IsAIControlled() ||
+			npc->IsBot() ||
+			npc->IsMerc() ||
+			npc->GetDepop() ||
+			npc->IsSerialAI()
+		) {
+			continue;
+		}
+
+		m_ai_think_npcs.push_back(npc);
+	}
+
+	if (m_ai_think_npcs.size() < static_cast<size_t>(std::max(RuleI(Zone, AIThinkMinNPCs), 1))) {
+		return;
+	}
+
+	ZoneProfileScope profile(ZoneProfiler::AIThink);
+
+	const uint32 tick = m_ai_think_tick;
+	m_ai_think_pool->ParallelFor(
+		static_cast<uint32>(m_ai_think_npcs.size()),
+		[this, tick](uint32 i) {
+			m_ai_think_npcs[i]->AI_Think(tick);
+		}
+	);
+}
+
 void EntityList::MobProcess()
 {
 	bool mob_dead;
 
+	AIThinkProcess();
+
+	const float scan_range = RuleI(Range, MobCloseScanDistance) * RuleI(Range, MobCloseScanDistance);
+
 	auto it = mob_list.begin();
 	while (it != mob_list.end()) {
 		uint16 id = it->first;
 		Mob *mob = it->second;
 
+		// catches position changes that bypass SetPosition / ProcessMove
+		m_entity_grid.Update(mob, mob->GetX(), mob->GetY());
+
+		const bool wide_aggro = mob->GetAggroRange() >= scan_range;
+		if (wide_aggro || !m_wide_aggro_mobs.empty()) {
+			if (wide_aggro) {
+				m_wide_aggro_mobs.insert(id);
+			}
+			else {
+				m_wide_aggro_mobs.erase(id);
+			}
+		}
+
 		size_t sz = mob_list.size();
 
 #ifdef IDLE_WHEN_EMPTY
@@ -507,7 +603,7 @@ void EntityList::MobProcess()
 		//	-- the zone is newly empty and we're allowing mobs to settle
 		if (zone->process_mobs_while_empty || numclients > 0 ||
 			(s2 && s2->PathWhenZoneIdle()) || mob_settle_timer->Enabled()) {
-			mob_dead = !mob->Process();
+			mob_dead = !ProcessMobProfiled(mob);
 		}
 		else {
 			// spawn_events can cause spawns and deaths while zone empty.
@@ -515,7 +611,7 @@ void EntityList::MobProcess()
 			mob_dead = mob->CastToNPC()->GetDepop();
 		}
 #else
-		mob_dead = !mob->Process();
+		mob_dead = !ProcessMobProfiled(mob);
 #endif
 		size_t a_sz = mob_list.size();
 
@@ -673,6 +769,7 @@ void EntityList::AddNPC(NPC *npc, bool send_spawn_packet, bool dont_queue)
 
 	npc_list.emplace(std::pair<uint16, NPC *>(npc->GetID(), npc));
 	mob_list.emplace(std::pair<uint16, Mob *>(npc->GetID(), npc));
+	m_entity_grid.Add(npc);
 
 	entity_list.ScanCloseMobs(npc->close_mobs, npc, true);
 
@@ -754,6 +851,7 @@ void EntityList::AddMerc(Merc *merc, bool SendSpawnPacket, bool dontqueue)
 
 		merc_list.emplace(std::pair<uint16, Merc *>(merc->GetID(), merc));
 		mob_list.emplace(std::pair<uint16, Mob *>(merc->GetID(), merc));
+		m_entity_grid.Add(merc);
 	}
 }
 
@@ -1707,14 +1805,15 @@ void EntityList::QueueCloseClients(
 
 	float distance_squared = distance * distance;
 
-	for (auto &e : GetCloseMobList(sender, distance)) {
-		Mob *mob = e.second;
+	EncodedPacketCache cache(app);
+
+	auto queue_to_mob = [&](Mob *mob) {
 		if (!mob) {
-			continue;
+			return;
 		}
 
 		if (!mob->IsClient()) {
-			continue;
+			return;
 		}
 
 		Client *client = mob->CastToClient();
@@ -1722,11 +1821,11 @@ void EntityList::QueueCloseClients(
 		if ((!ignore_sender || client != sender) && (client != skipped_mob)) {
 
 			if (DistanceSquared(client->GetPosition(), sender->GetPosition()) >= distance_squared) {
-				continue;
+				return;
 			}
 
 			if (!client->Connected()) {
-				continue;
+				return;
 			}
 
 			eqFilterMode client_filter = client->GetFilter(filter);
@@ -1736,9 +1835,19 @@ void EntityList::QueueCloseClients(
 				 (sender == client || (client->GetGroup() && client->GetGroup()->IsGroupMember(sender)))) ||
 				(client_filter == FilterShowSelfOnly && client == sender)
 				) {
-				client->QueuePacket(app, is_ack_required, Client::CLIENT_CONNECTED);
+				client->QueuePacket(app, is_ack_required, Client::CLIENT_CONNECTED, FilterNone, &cache);
 			}
 		}
+	};
+
+	// beyond the close list range we only need to visit the grid cells the distance covers
+	if (distance > RuleI(Range, MobCloseScanDistance)) {
+		m_entity_grid.ForEachInRange(sender->GetX(), sender->GetY(), distance, queue_to_mob);
+		return;
+	}
+
+	for (auto &e : GetCloseMobList(sender, distance)) {
+		queue_to_mob(e.second);
 	}
 }
 
@@ -1748,12 +1857,14 @@ void EntityList::QueueClients(
 	bool ignore_sender, bool ackreq
 )
 {
+	EncodedPacketCache cache(app);
+
 	auto it = client_list.begin();
 	while (it != client_list.end()) {
 		Client *ent = it->second;
 
 		if ((!ignore_sender || ent != sender))
-			ent->QueuePacket(app, ackreq, Client::CLIENT_CONNECTED);
+			ent->QueuePacket(app, ackreq, Client::CLIENT_CONNECTED, FilterNone, &cache);
 
 		++it;
 	}
@@ -2649,6 +2760,9 @@ void EntityList::RemoveAllMobs()
 		free_ids.push(it->first);
 		it = mob_list.erase(it);
 	}
+
+	m_entity_grid.Clear();
+	m_wide_aggro_mobs.clear();
 }
 
 void EntityList::RemoveAllClients()
@@ -2788,6 +2902,7 @@ bool EntityList::RemoveMob(uint16 delete_id)
 		else if (client_list.count(delete_id)) {
 			entity_list.RemoveClient(delete_id);
 		}
+		RemoveMobFromEntityGrid(it->second);
 		safe_delete(it->second);
 		if (!corpse_list.count(delete_id)) {
 			free_ids.push(it->first);
@@ -2808,6 +2923,7 @@ bool EntityList::RemoveNPC(uint16 delete_id)
 	if (it != npc_list.end()) {
 		NPC *npc = it->second;
 		RemoveProximity(delete_id);
+		RemoveMobFromEntityGrid(npc);
 		npc_list.erase(it);
 
 		if (npc_limit_list.count(delete_id)) {
@@ -2849,6 +2965,25 @@ bool EntityList::RemoveMobFromCloseLists(Mob *mob)
 	return false;
 }
 
+/**
+ * @param mob
+ * @param x
+ * @param y
+ */
+void EntityList::UpdateEntityGrid(Mob *mob, float x, float y)
+{
+	m_entity_grid.Update(mob, x, y);
+}
+
+/**
+ * @param mob
+ */
+void EntityList::RemoveMobFromEntityGrid(Mob *mob)
+{
+	m_entity_grid.Remove(mob);
+	m_wide_aggro_mobs.erase(mob->GetID() > 0 ? mob->GetID() : mob->GetInitialId());
+}
+
 /**
  * @param mob
  * @return
@@ -2907,19 +3042,20 @@ void EntityList::ScanCloseMobs(
 	bool add_self_to_other_lists
 )
 {
-	float scan_range = RuleI(Range, MobCloseScanDistance) * RuleI(Range, MobCloseScanDistance);
+	const float scan_distance = RuleI(Range, MobCloseScanDistance);
+	const float scan_range    = scan_distance * scan_distance;
 
 	close_mobs.clear();
 
-	for (auto &e : mob_list) {
-		auto mob = e.second;
+	m_entity_grid.SetCellSize(scan_distance);
 
+	auto add_close_mob = [&](Mob *mob) {
 		if (!mob->IsNPC() && !mob->IsClient() && !mob->IsBot() && !mob->IsMerc()) {
-			continue;
+			return;
 		}
 
 		if (mob->GetID() <= 0) {
-			continue;
+			return;
 		}
 
 		float distance = DistanceSquared(scanning_mob->GetPosition(), mob->GetPosition());
@@ -2927,19 +3063,19 @@ void EntityList::ScanCloseMobs(
 			close_mobs.emplace(std::pair<uint16, Mob *>(mob->GetID(), mob));
 
 			if (add_self_to_other_lists && scanning_mob->GetID() > 0) {
-				bool has_mob = false;
+				mob->close_mobs.emplace(std::pair<uint16, Mob *>(scanning_mob->GetID(), scanning_mob));
+			}
+		}
+	};
 
-				for (auto &cm: mob->close_mobs) {
-					if (scanning_mob->GetID() == cm.first) {
-						has_mob = true;
-						break;
-					}
-				}
+	m_entity_grid.Update(scanning_mob, scanning_mob->GetX(), scanning_mob->GetY());
+	m_entity_grid.ForEachInRange(scanning_mob->GetX(), scanning_mob->GetY(), scan_distance, add_close_mob);
 
-				if (!has_mob) {
-					mob->close_mobs.insert(std::pair<uint16, Mob *>(scanning_mob->GetID(), scanning_mob));
-				}
-			}
+	// mobs with an aggro range beyond the scan range are close regardless of which cell they are in
+	for (const auto &e : m_wide_aggro_mobs) {
+		auto it = mob_list.find(e);
+		if (it != mob_list.end() && !close_mobs.count(e)) {
+			add_close_mob(it->second);
 		}
 	}
 
@@ -2955,6 +3091,7 @@ bool EntityList::RemoveMerc(uint16 delete_id)
 {
 	auto it = merc_list.find(delete_id);
 	if (it != merc_list.end()) {
+		m_entity_grid.Remove(it->second);
 		merc_list.erase(it); // Already Deleted
 		return true;
 	}
@@ -2965,6 +3102,7 @@ bool EntityList::RemoveClient(uint16 delete_id)
 {
 	auto it = client_list.find(delete_id);
 	if (it != client_list.end()) {
+		m_entity_grid.Remove(it->second);
 		client_list.erase(it); // Already deleted
 		return true;
 	}
@@ -2977,6 +3115,7 @@ bool EntityList::RemoveClient(Client *delete_client)
 	auto it = client_list.begin();
 	while (it != client_list.end()) {
 		if (it->second == delete_client) {
+			m_entity_grid.Remove(delete_client);
 			client_list.erase(it);
 			return true;
 		}
@@ -3862,6 +4001,8 @@ struct quest_proximity_event {
 
 void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 {
+	m_entity_grid.Update(c, location.x, location.y);
+
 	float last_x = c->ProximityX();
 	float last_y = c->ProximityY();
 	float last_z = c->ProximityZ();
@@ -3990,6 +4131,8 @@ void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 }
 
 void EntityList::ProcessMove(NPC *n, float x, float y, float z) {
+	m_entity_grid.Update(n, x, y);
+
 	float last_x = n->GetX();
 	float last_y = n->GetY();
 	float last_z = n->GetZ();
@@ -19,7 +19,10 @@
 #define ENTITY_H
 
 #include <unordered_map>
+#include <unordered_set>
 #include <queue>
+#include <memory>
+#include <vector>
 
 #include "../common/types.h"
 #include "../common/linked_list.h"
@@ -31,6 +34,7 @@
 #include "position.h"
 #include "zonedump.h"
 #include "common.h"
+#include "entity_grid.h"
 
 class Encounter;
 class Beacon;
@@ -58,6 +62,12 @@ struct Who_All_Struct;
 
 class Bot;
 
+namespace EQ {
+	namespace Event {
+		class WorkStealingPool;
+	}
+}
+
 extern EntityList entity_list;
 
 class Entity
@@ -295,6 +305,8 @@ public:
 	bool	RemoveObject(uint16 delete_id);
 	bool	RemoveProximity(uint16 delete_npc_id);
 	bool	RemoveMobFromCloseLists(Mob *mob);
+	void	UpdateEntityGrid(Mob *mob, float x, float y);
+	void	RemoveMobFromEntityGrid(Mob *mob);
 	void    RemoveAuraFromMobs(Mob *aura);
 	void	RemoveAllMobs();
 	void	RemoveAllClients();
@@ -541,6 +553,9 @@ public:
 
 	std::unordered_map<uint16, Mob *> &GetCloseMobList(Mob *mob, float distance = 0.0f);
 
+	// think results stamped with an older tick are ignored by AI_Process
+	inline uint32 GetAIThinkTick() const { return m_ai_think_tick; }
+
 	void	DepopAll(int NPCTypeID, bool StartSpawnTimer = true);
 
 	uint16 GetFreeID();
@@ -586,6 +601,13 @@ private:
 	std::unordered_map<uint16, Trap *> trap_list;
 	std::unordered_map<uint16, Beacon *> beacon_list;
 	std::unordered_map<uint16, Encounter *> encounter_list;
+	EntityGrid m_entity_grid;
+	std::unordered_set<uint16> m_wide_aggro_mobs; // mobs whose aggro range reaches past the close scan range
+
+	void AIThinkProcess();
+	std::unique_ptr<EQ::Event::WorkStealingPool> m_ai_think_pool;
+	std::vector<NPC *> m_ai_think_npcs;
+	uint32 m_ai_think_tick = 0;
 	std::list<NPC *> proximity_list;
 	std::list<Group *> group_list;
 	std::list<Raid *> raid_list;
@@ -0,0 +1,119 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2016 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "entity_grid.h"
+#include "mob.h"
+
+void EntityGrid::SetCellSize(float cell_size)
+{
+	if (cell_size <= 0.0f || cell_size == m_cell_size) {
+		return;
+	}
+
+	m_cell_size = cell_size;
+
+	// re-bucket everything we already track against the new cell size
+	std::vector<Mob *> mobs;
+	mobs.reserve(m_locations.size());
+	for (const auto &c : m_cells) {
+		mobs.insert(mobs.end(), c.second.begin(), c.second.end());
+	}
+
+	Clear();
+
+	for (auto *mob : mobs) {
+		Add(mob);
+	}
+}
+
+void EntityGrid::Add(Mob *mob)
+{
+	if (!mob || mob->GetID() == 0) {
+		return;
+	}
+
+	Remove(mob);
+	Insert(mob, GetCellKey(GetCellCoord(mob->GetX()), GetCellCoord(mob->GetY())));
+}
+
+void EntityGrid::Update(Mob *mob, float x, float y)
+{
+	if (!mob) {
+		return;
+	}
+
+	auto it = m_locations.find(mob);
+	if (it == m_locations.end()) {
+		return;
+	}
+
+	const uint64 cell = GetCellKey(GetCellCoord(x), GetCellCoord(y));
+	if (it->second.cell == cell) {
+		return;
+	}
+
+	Erase(it->second);
+	Insert(mob, cell);
+}
+
+void EntityGrid::Remove(Mob *mob)
+{
+	auto it = m_locations.find(mob);
+	if (it == m_locations.end()) {
+		return;
+	}
+
+	Erase(it->second);
+	m_locations.erase(it);
+}
+
+void EntityGrid::Clear()
+{
+	m_cells.clear();
+	m_locations.clear();
+}
+
+void EntityGrid::Insert(Mob *mob, uint64 cell)
+{
+	auto &bucket = m_cells[cell];
+	m_locations[mob] = Location{cell, static_cast<uint32>(bucket.size())};
+	bucket.push_back(mob);
+}
+
+void EntityGrid::Erase(const Location &location)
+{
+	auto it = m_cells.find(location.cell);
+	if (it == m_cells.end()) {
+		return;
+	}
+
+	auto &bucket = it->second;
+	const uint32 index = location.index;
+
+	// swap and pop, fixing up the index of the entry we moved into the hole
+	if (index + 1 < bucket.size()) {
+		bucket[index] = bucket.back();
+		m_locations[bucket[index]].index = index;
+	}
+
+	bucket.pop_back();
+
+	if (bucket.empty()) {
+		m_cells.erase(it);
+	}
+}
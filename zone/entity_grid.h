@@ -0,0 +1,120 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2016 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+#ifndef ENTITY_GRID_H
+#define ENTITY_GRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "../common/types.h"
+
+class Mob;
+
+/**
+ * Uniform x/y grid of mobs used to answer range queries by visiting nearby cells only
+ *
+ * Cells are only a coarse filter; callers are still expected to do an exact distance check
+ * against the live mob position. Entries are re-bucketed when a mob crosses a cell boundary
+ * (ProcessMove / SetPosition) and once per MobProcess tick to catch direct position writes.
+ * Entries are keyed by the mob itself, a dying npc clears its id and its corpse takes it over
+ */
+class EntityGrid {
+public:
+	EntityGrid() = default;
+
+	void SetCellSize(float cell_size);
+	inline float GetCellSize() const { return m_cell_size; }
+
+	void Add(Mob *mob);
+	void Update(Mob *mob, float x, float y);
+	void Remove(Mob *mob);
+	void Clear();
+
+	inline bool Contains(Mob *mob) const { return m_locations.find(mob) != m_locations.end(); }
+	inline size_t GetEntityCount() const { return m_locations.size(); }
+	inline size_t GetCellCount() const { return m_cells.size(); }
+
+	/**
+	 * Invokes callback(Mob *) for every mob bucketed in a cell overlapping the square of
+	 * half-width range around x/y. Falls back to visiting every occupied cell when the query
+	 * area covers more cells than are occupied
+	 */
+	template<typename Callback>
+	void ForEachInRange(float x, float y, float range, Callback callback) const
+	{
+		if (m_cells.empty()) {
+			return;
+		}
+
+		const int32 span = static_cast<int32>(std::clamp(std::ceil(range / m_cell_size), 1.0f, 65535.0f));
+		const uint64 area = static_cast<uint64>(span * 2 + 1) * static_cast<uint64>(span * 2 + 1);
+
+		if (area >= m_cells.size()) {
+			for (const auto &c : m_cells) {
+				for (auto *mob : c.second) {
+					callback(mob);
+				}
+			}
+
+			return;
+		}
+
+		const int32 cell_x = GetCellCoord(x);
+		const int32 cell_y = GetCellCoord(y);
+
+		for (int32 cx = cell_x - span; cx <= cell_x + span; ++cx) {
+			for (int32 cy = cell_y - span; cy <= cell_y + span; ++cy) {
+				auto it = m_cells.find(GetCellKey(cx, cy));
+				if (it == m_cells.end()) {
+					continue;
+				}
+
+				for (auto *mob : it->second) {
+					callback(mob);
+				}
+			}
+		}
+	}
+
+private:
+	struct Location {
+		uint64 cell;
+		uint32 index;
+	};
+
+	inline int32 GetCellCoord(float v) const
+	{
+		// clamp so sentinel positions (FLT_MAX proximity resets) stay inside int32
+		return static_cast<int32>(std::clamp(std::floor(v / m_cell_size), -1.0e9f, 1.0e9f));
+	}
+	inline static uint64 GetCellKey(int32 cx, int32 cy)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(cx)) << 32) | static_cast<uint32>(cy);
+	}
+
+	void Insert(Mob *mob, uint64 cell);
+	void Erase(const Location &location);
+
+	float                                       m_cell_size = 600.0f;
+	std::unordered_map<uint64, std::vector<Mob *>> m_cells;
+	std::unordered_map<Mob *, Location>         m_locations;
+};
+
+#endif
@@ -8,13 +8,30 @@ extern Zone *zone;
 
 std::vector<int> GlobalLootManager::GetGlobalLootTables(NPC *mob) const
 {
-	// we may be able to add a cache here if performance is an issue, but for now
-	// just return NRVO'd vector
-	// The cache would have to be keyed by NPCType and level (for NPCs with Max Level set)
+	// only entries for this race, or no race at all, are looked at, merged back into load order
+	// so tables are still added in the same order
 	std::vector<int> tables;
 
-	for (auto &e : m_entries) {
-		if (e.PassesRules(mob)) {
+	auto race = m_race_index.find(mob->GetRace());
+
+	const std::vector<size_t> empty;
+	const auto &race_entries = race != m_race_index.end() ? race->second : empty;
+
+	const int level = mob->GetLevel();
+
+	auto r = race_entries.begin();
+	auto a = m_any_race.begin();
+	while (r != race_entries.end() || a != m_any_race.end()) {
+		size_t index;
+		if (a == m_any_race.end() || (r != race_entries.end() && *r < *a)) {
+			index = *r++;
+		}
+		else {
+			index = *a++;
+		}
+
+		auto &e = m_entries[index];
+		if (e.PassesLevel(level) && e.PassesRules(mob)) {
 			tables.push_back(e.GetLootTableID());
 		}
 	}
@@ -22,6 +39,38 @@ std::vector<int> GlobalLootManager::GetGlobalLootTables(NPC *mob) const
 	return tables;
 }
 
+void GlobalLootManager::Clear()
+{
+	m_entries.clear();
+	m_race_index.clear();
+	m_any_race.clear();
+}
+
+void GlobalLootManager::AddEntry(GlobalLootEntry &in)
+{
+	const size_t index = m_entries.size();
+	m_entries.push_back(in);
+
+	bool has_race = false;
+	for (auto &r : in.GetRules()) {
+		if (r.type != GlobalLoot::RuleTypes::Race) {
+			continue;
+		}
+
+		has_race = true;
+
+		// the same race listed twice should still only add the table once
+		auto &entries = m_race_index[r.value];
+		if (entries.empty() || entries.back() != index) {
+			entries.push_back(index);
+		}
+	}
+
+	if (!has_race) {
+		m_any_race.push_back(index);
+	}
+}
+
 void GlobalLootManager::ShowZoneGlobalLoot(Client *c) const
 {
 	std::string global_loot_table;
@@ -95,6 +144,19 @@ void GlobalLootManager::ShowNPCGlobalLoot(Client *c, NPC *t) const
 	);
 }
 
+void GlobalLootEntry::AddRule(GlobalLoot::RuleTypes rule, int value)
+{
+	m_rules.emplace_back(rule, value);
+
+	// level bounds are kept outside the rule list so most entries can be skipped without walking it
+	if (rule == GlobalLoot::RuleTypes::LevelMin) {
+		m_min_level = std::max(m_min_level, value);
+	}
+	else if (rule == GlobalLoot::RuleTypes::LevelMax) {
+		m_max_level = m_max_level ? std::min(m_max_level, value) : value;
+	}
+}
+
 bool GlobalLootEntry::PassesRules(NPC *mob) const
 {
 	bool bRace = false;
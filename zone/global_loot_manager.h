@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 class NPC;
 class Client;
@@ -34,27 +35,35 @@ class GlobalLootEntry {
 	int m_loottable_id;
 	std::string m_description;
 	std::vector<GlobalLoot::Rule> m_rules;
+	int m_min_level;
+	int m_max_level;
 public:
 	GlobalLootEntry(int id, int loottable, std::string des)
-		: m_id(id), m_loottable_id(loottable), m_description(std::move(des))
+		: m_id(id), m_loottable_id(loottable), m_description(std::move(des)), m_min_level(0), m_max_level(0)
 	{ }
 	bool PassesRules(NPC *mob) const;
+	bool PassesLevel(int level) const { return level >= m_min_level && (!m_max_level || level <= m_max_level); }
+	const std::vector<GlobalLoot::Rule> &GetRules() const { return m_rules; }
 	inline int GetLootTableID() const { return m_loottable_id; }
 	inline int GetID() const { return m_id; }
 	inline const std::string &GetDescription() const { return m_description; }
 	inline void SetLootTableID(int in) { m_loottable_id = in; }
 	inline void SetID(int in) { m_id = in; }
 	inline void SetDescription(const std::string &in) { m_description = in; }
-	inline void AddRule(GlobalLoot::RuleTypes rule, int value) { m_rules.emplace_back(rule, value); }
+	void AddRule(GlobalLoot::RuleTypes rule, int value);
 };
 
 class GlobalLootManager {
 	std::vector<GlobalLootEntry> m_entries;
 
+	// entry indexes in load order, entries with race rules are only listed under those races
+	std::unordered_map<int, std::vector<size_t>> m_race_index;
+	std::vector<size_t>                          m_any_race;
+
 public:
 	std::vector<int> GetGlobalLootTables(NPC *mob) const;
-	inline void Clear() { m_entries.clear(); }
-	inline void AddEntry(GlobalLootEntry &in) { m_entries.push_back(in); }
+	void Clear();
+	void AddEntry(GlobalLootEntry &in);
 	void ShowZoneGlobalLoot(Client *to) const;
 	void ShowNPCGlobalLoot(Client *to, NPC *who) const;
 };
@@ -0,0 +1,279 @@
+#include "../client.h"
+#include "../map.h"
+#include "../zone.h"
+#include "../zone_profiler.h"
+
+#ifdef LUA_EQEMU
+#include "../lua_parser.h"
+
+extern const char *LuaEvents[_LargestEventID];
+#endif
+
+void command_profile(Client *c, const Seperator *sep)
+{
+	int arguments = sep->argnum;
+
+	bool is_events   = arguments && !strcasecmp(sep->arg[1], "events");
+	bool is_lua      = arguments && !strcasecmp(sep->arg[1], "lua");
+	bool is_map      = arguments && !strcasecmp(sep->arg[1], "map");
+	bool is_overruns = arguments && !strcasecmp(sep->arg[1], "overruns");
+	bool is_reset    = arguments && !strcasecmp(sep->arg[1], "reset");
+	bool is_show     = !arguments || !strcasecmp(sep->arg[1], "show");
+	if (
+		!is_events &&
+		!is_lua &&
+		!is_map &&
+		!is_overruns &&
+		!is_reset &&
+		!is_show
+	) {
+		c->Message(Chat::White, "Usage: #profile [show] - Shows time spent in each section of the zone tick");
+		c->Message(Chat::White, "Usage: #profile events - Shows the slowest quest events");
+		c->Message(Chat::White, "Usage: #profile lua - Shows Lua event dispatch counts and time spent in Lua");
+		c->Message(Chat::White, "Usage: #profile map - Shows height field and line of sight cache hit rates");
+		c->Message(Chat::White, "Usage: #profile overruns - Shows recent ticks that ran over budget and what caused them");
+		c->Message(Chat::White, "Usage: #profile reset - Clears all collected timings");
+		return;
+	}
+
+	if (is_reset) {
+		zone_profiler.Reset();
+#ifdef LUA_EQEMU
+		LuaParser::Instance()->ResetDispatchStats();
+#endif
+		c->Message(Chat::White, "Zone profile has been reset.");
+		return;
+	}
+
+	if (is_map) {
+		if (!zone->zonemap) {
+			c->Message(Chat::White, "This zone has no map loaded.");
+			return;
+		}
+
+		auto stats = zone->zonemap->GetCacheStats();
+
+		const uint64 best_z_total = stats.height_field_hits + stats.height_field_fallbacks;
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"Height Field | {} Cells: {} Resolved: {} Hits: {} Fallbacks: {} Hit Rate: {:.1f}%",
+				stats.height_field_loaded ? "Loaded" : "Not Loaded",
+				stats.height_field_cells,
+				stats.height_field_resolved,
+				stats.height_field_hits,
+				stats.height_field_fallbacks,
+				best_z_total ? 100.0 * stats.height_field_hits / best_z_total : 0.0
+			).c_str()
+		);
+
+		const uint64 los_total = stats.los_hits + stats.los_misses;
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"LoS Cache | Entries: {}/{} Hits: {} Misses: {} Evictions: {} Hit Rate: {:.1f}%",
+				stats.los_entries,
+				stats.los_capacity,
+				stats.los_hits,
+				stats.los_misses,
+				stats.los_evictions,
+				los_total ? 100.0 * stats.los_hits / los_total : 0.0
+			).c_str()
+		);
+
+		return;
+	}
+
+	if (is_lua) {
+#ifdef LUA_EQEMU
+		auto parser = LuaParser::Instance();
+
+		std::vector<QuestEventID> events;
+		uint64                    total_ns = 0;
+		for (int i = 0; i < _LargestEventID; i++) {
+			const auto &s = parser->GetDispatchStats(static_cast<QuestEventID>(i));
+			if (s.count) {
+				events.push_back(static_cast<QuestEventID>(i));
+				total_ns += s.total_ns;
+			}
+		}
+
+		if (events.empty()) {
+			c->Message(Chat::White, "No Lua events have been dispatched yet.");
+			return;
+		}
+
+		std::sort(
+			events.begin(),
+			events.end(),
+			[parser](QuestEventID a, QuestEventID b) {
+				return parser->GetDispatchStats(a).total_ns > parser->GetDispatchStats(b).total_ns;
+			}
+		);
+
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"Lua Profile | Event Types: {} Total: {:.2f} ms",
+				events.size(),
+				total_ns / 1000000.0
+			).c_str()
+		);
+
+		const size_t max_events = 10;
+		for (size_t i = 0; i < events.size() && i < max_events; i++) {
+			const auto &s = parser->GetDispatchStats(events[i]);
+
+			c->Message(
+				Chat::White,
+				fmt::format(
+					"Event {} | {} Calls: {} Errors: {} Total: {:.2f} ms Average: {:.1f} us Max: {:.1f} us",
+					i + 1,
+					LuaEvents[events[i]],
+					s.count,
+					s.errors,
+					s.total_ns / 1000000.0,
+					s.total_ns / 1000.0 / s.count,
+					s.max_ns / 1000.0
+				).c_str()
+			);
+		}
+#else
+		c->Message(Chat::White, "This zone was built without Lua support.");
+#endif
+		return;
+	}
+
+	if (!zone_profiler.IsEnabled()) {
+		c->Message(Chat::White, "The tick profiler is disabled, see the Zone:EnableTickProfiler rule.");
+		return;
+	}
+
+	if (is_show) {
+		const auto &tick = zone_profiler.GetHistogram(ZoneProfiler::Tick);
+
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"Zone Profile | Ticks: {} Overruns: {} (over {} ms) Average Tick: {:.2f} ms Max Tick: {:.2f} ms",
+				zone_profiler.GetTickCount(),
+				zone_profiler.GetOverrunCount(),
+				zone_profiler.GetOverrunBudgetMS(),
+				tick.count ? zone_profiler.TicksToMicroseconds(tick.total_ticks) / tick.count / 1000.0 : 0.0,
+				zone_profiler.TicksToMicroseconds(tick.max_ticks) / 1000.0
+			).c_str()
+		);
+
+		for (uint16 i = ZoneProfiler::Tick + 1; i < ZoneProfiler::MaxSection; i++) {
+			const auto &h = zone_profiler.GetHistogram(i);
+			if (!h.count) {
+				continue;
+			}
+
+			c->Message(
+				Chat::White,
+				fmt::format(
+					"{} | Share: {:.1f}% Average: {:.1f} us Max: {:.1f} us Calls: {}",
+					ZoneProfiler::GetFrameName(i),
+					tick.total_ticks ? 100.0 * h.total_ticks / tick.total_ticks : 0.0,
+					zone_profiler.TicksToMicroseconds(h.total_ticks) / h.count,
+					zone_profiler.TicksToMicroseconds(h.max_ticks),
+					h.count
+				).c_str()
+			);
+		}
+
+		return;
+	}
+
+	if (is_events) {
+		std::vector<uint16> frames;
+		for (uint16 i = ZoneProfiler::QUEST_EVENT_FRAME_BASE; i < ZoneProfiler::MAX_FRAMES; i++) {
+			if (zone_profiler.GetHistogram(i).count) {
+				frames.push_back(i);
+			}
+		}
+
+		if (frames.empty()) {
+			c->Message(Chat::White, "No quest events have been profiled yet.");
+			return;
+		}
+
+		std::sort(
+			frames.begin(),
+			frames.end(),
+			[](uint16 a, uint16 b) {
+				return zone_profiler.GetHistogram(a).total_ticks > zone_profiler.GetHistogram(b).total_ticks;
+			}
+		);
+
+		const size_t max_events = 10;
+		for (size_t i = 0; i < frames.size() && i < max_events; i++) {
+			const auto &h = zone_profiler.GetHistogram(frames[i]);
+
+			c->Message(
+				Chat::White,
+				fmt::format(
+					"Event {} | {} Total: {:.2f} ms Average: {:.1f} us Max: {:.1f} us Calls: {}",
+					i + 1,
+					ZoneProfiler::GetFrameName(frames[i]),
+					zone_profiler.TicksToMicroseconds(h.total_ticks) / 1000.0,
+					zone_profiler.TicksToMicroseconds(h.total_ticks) / h.count,
+					zone_profiler.TicksToMicroseconds(h.max_ticks),
+					h.count
+				).c_str()
+			);
+		}
+
+		return;
+	}
+
+	const auto &overruns = zone_profiler.GetOverruns();
+	if (overruns.empty()) {
+		c->Message(Chat::White, "No ticks have run over budget.");
+		return;
+	}
+
+	for (const auto &o : overruns) {
+		uint16 slowest = ZoneProfiler::Tick + 1;
+		for (uint16 i = slowest + 1; i < ZoneProfiler::MaxSection; i++) {
+			if (o.section_ticks[i] > o.section_ticks[slowest]) {
+				slowest = i;
+			}
+		}
+
+		std::string culprit;
+		if (o.worst_mob.ticks) {
+			culprit += fmt::format(
+				" Slowest Mob: {} ({}) {:.1f} ms",
+				o.worst_mob.name,
+				o.worst_mob.npc_type_id,
+				zone_profiler.TicksToMicroseconds(o.worst_mob.ticks) / 1000.0
+			);
+		}
+
+		if (o.worst_quest_event.ticks) {
+			culprit += fmt::format(
+				" Slowest Event: {} {} ({}) {:.1f} ms",
+				ZoneProfiler::GetQuestSourceName(o.worst_quest_event.source),
+				ZoneProfiler::GetFrameName(
+					ZoneProfiler::QuestEventFrame(static_cast<QuestEventID>(o.worst_quest_event.event_id))
+				),
+				o.worst_quest_event.source_id,
+				zone_profiler.TicksToMicroseconds(o.worst_quest_event.ticks) / 1000.0
+			);
+		}
+
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"Tick {} | {:.1f} ms Slowest Section: {} {:.1f} ms{}",
+				o.tick_number,
+				zone_profiler.TicksToMicroseconds(o.tick_ticks) / 1000.0,
+				ZoneProfiler::GetFrameName(slowest),
+				zone_profiler.TicksToMicroseconds(o.section_ticks[slowest]) / 1000.0,
+				culprit
+			).c_str()
+		);
+	}
+}
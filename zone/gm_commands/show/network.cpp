@@ -129,6 +129,15 @@ void ShowNetwork(Client *c, const Seperator *sep)
 		DialogueWindow::TableCell(Strings::Commify(opts.daybreak_options.port))
 	);
 
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Batched IO") +
+		DialogueWindow::TableCell(
+			opts.daybreak_options.batched_io ?
+			fmt::format("Yes ({} Per Batch)", Strings::Commify(opts.daybreak_options.batch_size)) :
+			"No"
+		)
+	);
+
 	popup_table = DialogueWindow::Table(popup_table);
 
 	c->SendPopupToClient(
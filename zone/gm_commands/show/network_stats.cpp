@@ -244,6 +244,88 @@ void ShowNetworkStats(Client *c, const Seperator *sep)
 
 	popup_table += DialogueWindow::Break(2);
 
+	const auto& socket_stats = eqs_stats.SocketStats;
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Socket Received Datagrams") +
+		DialogueWindow::TableCell(
+			fmt::format(
+				"{} ({:.2f} Per Syscall)",
+				Strings::Commify(socket_stats.recv_datagrams),
+				socket_stats.recv_syscalls ? static_cast<double>(socket_stats.recv_datagrams) / socket_stats.recv_syscalls : 0.0
+			)
+		)
+	);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Socket Sent Datagrams") +
+		DialogueWindow::TableCell(
+			fmt::format(
+				"{} ({:.2f} Per Syscall)",
+				Strings::Commify(socket_stats.send_datagrams),
+				socket_stats.send_syscalls ? static_cast<double>(socket_stats.send_datagrams) / socket_stats.send_syscalls : 0.0
+			)
+		)
+	);
+
+	if (socket_stats.send_errors) {
+		popup_table += DialogueWindow::TableRow(
+			DialogueWindow::TableCell("Socket Send Errors") +
+			DialogueWindow::TableCell(Strings::Commify(socket_stats.send_errors))
+		);
+	}
+
+	popup_table += DialogueWindow::Break(2);
+
+	for (const auto& e : eqs_stats.CompressionStats) {
+		const auto& s = e.second;
+
+		popup_table += DialogueWindow::TableRow(
+			DialogueWindow::TableCell(
+				fmt::format(
+					"Compress {} (0x{:02x})",
+					EQ::Net::DaybreakCompressor::GetOpcodeName(e.first),
+					e.first
+				)
+			) +
+			DialogueWindow::TableCell(
+				fmt::format(
+					"{} Packets ({} Skipped) {:.2f}%% Ratio {:.2f} us Average",
+					Strings::Commify(s.packets),
+					Strings::Commify(s.skipped),
+					s.bytes_in ? static_cast<double>(s.bytes_out) / static_cast<double>(s.bytes_in) * 100.0 : 0.0,
+					s.nanoseconds / 1000.0 / s.packets
+				)
+			)
+		);
+	}
+
+	for (const auto& e : eqs_stats.DecompressionStats) {
+		const auto& s = e.second;
+
+		popup_table += DialogueWindow::TableRow(
+			DialogueWindow::TableCell(
+				fmt::format(
+					"Decompress {} (0x{:02x})",
+					EQ::Net::DaybreakCompressor::GetOpcodeName(e.first),
+					e.first
+				)
+			) +
+			DialogueWindow::TableCell(
+				fmt::format(
+					"{} Packets {:.2f}%% Ratio {:.2f} us Average",
+					Strings::Commify(s.packets),
+					s.bytes_in ? static_cast<double>(s.bytes_out) / static_cast<double>(s.bytes_in) * 100.0 : 0.0,
+					s.nanoseconds / 1000.0 / s.packets
+				)
+			)
+		);
+	}
+
+	if (!eqs_stats.CompressionStats.empty() || !eqs_stats.DecompressionStats.empty()) {
+		popup_table += DialogueWindow::Break(2);
+	}
+
 	std::string sent_rows;
 
 	for (int i = 0; i < _maxEmuOpcode; ++i) {
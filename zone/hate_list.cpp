@@ -29,13 +29,17 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "zone.h"
 #include "water_map.h"
 
+#include <algorithm>
 #include <list>
 
 extern Zone *zone;
 
 HateList::HateList()
 {
-	hate_owner = nullptr;
+	hate_owner      = nullptr;
+	m_frenzy_count  = 0;
+	m_next_sequence = 0;
+	m_version       = 0;
 }
 
 HateList::~HateList()
@@ -44,11 +48,16 @@ HateList::~HateList()
 
 void HateList::WipeHateList()
 {
-	auto iterator = list.begin();
-
-	while (iterator != list.end())
-	{
-		Mob* m = (*iterator)->entity_on_hatelist;
+	// detach everything up front, quest handlers fired below may add to this list again
+	auto entries = std::move(list);
+	list.clear();
+	m_heap.clear();
+	m_index.clear();
+	m_frenzy_count = 0;
+	m_version++;
+
+	for (auto e : entries) {
+		Mob* m = e->entity_on_hatelist;
 		if (m)
 		{
 			if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
@@ -60,9 +69,7 @@ void HateList::WipeHateList()
 				m->CastToClient()->RemoveXTarget(hate_owner, true);
 			}
 		}
-		delete (*iterator);
-		iterator = list.erase(iterator);
-
+		delete e;
 	}
 }
 
@@ -75,14 +82,199 @@ bool HateList::IsEntOnHateList(Mob *mob)
 
 struct_HateList *HateList::Find(Mob *in_entity)
 {
-	auto iterator = list.begin();
-	while (iterator != list.end())
-	{
-		if ((*iterator)->entity_on_hatelist == in_entity)
-			return (*iterator);
-		++iterator;
+	auto it = m_index.find(in_entity);
+	return it != m_index.end() ? it->second : nullptr;
+}
+
+void HateList::Erase(struct_HateList *entry)
+{
+	auto it = std::find(list.begin(), list.end(), entry);
+	if (it != list.end()) {
+		list.erase(it);
+	}
+
+	HeapRemove(entry);
+
+	if (entry->is_entity_frenzy) {
+		m_frenzy_count--;
+	}
+
+	auto i = m_index.find(entry->entity_on_hatelist);
+	if (i != m_index.end() && i->second == entry) {
+		m_index.erase(i);
+
+		// quests can point two entries at the same mob, keep the next one findable
+		for (auto e : list) {
+			if (e->entity_on_hatelist == entry->entity_on_hatelist) {
+				m_index.emplace(e->entity_on_hatelist, e);
+				break;
+			}
+		}
+	}
+
+	delete entry;
+}
+
+void HateList::SetEntryEnt(struct_HateList *entry, Mob *ent)
+{
+	if (entry->entity_on_hatelist == ent) {
+		return;
+	}
+
+	auto i = m_index.find(entry->entity_on_hatelist);
+	if (i != m_index.end() && i->second == entry) {
+		m_index.erase(i);
+	}
+
+	entry->entity_on_hatelist = ent;
+	m_index.emplace(ent, entry);
+	m_version++;
+}
+
+void HateList::SetEntryHate(struct_HateList *entry, int64 hate)
+{
+	if (entry->stored_hate_amount == hate) {
+		return;
+	}
+
+	entry->stored_hate_amount = hate;
+	HeapUpdate(entry);
+}
+
+void HateList::SetEntryFrenzy(struct_HateList *entry, bool is_frenzy)
+{
+	if (entry->is_entity_frenzy == is_frenzy) {
+		return;
+	}
+
+	entry->is_entity_frenzy = is_frenzy;
+	m_version++;
+	if (is_frenzy) {
+		m_frenzy_count++;
+	}
+	else {
+		m_frenzy_count--;
+	}
+}
+
+static inline bool HateHeapBefore(const struct_HateList *a, const struct_HateList *b)
+{
+	if (a->stored_hate_amount != b->stored_hate_amount) {
+		return a->stored_hate_amount > b->stored_hate_amount;
+	}
+
+	return a->sequence < b->sequence;
+}
+
+void HateList::HeapPush(struct_HateList *entry)
+{
+	entry->heap_index = static_cast<uint32>(m_heap.size());
+	m_heap.push_back(entry);
+	HeapSiftUp(entry->heap_index);
+	m_version++;
+}
+
+void HateList::HeapRemove(struct_HateList *entry)
+{
+	const uint32 index = entry->heap_index;
+	if (index >= m_heap.size() || m_heap[index] != entry) {
+		return;
+	}
+
+	m_version++;
+
+	auto last = m_heap.back();
+	m_heap.pop_back();
+
+	if (last != entry) {
+		m_heap[index]    = last;
+		last->heap_index = index;
+		HeapUpdate(last);
+	}
+}
+
+void HateList::HeapUpdate(struct_HateList *entry)
+{
+	m_version++;
+	HeapSiftUp(entry->heap_index);
+	HeapSiftDown(entry->heap_index);
+}
+
+void HateList::HeapSiftUp(uint32 index)
+{
+	auto entry = m_heap[index];
+	while (index > 0) {
+		const uint32 parent = (index - 1) / 2;
+		if (!HateHeapBefore(entry, m_heap[parent])) {
+			break;
+		}
+
+		m_heap[index]             = m_heap[parent];
+		m_heap[index]->heap_index = index;
+		index = parent;
+	}
+
+	m_heap[index]     = entry;
+	entry->heap_index = index;
+}
+
+void HateList::HeapSiftDown(uint32 index)
+{
+	auto         entry = m_heap[index];
+	const uint32 size  = static_cast<uint32>(m_heap.size());
+
+	for (;;) {
+		uint32 child = index * 2 + 1;
+		if (child >= size) {
+			break;
+		}
+
+		if (child + 1 < size && HateHeapBefore(m_heap[child + 1], m_heap[child])) {
+			child++;
+		}
+
+		if (!HateHeapBefore(m_heap[child], entry)) {
+			break;
+		}
+
+		m_heap[index]             = m_heap[child];
+		m_heap[index]->heap_index = index;
+		index = child;
+	}
+
+	m_heap[index]     = entry;
+	entry->heap_index = index;
+}
+
+template<typename Callback>
+void HateList::ForEachByHate(Callback callback)
+{
+	if (m_heap.empty()) {
+		return;
+	}
+
+	// best first walk of the heap, the frontier only grows by the children of what we visit
+	auto frontier_before = [this](uint32 a, uint32 b) {
+		return HateHeapBefore(m_heap[b], m_heap[a]);
+	};
+
+	std::vector<uint32> frontier;
+	frontier.push_back(0);
+
+	while (!frontier.empty()) {
+		std::pop_heap(frontier.begin(), frontier.end(), frontier_before);
+		const uint32 index = frontier.back();
+		frontier.pop_back();
+
+		if (!callback(m_heap[index])) {
+			return;
+		}
+
+		for (uint32 child = index * 2 + 1; child <= index * 2 + 2 && child < m_heap.size(); ++child) {
+			frontier.push_back(child);
+			std::push_heap(frontier.begin(), frontier.end(), frontier_before);
+		}
 	}
-	return nullptr;
 }
 
 void HateList::SetHateAmountOnEnt(Mob* other, int64 in_hate, uint64 in_damage)
@@ -93,7 +285,7 @@ void HateList::SetHateAmountOnEnt(Mob* other, int64 in_hate, uint64 in_damage)
 		if (in_damage > 0)
 			entity->hatelist_damage = in_damage;
 		if (in_hate > 0)
-			entity->stored_hate_amount = in_hate;
+			SetEntryHate(entity, in_hate);
 		entity->last_modified = Timer::GetCurrentTime();
 	}
 }
@@ -211,8 +403,8 @@ void HateList::AddEntToHateList(Mob *in_entity, int64 in_hate, int64 in_damage,
 	struct_HateList *entity = Find(in_entity);
 	if (entity) {
 		entity->hatelist_damage += (in_damage >= 0) ? in_damage : 0;
-		entity->stored_hate_amount += in_hate;
-		entity->is_entity_frenzy = in_is_entity_frenzied;
+		SetEntryHate(entity, entity->stored_hate_amount + in_hate);
+		SetEntryFrenzy(entity, in_is_entity_frenzied);
 		entity->last_modified = Timer::GetCurrentTime();
 
 		LogHate(
@@ -232,7 +424,16 @@ void HateList::AddEntToHateList(Mob *in_entity, int64 in_hate, int64 in_damage,
 		entity->is_entity_frenzy = in_is_entity_frenzied;
 		entity->oor_count = 0;
 		entity->last_modified = Timer::GetCurrentTime();
+		entity->hate_list = this;
+		entity->heap_index = 0;
+		entity->sequence = m_next_sequence++;
 		list.push_back(entity);
+		m_index.emplace(in_entity, entity);
+		HeapPush(entity);
+
+		if (in_is_entity_frenzied) {
+			m_frenzy_count++;
+		}
 
 		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
 			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "1", 0);
@@ -250,30 +451,25 @@ bool HateList::RemoveEntFromHateList(Mob *in_entity)
 		return false;
 	}
 
-	bool is_found = false;
-	auto iterator = list.begin();
-
-	while (iterator != list.end()) {
-		if ((*iterator)->entity_on_hatelist == in_entity) {
-			is_found = true;
-
-			if (in_entity && in_entity->IsClient()) {
-				in_entity->CastToClient()->DecrementAggroCount();
-			}
+	// quests can leave more than one entry pointing at the same mob, remove them all
+	// before firing events so a handler re-adding the mob is not removed again
+	int removed_count = 0;
+	while (auto entry = Find(in_entity)) {
+		Erase(entry);
+		removed_count++;
+	}
 
-			delete (*iterator);
-			iterator = list.erase(iterator);
+	for (int i = 0; i < removed_count; i++) {
+		if (in_entity->IsClient()) {
+			in_entity->CastToClient()->DecrementAggroCount();
+		}
 
-			if (in_entity) {
-				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
-					parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "0", 0);
-				}
-			}
-		} else {
-			++iterator;
+		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
+			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "0", 0);
 		}
 	}
-	return is_found;
+
+	return removed_count > 0;
 }
 
 // so if faction_id and faction_value are set, we do RewardFaction, otherwise old stuff
@@ -349,35 +545,39 @@ Mob *HateList::GetEntWithMostHateOnList(Mob *center, Mob *skip, bool skip_mezzed
 	if (center == nullptr)
 		return nullptr;
 
+	// frenzied entries win regardless of hate, so only a full scan in list order gives the same answer
+	const bool walk_by_hate = m_frenzy_count == 0;
+
 	if (RuleB(Aggro, SmartAggroList)){
 		Mob* top_client_type_in_range = nullptr;
 		int64 hate_client_type_in_range = -1;
 		int skipped_count = 0;
 
-		auto iterator = list.begin();
-		while (iterator != list.end())
-		{
-			struct_HateList *cur = (*iterator);
-			int16 aggro_mod = 0;
+		// the most any positive aggro modifier can scale stored hate by, used to stop the hate ordered walk early
+		const int64 max_aggro_mod = (
+			std::max(RuleI(Aggro, SittingAggroMod), 0) +
+			std::max(RuleI(Aggro, CurrentTargetAggroMod), 0) +
+			std::max(RuleI(Aggro, MeleeRangeAggroMod), 0) +
+			std::max(RuleI(Aggro, CriticallyWoundedAggroMod), 0)
+		);
 
-			if (!cur){
-				++iterator;
-				continue;
-			}
+		auto is_tank_type = [](Mob *m) {
+			return m->IsClient() || m->IsBot() || m->IsMerc() || m->GetSpecialAbility(ALLOW_TO_TANK);
+		};
+
+		auto consider = [&](struct_HateList *cur) {
+			int16 aggro_mod = 0;
 
-			if (!cur->entity_on_hatelist){
-				++iterator;
-				continue;
+			if (!cur || !cur->entity_on_hatelist) {
+				return;
 			}
 
 			if (cur->entity_on_hatelist == skip) {
-				++iterator;
-				continue;
+				return;
 			}
 
 			if (skip_mezzed && cur->entity_on_hatelist->IsMezzed()) {
-				++iterator;
-				continue;
+				return;
 			}
 
 			if (cur->entity_on_hatelist->Sanctuary()) {
@@ -386,8 +586,7 @@ Mob *HateList::GetEntWithMostHateOnList(Mob *center, Mob *skip, bool skip_mezzed
 					top_hate = cur->entity_on_hatelist;
 					hate = 1;
 				}
-				++iterator;
-				continue;
+				return;
 			}
 
 			if (cur->entity_on_hatelist->DivineAura() || cur->entity_on_hatelist->IsMezzed() || cur->entity_on_hatelist->IsFeared()){
@@ -396,8 +595,7 @@ Mob *HateList::GetEntWithMostHateOnList(Mob *center, Mob *skip, bool skip_mezzed
 					top_hate = cur->entity_on_hatelist;
 					hate = 0;
 				}
-				++iterator;
-				continue;
+				return;
 			}
 
 			int64 current_hate = cur->stored_hate_amount;
@@ -449,8 +647,33 @@ Mob *HateList::GetEntWithMostHateOnList(Mob *center, Mob *skip, bool skip_mezzed
 				hate = current_hate;
 				top_hate = cur->entity_on_hatelist;
 			}
+		};
+
+		if (walk_by_hate) {
+			ForEachByHate(
+				[&](struct_HateList *cur) {
+					const int64 stored = cur->stored_hate_amount;
+
+					// nothing from here down can out-hate the current top, and the in range
+					// client fallback is either settled or will not be used
+					if (
+						top_hate &&
+						stored >= 0 &&
+						stored + (stored * max_aggro_mod / 100) <= hate &&
+						(is_tank_type(top_hate) || (top_client_type_in_range && stored <= hate_client_type_in_range))
+					) {
+						return false;
+					}
 
-			++iterator;
+					consider(cur);
+					return true;
+				}
+			);
+		}
+		else {
+			for (auto cur : list) {
+				consider(cur);
+			}
 		}
 
 		if (top_client_type_in_range != nullptr && top_hate != nullptr) {
@@ -489,30 +712,43 @@ Mob *HateList::GetEntWithMostHateOnList(Mob *center, Mob *skip, bool skip_mezzed
 		}
 	}
 	else{
-		auto iterator = list.begin();
 		int skipped_count = 0;
-		while (iterator != list.end())
-		{
-			struct_HateList *cur = (*iterator);
-			if (cur) {
-				if (cur->entity_on_hatelist == skip) {
-					++iterator;
-					continue;
-				}
 
-				if (skip_mezzed && cur->entity_on_hatelist->IsMezzed()) {
-					++iterator;
-					continue;
-				}
+		auto consider = [&](struct_HateList *cur) {
+			if (!cur) {
+				return;
+			}
 
-				if (cur->entity_on_hatelist != nullptr && ((cur->stored_hate_amount > hate) || cur->is_entity_frenzy))
-				{
-					top_hate = cur->entity_on_hatelist;
-					hate = cur->stored_hate_amount;
+			if (cur->entity_on_hatelist == skip) {
+				return;
+			}
+
+			if (skip_mezzed && cur->entity_on_hatelist->IsMezzed()) {
+				return;
+			}
+
+			if (cur->entity_on_hatelist != nullptr && ((cur->stored_hate_amount > hate) || cur->is_entity_frenzy))
+			{
+				top_hate = cur->entity_on_hatelist;
+				hate = cur->stored_hate_amount;
+			}
+		};
+
+		if (walk_by_hate) {
+			// the first usable entry in hate order is the answer
+			ForEachByHate(
+				[&](struct_HateList *cur) {
+					consider(cur);
+					return top_hate == nullptr;
 				}
+			);
+		}
+		else {
+			for (auto cur : list) {
+				consider(cur);
 			}
-			++iterator;
 		}
+
 		if (top_hate == nullptr && skipped_count > 0) {
 			return center->GetTarget() ? center->GetTarget() : nullptr;
 		}
@@ -523,41 +759,31 @@ Mob *HateList::GetEntWithMostHateOnList(Mob *center, Mob *skip, bool skip_mezzed
 
 Mob *HateList::GetEntWithMostHateOnList(bool skip_mezzed){
 	Mob* top = nullptr;
-	int64 hate = -1;
 
-	auto iterator = list.begin();
-	while (iterator != list.end())
-	{
-		struct_HateList *cur = (*iterator);
+	ForEachByHate(
+		[&](struct_HateList *cur) {
+			if (!cur->entity_on_hatelist) {
+				return true;
+			}
+
+			if (skip_mezzed && cur->entity_on_hatelist->IsMezzed()) {
+				return true;
+			}
 
-		if (cur) {
 			LogHateDetail(
-				"Looping GetEntWithMostHateOnList1 [{}] cur [{}] hate [{}] calc [{}]",
+				"GetEntWithMostHateOnList [{}] hate [{}]",
 				cur->entity_on_hatelist->GetMobDescription(),
-				cur->stored_hate_amount,
-				hate,
-				(cur->stored_hate_amount > hate)
+				cur->stored_hate_amount
 			);
 
-			if (cur->entity_on_hatelist != nullptr && (cur->stored_hate_amount > hate))
-			{
-				LogHateDetail(
-					"Looping GetEntWithMostHateOnList2 [{}]",
-					cur->entity_on_hatelist->GetMobDescription()
-				);
-
-				if (!skip_mezzed || !cur->entity_on_hatelist->IsMezzed()) {
-					top = cur->entity_on_hatelist;
-					hate = cur->stored_hate_amount;
-				}
-			}
+			top = cur->entity_on_hatelist;
+			return false;
 		}
-		++iterator;
-	}
+	);
+
 	return top;
 }
 
-
 Mob *HateList::GetRandomEntOnHateList(bool skip_mezzed)
 {
 	int count = list.size();
@@ -803,46 +1029,52 @@ void HateList::SpellCast(Mob *caster, uint32 spell_id, float range, Mob* ae_cent
 
 void HateList::RemoveStaleEntries(int time_ms, float dist)
 {
-	auto it = list.begin();
-
 	auto cur_time = Timer::GetCurrentTime();
 
 	auto dist2 = dist * dist;
 
-	while (it != list.end()) {
-		auto m = (*it)->entity_on_hatelist;
+	std::vector<Mob *> stale;
+	for (auto e : list) {
+		auto m = e->entity_on_hatelist;
 		if (m) {
 			bool remove = false;
 
-			if (cur_time - (*it)->last_modified > time_ms) {
+			if (cur_time - e->last_modified > time_ms) {
 				remove = true;
 			}
 
 			if (!remove && DistanceSquaredNoZ(hate_owner->GetPosition(), m->GetPosition()) > dist2) {
-				(*it)->oor_count++;
-				if ((*it)->oor_count == 2) {
+				e->oor_count++;
+				if (e->oor_count == 2) {
 					remove = true;
 				}
-			} else if ((*it)->oor_count != 0) {
-				(*it)->oor_count = 0;
+			} else if (e->oor_count != 0) {
+				e->oor_count = 0;
 			}
 
 			if (remove) {
-				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
-					parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), m, "0", 0);
-				}
+				stale.push_back(m);
+			}
+		}
+	}
 
-				if (m->IsClient()) {
-					m->CastToClient()->DecrementAggroCount();
-					m->CastToClient()->RemoveXTarget(hate_owner, true);
-				}
+	// erase before firing events so quest handlers always see a consistent list
+	for (auto m : stale) {
+		auto e = Find(m);
+		if (!e) {
+			continue;
+		}
 
-				delete (*it);
-				it = list.erase(it);
-				continue;
-			}
+		Erase(e);
+
+		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
+			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), m, "0", 0);
+		}
+
+		if (m->IsClient()) {
+			m->CastToClient()->DecrementAggroCount();
+			m->CastToClient()->RemoveXTarget(hate_owner, true);
 		}
-		++it;
 	}
 }
 
@@ -1012,9 +1244,9 @@ void HateList::DamageHateList(int64 damage, uint32 distance, EntityFilterType fi
 	}
 }
 
-std::list<struct_HateList*> HateList::GetFilteredHateList(EntityFilterType filter_type, uint32 distance)
+std::vector<struct_HateList*> HateList::GetFilteredHateList(EntityFilterType filter_type, uint32 distance)
 {
-	std::list<struct_HateList*> l;
+	std::vector<struct_HateList*> l;
 	const auto squared_distance = (distance * distance);
 	for (auto h : list) {
 		auto e = h->entity_on_hatelist;
@@ -21,19 +21,26 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 
 #include "../common/emu_constants.h"
 
+#include <unordered_map>
+#include <vector>
+
 class Client;
 class Group;
+class HateList;
 class Mob;
 class Raid;
 struct ExtraAttackOptions;
 
 struct struct_HateList {
-	Mob    *entity_on_hatelist;
-	int64  hatelist_damage;
-	int64  stored_hate_amount;
-	bool   is_entity_frenzy;
-	int8   oor_count; // count on how long we've been out of range
-	uint32 last_modified; // we need to remove this if it gets higher than 10 mins
+	Mob      *entity_on_hatelist;
+	int64    hatelist_damage;
+	int64    stored_hate_amount;
+	bool     is_entity_frenzy;
+	int8     oor_count; // count on how long we've been out of range
+	uint32   last_modified; // we need to remove this if it gets higher than 10 mins
+	HateList *hate_list; // owning list, quest setters go through it so the hate heap stays ordered
+	uint32   heap_index;
+	uint64   sequence; // insertion order, breaks hate ties the same way a front to back scan would
 };
 
 class HateList {
@@ -62,9 +69,12 @@ public:
 
 	int64 GetEntHateAmount(Mob *ent, bool in_damage = false);
 
-	std::list<struct_HateList *> &GetHateList() { return list; }
+	std::vector<struct_HateList *> &GetHateList() { return list; }
+
+	// bumped on every add, remove and hate change, lets cached answers tell if the list moved under them
+	inline uint64 GetVersion() const { return m_version; }
 
-	std::list<struct_HateList *> GetFilteredHateList(
+	std::vector<struct_HateList *> GetFilteredHateList(
 		EntityFilterType filter_type = EntityFilterType::All,
 		uint32 distance = 0
 	);
@@ -91,12 +101,33 @@ public:
 	void WipeHateList();
 	void RemoveStaleEntries(int time_ms, float dist);
 
+	// used by quest hate entry setters so the entity index and hate heap follow direct edits
+	void SetEntryEnt(struct_HateList *entry, Mob *ent);
+	void SetEntryHate(struct_HateList *entry, int64 hate);
+	void SetEntryFrenzy(struct_HateList *entry, bool is_frenzy);
 
 protected:
 	struct_HateList *Find(Mob *ent);
 private:
-	std::list<struct_HateList *> list;
-	Mob                          *hate_owner;
+	void Erase(struct_HateList *entry);
+
+	void HeapPush(struct_HateList *entry);
+	void HeapRemove(struct_HateList *entry);
+	void HeapUpdate(struct_HateList *entry);
+	void HeapSiftUp(uint32 index);
+	void HeapSiftDown(uint32 index);
+
+	// visits entries in descending stored hate order until callback returns false
+	template<typename Callback>
+	void ForEachByHate(Callback callback);
+
+	std::vector<struct_HateList *>                     list; // insertion order, what GetHateList exposes
+	std::vector<struct_HateList *>                     m_heap; // max-heap on stored hate
+	std::unordered_map<const Mob *, struct_HateList *> m_index;
+	uint32                                             m_frenzy_count;
+	uint64                                             m_next_sequence;
+	uint64                                             m_version;
+	Mob                                                *hate_owner;
 };
 
 #endif
@@ -158,75 +158,95 @@ void ZoneDatabase::AddLootDropToNPC(NPC *npc, uint32 lootdrop_id, ItemList *item
 		droplimit = mindrop;
 	}
 
-	float roll_t                   = 0.0f;
-	float no_loot_prob             = 1.0f;
-	bool  roll_table_chance_bypass = false;
-	bool  active_item_list         = false;
-
-	for (uint32 i = 0; i < loot_drop->NumEntries; ++i) {
-		const EQ::ItemData *db_item = GetItem(loot_drop->Entries[i].item_id);
-		if (db_item && npc->MeetsLootDropLevelRequirements(loot_drop->Entries[i])) {
-			roll_t += loot_drop->Entries[i].chance;
-			if (loot_drop->Entries[i].chance >= 100) {
+	// shared memory compiled the cumulative chances, a drop with npc level requirements is narrowed
+	// once to the entries this npc can roll rather than rescanning every entry for every pick
+	const LootDropEntries_Struct *entries     = loot_drop->Entries;
+	uint32                       entry_count = loot_drop->NumEntries;
+
+	float roll_t                   = loot_drop->total_chance;
+	float no_loot_prob             = loot_drop->no_loot_chance;
+	bool  roll_table_chance_bypass = loot_drop->roll_bypass;
+
+	std::vector<LootDropEntries_Struct> level_entries;
+	if (loot_drop->level_limited) {
+		roll_t                   = 0.0f;
+		no_loot_prob             = 1.0f;
+		roll_table_chance_bypass = false;
+
+		level_entries.reserve(loot_drop->NumEntries);
+
+		for (uint32 i = 0; i < loot_drop->NumEntries; ++i) {
+			if (!npc->MeetsLootDropLevelRequirements(loot_drop->Entries[i])) {
+				continue;
+			}
+
+			const auto &e = loot_drop->Entries[i];
+
+			roll_t += e.chance;
+			if (e.chance >= 100) {
 				roll_table_chance_bypass = true;
 			}
 			else {
-				no_loot_prob *= (100 - loot_drop->Entries[i].chance) / 100.0f;
+				no_loot_prob *= (100 - e.chance) / 100.0f;
 			}
-			active_item_list = true;
+
+			level_entries.push_back(e);
+			level_entries.back().cumulative_chance = roll_t;
 		}
+
+		entries     = level_entries.data();
+		entry_count = static_cast<uint32>(level_entries.size());
 	}
 
-	if (!active_item_list) {
+	if (entry_count == 0) {
 		return;
 	}
 
 	// This will pick one item per iteration until mindrop.
-	// Don't let the compare against chance fool you.
-	// The roll isn't 0-100, its 0-total and it picks the item, we're just
-	// looping to find the lucky item, descremening otherwise. This is ok,
+	// The roll isn't 0-100, its 0-total and picks the first entry whose running total is past it,
 	// items with chance 60 are 6 times more likely than items chance 10.
 	int drops = 0;
 
 	for (int i = 0; i < droplimit; ++i) {
 		if (drops < mindrop || roll_table_chance_bypass || (float) zone->random.Real(0.0, 1.0) >= no_loot_prob) {
-			float       roll = (float) zone->random.Real(0.0, roll_t);
-			for (uint32 j    = 0; j < loot_drop->NumEntries; ++j) {
-				const EQ::ItemData *db_item = GetItem(loot_drop->Entries[j].item_id);
-				if (db_item) {
-					// if it doesn't meet the requirements do nothing
-					if (!npc->MeetsLootDropLevelRequirements(loot_drop->Entries[j])) {
-						continue;
-					}
+			float roll = (float) zone->random.Real(0.0, roll_t);
+
+			auto e = std::upper_bound(
+				entries,
+				entries + entry_count,
+				roll,
+				[](float r, const LootDropEntries_Struct &entry) {
+					return r < entry.cumulative_chance;
+				}
+			);
 
-					if (roll < loot_drop->Entries[j].chance) {
-						npc->AddLootDrop(
-							db_item,
-							item_list,
-							loot_drop->Entries[j]
-						);
-						drops++;
-
-						int charges = (int) loot_drop->Entries[i].multiplier;
-						charges = EQ::ClampLower(charges, 1);
-
-						for (int k = 1; k < charges; ++k) {
-							float c_roll = (float) zone->random.Real(0.0, 100.0);
-							if (c_roll <= loot_drop->Entries[i].chance) {
-								npc->AddLootDrop(
-									db_item,
-									item_list,
-									loot_drop->Entries[i]
-								);
-							}
-						}
+			if (e == entries + entry_count) {
+				continue;
+			}
 
-						j = loot_drop->NumEntries;
-						break;
-					}
-					else {
-						roll -= loot_drop->Entries[j].chance;
-					}
+			const EQ::ItemData *db_item = GetItem(e->item_id);
+			if (!db_item) {
+				continue;
+			}
+
+			npc->AddLootDrop(
+				db_item,
+				item_list,
+				*e
+			);
+			drops++;
+
+			int charges = (int) e->multiplier;
+			charges = EQ::ClampLower(charges, 1);
+
+			for (int k = 1; k < charges; ++k) {
+				float c_roll = (float) zone->random.Real(0.0, 100.0);
+				if (c_roll <= e->chance) {
+					npc->AddLootDrop(
+						db_item,
+						item_list,
+						*e
+					);
 				}
 			}
 		}
@@ -281,6 +301,7 @@ LootDropEntries_Struct NPC::NewLootDropEntry()
 	loot_drop.npc_min_level     = 0;
 	loot_drop.npc_max_level     = 0;
 	loot_drop.multiplier        = 0;
+	loot_drop.cumulative_chance = 0;
 
 	return loot_drop;
 }
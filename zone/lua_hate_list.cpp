@@ -14,7 +14,7 @@ Lua_Mob Lua_HateEntry::GetEnt() {
 
 void Lua_HateEntry::SetEnt(Lua_Mob e) {
 	Lua_Safe_Call_Void();
-	self->entity_on_hatelist = e;
+	self->hate_list->SetEntryEnt(self, e);
 }
 
 int64 Lua_HateEntry::GetDamage() {
@@ -34,7 +34,7 @@ int64 Lua_HateEntry::GetHate() {
 
 void Lua_HateEntry::SetHate(int64 value) {
 	Lua_Safe_Call_Void();
-	self->stored_hate_amount = value;
+	self->hate_list->SetEntryHate(self, value);
 }
 
 bool Lua_HateEntry::GetFrenzy() {
@@ -44,7 +44,7 @@ bool Lua_HateEntry::GetFrenzy() {
 
 void Lua_HateEntry::SetFrenzy(bool value) {
 	Lua_Safe_Call_Void();
-	self->is_entity_frenzy = value;
+	self->hate_list->SetEntryFrenzy(self, value);
 }
 
 luabind::scope lua_register_hate_entry() {
@@ -247,6 +247,16 @@ bool Lua_NPC::IsTaunting() {
 	return self->IsTaunting();
 }
 
+void Lua_NPC::SetSerialAI(bool is_serial) {
+	Lua_Safe_Call_Void();
+	self->SetSerialAI(is_serial);
+}
+
+bool Lua_NPC::IsSerialAI() {
+	Lua_Safe_Call_Bool();
+	return self->IsSerialAI();
+}
+
 void Lua_NPC::PickPocket(Lua_Client thief) {
 	Lua_Safe_Call_Void();
 	self->PickPocket(thief);
@@ -909,6 +919,7 @@ luabind::scope lua_register_npc() {
 	.def("IsOnHatelist", (bool(Lua_NPC::*)(Lua_Mob))&Lua_NPC::IsOnHatelist)
 	.def("IsRaidTarget", (bool(Lua_NPC::*)(void))&Lua_NPC::IsRaidTarget)
 	.def("IsRareSpawn", (bool(Lua_NPC::*)(void))&Lua_NPC::IsRareSpawn)
+	.def("IsSerialAI", (bool(Lua_NPC::*)(void))&Lua_NPC::IsSerialAI)
 	.def("IsTaunting", (bool(Lua_NPC::*)(void))&Lua_NPC::IsTaunting)
 	.def("IsUnderwaterOnly", (bool(Lua_NPC::*)(void))&Lua_NPC::IsUnderwaterOnly)
 	.def("MerchantCloseShop", (void(Lua_NPC::*)(void))&Lua_NPC::MerchantCloseShop)
@@ -955,6 +966,7 @@ luabind::scope lua_register_npc() {
 	.def("SetPrimSkill", (void(Lua_NPC::*)(int))&Lua_NPC::SetPrimSkill)
 	.def("SetSaveWaypoint", (void(Lua_NPC::*)(int))&Lua_NPC::SetSaveWaypoint)
 	.def("SetSecSkill", (void(Lua_NPC::*)(int))&Lua_NPC::SetSecSkill)
+	.def("SetSerialAI", (void(Lua_NPC::*)(bool))&Lua_NPC::SetSerialAI)
 	.def("SetSilver", (void(Lua_NPC::*)(uint32))&Lua_NPC::SetSilver)
 	.def("SetSimpleRoamBox", (void(Lua_NPC::*)(float))&Lua_NPC::SetSimpleRoamBox)
 	.def("SetSimpleRoamBox", (void(Lua_NPC::*)(float, float))&Lua_NPC::SetSimpleRoamBox)
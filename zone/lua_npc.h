@@ -76,6 +76,8 @@ public:
 	uint32 GetMaxDamage(int level);
 	void SetTaunting(bool t);
 	bool IsTaunting();
+	void SetSerialAI(bool is_serial);
+	bool IsSerialAI();
 	void PickPocket(Lua_Client thief);
 	void StartSwarmTimer(uint32 duration);
 	void DoClassAttacks(Lua_Mob target);
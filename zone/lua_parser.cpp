@@ -6,6 +6,7 @@
 
 #include <ctype.h>
 #include <stdio.h>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <algorithm>
@@ -183,6 +184,33 @@ std::map<std::string, std::list<lua_registered_event>> lua_encounter_events_regi
 std::map<std::string, bool> lua_encounters_loaded;
 std::map<std::string, Encounter *> lua_encounters;
 
+// hash slots reserved up front in each event table, self plus the handful of fields most events add
+static const int LUA_EVENT_TABLE_FIELDS = 8;
+
+// wrappers only hold the pointer, so the one made for an entity can be handed to each of its events.
+// cache_ref is a weak valued registry table keyed by the raw pointer, leaves the wrapper on the stack
+template <typename Wrapper, typename T>
+static void push_cached_wrapper(lua_State *L, int cache_ref, T *ptr)
+{
+	lua_rawgeti(L, LUA_REGISTRYINDEX, cache_ref);
+	lua_pushlightuserdata(L, ptr);
+	lua_rawget(L, -2);
+
+	if (lua_isnil(L, -1)) {
+		lua_pop(L, 1);
+
+		Wrapper w(ptr);
+		luabind::adl::object o = luabind::adl::object(L, w);
+		o.push(L);
+
+		lua_pushlightuserdata(L, ptr);
+		lua_pushvalue(L, -2);
+		lua_rawset(L, -4);
+	}
+
+	lua_remove(L, -2);
+}
+
 LuaParser::LuaParser() {
 	for (int i = 0; i < _LargestEventID; ++i) {
 		NPCArgumentDispatch[i]       = handle_npc_null;
@@ -344,6 +372,9 @@ LuaParser::LuaParser() {
 #endif
 
 	L = nullptr;
+	npc_wrappers_    = LUA_NOREF;
+	client_wrappers_ = LUA_NOREF;
+	bot_wrappers_    = LUA_NOREF;
 }
 
 LuaParser::~LuaParser() {
@@ -395,8 +426,6 @@ int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, std::string
 
 int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
 						 std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
-	const char *sub_name = LuaEvents[evt];
-
 	int start = lua_gettop(L);
 
 	try {
@@ -404,16 +433,12 @@ int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, M
 		if(l_func != nullptr) {
 			l_func->push(L);
 		} else {
-			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-			lua_getfield(L, -1, sub_name);
-			npop = 2;
+			lua_rawgeti(L, LUA_REGISTRYINDEX, GetHandler(package_name, evt));
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_FIELDS);
 		//always push self
-		Lua_NPC l_npc(npc);
-		luabind::adl::object l_npc_o = luabind::adl::object(L, l_npc);
-		l_npc_o.push(L);
+		push_cached_wrapper<Lua_NPC>(L, npc_wrappers_, npc);
 		lua_setfield(L, -2, "self");
 
 		auto arg_function = NPCArgumentDispatch[evt];
@@ -421,7 +446,7 @@ int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, M
 		Client *c = (init && init->IsClient()) ? init->CastToClient() : nullptr;
 
 		quest_manager.StartQuest(npc, c);
-		if(lua_pcall(L, 1, 1, 0)) {
+		if(CallHandler(evt)) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -491,7 +516,6 @@ int LuaParser::EventGlobalPlayer(QuestEventID evt, Client *client, std::string d
 
 int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *client, std::string data, uint32 extra_data,
 							std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
-	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
 
 	try {
@@ -499,23 +523,19 @@ int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *
 		if(l_func != nullptr) {
 			l_func->push(L);
 		} else {
-			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-			lua_getfield(L, -1, sub_name);
-			npop = 2;
+			lua_rawgeti(L, LUA_REGISTRYINDEX, GetHandler(package_name, evt));
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_FIELDS);
 		//push self
-		Lua_Client l_client(client);
-		luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-		l_client_o.push(L);
+		push_cached_wrapper<Lua_Client>(L, client_wrappers_, client);
 		lua_setfield(L, -2, "self");
 
 		auto arg_function = PlayerArgumentDispatch[evt];
 		arg_function(this, L, client, data, extra_data, extra_pointers);
 
 		quest_manager.StartQuest(client, client);
-		if(lua_pcall(L, 1, 1, 0)) {
+		if(CallHandler(evt)) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -569,8 +589,6 @@ int LuaParser::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *ite
 
 int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob,
 						  std::string data, uint32 extra_data, std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
-	const char *sub_name = LuaEvents[evt];
-
 	int start = lua_gettop(L);
 
 	try {
@@ -578,21 +596,17 @@ int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *cl
 		if(l_func != nullptr) {
 			l_func->push(L);
 		} else {
-			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-			lua_getfield(L, -1, sub_name);
-			npop = 2;
+			lua_rawgeti(L, LUA_REGISTRYINDEX, GetHandler(package_name, evt));
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_FIELDS);
 		//always push self
 		Lua_ItemInst l_item(item);
 		luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
 		l_item_o.push(L);
 		lua_setfield(L, -2, "self");
 
-		Lua_Client l_client(client);
-		luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-		l_client_o.push(L);
+		push_cached_wrapper<Lua_Client>(L, client_wrappers_, client);
 		lua_setfield(L, -2, "owner");
 
 		//redo this arg function
@@ -600,7 +614,7 @@ int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *cl
 		arg_function(this, L, client, item, mob, data, extra_data, extra_pointers);
 
 		quest_manager.StartQuest(client, client, item);
-		if(lua_pcall(L, 1, 1, 0)) {
+		if(CallHandler(evt)) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -650,8 +664,6 @@ int LuaParser::EventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spe
 
 int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
 						   std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
-	const char *sub_name = LuaEvents[evt];
-
 	int start = lua_gettop(L);
 
 	try {
@@ -659,12 +671,10 @@ int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob,
 		if(l_func != nullptr) {
 			l_func->push(L);
 		} else {
-			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-			lua_getfield(L, -1, sub_name);
-			npop = 2;
+			lua_rawgeti(L, LUA_REGISTRYINDEX, GetHandler(package_name, evt));
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_FIELDS);
 
 		//always push self even if invalid
 		if(IsValidSpell(spell_id)) {
@@ -682,7 +692,7 @@ int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob,
 		arg_function(this, L, mob, client, spell_id, data, extra_data, extra_pointers);
 
 		quest_manager.StartQuest(mob, client, nullptr, const_cast<SPDat_Spell_Struct*>(&spells[spell_id]));
-		if(lua_pcall(L, 1, 1, 0)) {
+		if(CallHandler(evt)) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -731,15 +741,12 @@ int LuaParser::EventEncounter(QuestEventID evt, std::string encounter_name, std:
 
 int LuaParser::_EventEncounter(std::string package_name, QuestEventID evt, std::string encounter_name, std::string data, uint32 extra_data,
 							   std::vector<std::any> *extra_pointers) {
-	const char *sub_name = LuaEvents[evt];
-
 	int start = lua_gettop(L);
 
 	try {
-		lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-		lua_getfield(L, -1, sub_name);
+		lua_rawgeti(L, LUA_REGISTRYINDEX, GetHandler(package_name, evt));
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_FIELDS);
 		lua_pushstring(L, encounter_name.c_str());
 		lua_setfield(L, -2, "name");
 
@@ -749,22 +756,22 @@ int LuaParser::_EventEncounter(std::string package_name, QuestEventID evt, std::
 		arg_function(this, L, enc, data, extra_data, extra_pointers);
 
 		quest_manager.StartQuest(enc, nullptr, nullptr, nullptr, encounter_name);
-		if(lua_pcall(L, 1, 1, 0)) {
+		if(CallHandler(evt)) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
-			lua_pop(L, 2);
+			lua_pop(L, 1);
 			return 0;
 		}
 		quest_manager.EndQuest();
 
 		if(lua_isnumber(L, -1)) {
 			int ret = static_cast<int>(lua_tointeger(L, -1));
-			lua_pop(L, 2);
+			lua_pop(L, 1);
 			return ret;
 		}
 
-		lua_pop(L, 2);
+		lua_pop(L, 1);
 	} catch(std::exception &ex) {
 		std::string error = "Lua Exception: ";
 		error += std::string(ex.what());
@@ -789,8 +796,7 @@ bool LuaParser::HasQuestSub(uint32 npc_id, QuestEventID evt) {
 
 	std::string package_name = "npc_" + std::to_string(npc_id);
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return GetHandler(package_name, evt) != LUA_NOREF;
 }
 
 bool LuaParser::HasGlobalQuestSub(QuestEventID evt) {
@@ -799,8 +805,7 @@ bool LuaParser::HasGlobalQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "global_npc");
+	return GetHandler("global_npc", evt) != LUA_NOREF;
 }
 
 bool LuaParser::PlayerHasQuestSub(QuestEventID evt) {
@@ -809,8 +814,7 @@ bool LuaParser::PlayerHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "player");
+	return GetHandler("player", evt) != LUA_NOREF;
 }
 
 bool LuaParser::GlobalPlayerHasQuestSub(QuestEventID evt) {
@@ -819,8 +823,7 @@ bool LuaParser::GlobalPlayerHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "global_player");
+	return GetHandler("global_player", evt) != LUA_NOREF;
 }
 
 bool LuaParser::SpellHasQuestSub(uint32 spell_id, QuestEventID evt) {
@@ -831,8 +834,7 @@ bool LuaParser::SpellHasQuestSub(uint32 spell_id, QuestEventID evt) {
 
 	std::string package_name = "spell_" + std::to_string(spell_id);
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return GetHandler(package_name, evt) != LUA_NOREF;
 }
 
 bool LuaParser::ItemHasQuestSub(EQ::ItemInstance *itm, QuestEventID evt) {
@@ -847,8 +849,7 @@ bool LuaParser::ItemHasQuestSub(EQ::ItemInstance *itm, QuestEventID evt) {
 	std::string package_name = "item_";
 	package_name += std::to_string(itm->GetID());
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return GetHandler(package_name, evt) != LUA_NOREF;
 }
 
 bool LuaParser::EncounterHasQuestSub(std::string encounter_name, QuestEventID evt) {
@@ -859,8 +860,7 @@ bool LuaParser::EncounterHasQuestSub(std::string encounter_name, QuestEventID ev
 
 	std::string package_name = "encounter_" + encounter_name;
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return GetHandler(package_name, evt) != LUA_NOREF;
 }
 
 void LuaParser::LoadNPCScript(std::string filename, int npc_id) {
@@ -921,6 +921,7 @@ void LuaParser::Init() {
 
 void LuaParser::ReloadQuests() {
 	loaded_.clear();
+	handlers_.clear();
 	errors_.clear();
 	mods_.clear();
 	lua_encounter_events_registered.clear();
@@ -942,6 +943,10 @@ void LuaParser::ReloadQuests() {
 	L = luaL_newstate();
 	luaL_openlibs(L);
 
+	npc_wrappers_    = NewWrapperCache();
+	client_wrappers_ = NewWrapperCache();
+	bot_wrappers_    = NewWrapperCache();
+
 	auto top = lua_gettop(L);
 
 	if(luaopen_bit(L) != 1) {
@@ -1147,6 +1152,7 @@ void LuaParser::LoadScript(std::string filename, std::string package_name) {
 	}
 	else {
 		loaded_[package_name] = true;
+		ResolveHandlers(package_name);
 	}
 
 	auto end = lua_gettop(L);
@@ -1156,6 +1162,74 @@ void LuaParser::LoadScript(std::string filename, std::string package_name) {
 	}
 }
 
+/*
+ * Event subs are looked up once when the script loads and kept as registry references, so
+ * checking for and calling a sub never goes through the package table by name again
+ */
+void LuaParser::ResolveHandlers(const std::string &package_name) {
+	auto &handlers = handlers_[package_name];
+	handlers.fill(LUA_NOREF);
+
+	lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
+	if(!lua_istable(L, -1)) {
+		lua_pop(L, 1);
+		return;
+	}
+
+	for(int i = 0; i < _LargestEventID; ++i) {
+		lua_getfield(L, -1, LuaEvents[i]);
+		if(lua_isfunction(L, -1)) {
+			handlers[i] = luaL_ref(L, LUA_REGISTRYINDEX);
+		} else {
+			lua_pop(L, 1);
+		}
+	}
+
+	lua_pop(L, 1);
+}
+
+int LuaParser::GetHandler(const std::string &package_name, QuestEventID evt) const {
+	auto iter = handlers_.find(package_name);
+	if(iter == handlers_.end()) {
+		return LUA_NOREF;
+	}
+
+	return iter->second[evt];
+}
+
+int LuaParser::NewWrapperCache() {
+	lua_createtable(L, 0, 0);
+	lua_createtable(L, 0, 1);
+	lua_pushstring(L, "v");
+	lua_setfield(L, -2, "__mode");
+	lua_setmetatable(L, -2);
+
+	return luaL_ref(L, LUA_REGISTRYINDEX);
+}
+
+// calls the sub and event table on the top of the stack, same result as lua_pcall(L, 1, 1, 0)
+int LuaParser::CallHandler(QuestEventID evt) {
+	auto start = std::chrono::steady_clock::now();
+	int  ret   = lua_pcall(L, 1, 1, 0);
+	auto ns    = static_cast<uint64>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()
+	);
+
+	auto &stats = dispatch_stats_[evt];
+	stats.count++;
+	stats.total_ns += ns;
+	stats.max_ns = std::max(stats.max_ns, ns);
+	if(ret) {
+		stats.errors++;
+	}
+
+	return ret;
+}
+
+void LuaParser::ResetDispatchStats() {
+	dispatch_stats_.fill(DispatchStats());
+}
+
 bool LuaParser::HasFunction(std::string subname, std::string package_name) {
 	//std::transform(subname.begin(), subname.end(), subname.begin(), ::tolower);
 
@@ -1588,7 +1662,6 @@ int LuaParser::_EventBot(
 	std::vector<std::any> *extra_pointers,
 	luabind::adl::object *l_func
 ) {
-	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
 
 	try {
@@ -1596,16 +1669,12 @@ int LuaParser::_EventBot(
 		if(l_func != nullptr) {
 			l_func->push(L);
 		} else {
-			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-			lua_getfield(L, -1, sub_name);
-			npop = 2;
+			lua_rawgeti(L, LUA_REGISTRYINDEX, GetHandler(package_name, evt));
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_FIELDS);
 		//push self
-		Lua_Bot l_bot(bot);
-		luabind::adl::object l_bot_o = luabind::adl::object(L, l_bot);
-		l_bot_o.push(L);
+		push_cached_wrapper<Lua_Bot>(L, bot_wrappers_, bot);
 		lua_setfield(L, -2, "self");
 
 		auto arg_function = BotArgumentDispatch[evt];
@@ -1613,7 +1682,7 @@ int LuaParser::_EventBot(
 		auto* c = (init && init->IsClient()) ? init->CastToClient() : nullptr;
 
 		quest_manager.StartQuest(bot, c);
-		if(lua_pcall(L, 1, 1, 0)) {
+		if(CallHandler(evt)) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -1688,8 +1757,7 @@ bool LuaParser::BotHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "bot");
+	return GetHandler("bot", evt) != LUA_NOREF;
 }
 
 bool LuaParser::GlobalBotHasQuestSub(QuestEventID evt) {
@@ -1698,8 +1766,7 @@ bool LuaParser::GlobalBotHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "global_bot");
+	return GetHandler("global_bot", evt) != LUA_NOREF;
 }
 
 void LuaParser::LoadBotScript(std::string filename) {
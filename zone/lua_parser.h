@@ -4,9 +4,11 @@
 
 #include "quest_parser_collection.h"
 #include "quest_interface.h"
+#include <array>
 #include <string>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <exception>
 
 #include "zone_config.h"
@@ -185,6 +187,17 @@ public:
 
 	bool HasFunction(std::string function, std::string package_name);
 
+	// per event type, counted for every lua sub called whether it came from a script or an encounter
+	struct DispatchStats {
+		uint64 count    = 0;
+		uint64 errors   = 0;
+		uint64 total_ns = 0;
+		uint64 max_ns   = 0;
+	};
+
+	inline const DispatchStats &GetDispatchStats(QuestEventID evt) const { return dispatch_stats_[evt]; }
+	void ResetDispatchStats();
+
 	//Mod Extensions
 	void MeleeMitigation(Mob *self, Mob *attacker, DamageHitInfo &hit, ExtraAttackOptions *opts, bool &ignoreDefault);
 	void ApplyDamageTable(Mob *self, DamageHitInfo &hit, bool &ignoreDefault);
@@ -266,8 +279,19 @@ private:
 	void MapFunctions(lua_State *L);
 	QuestEventID ConvertLuaEvent(QuestEventID evt);
 
+	void ResolveHandlers(const std::string &package_name);
+	int GetHandler(const std::string &package_name, QuestEventID evt) const;
+	int NewWrapperCache();
+	int CallHandler(QuestEventID evt);
+
 	std::map<std::string, std::string> vars_;
 	std::map<std::string, bool> loaded_;
+	// registry references to each package's event subs, LUA_NOREF where a package has none
+	std::unordered_map<std::string, std::array<int, _LargestEventID>> handlers_;
+	std::array<DispatchStats, _LargestEventID> dispatch_stats_;
+	int npc_wrappers_;
+	int client_wrappers_;
+	int bot_wrappers_;
 	std::vector<LuaMod> mods_;
 	lua_State *L;
 
@@ -81,10 +81,13 @@ volatile bool RunLoops = true;
 extern volatile bool is_zone_loaded;
 
 #include "zone_event_scheduler.h"
+#include "zone_profiler.h"
+#include "bazaar_index.h"
 #include "../common/file.h"
 #include "../common/events/player_event_logs.h"
 #include "../common/path_manager.h"
 #include "../common/database/database_update.h"
+#include "../common/data_verification.h"
 
 EntityList  entity_list;
 WorldServer worldserver;
@@ -105,6 +108,8 @@ WorldContentService   content_service;
 PathManager           path;
 PlayerEventLogs       player_event_logs;
 DatabaseUpdate        database_update;
+ZoneProfiler          zone_profiler;
+BazaarIndex           bazaar_index;
 
 const SPDat_Spell_Struct* spells;
 int32 SPDAT_RECORDS = -1;
@@ -145,6 +150,26 @@ int main(int argc, char** argv) {
 	}
 #endif /*USE_MAP_MMFS*/
 
+	if (argc >= 3 && strcasecmp(argv[1], "build_height_field") == 0) {
+		std::string map_name = argv[2];
+		std::transform(map_name.begin(), map_name.end(), map_name.begin(), ::tolower);
+
+		float cell_size = argc >= 4 ? Strings::ToFloat(argv[3]) : 4.0f;
+		float tolerance = argc >= 5 ? Strings::ToFloat(argv[4]) : 1.0f;
+
+		auto m = new Map();
+		auto success = (
+			m->Load(fmt::format("{}/base/{}.map", path.GetMapsPath(), map_name)) &&
+			m->BuildHeightField(Map::GetHeightFieldFileName(map_name), cell_size, tolerance)
+		);
+		delete m;
+
+		std::cout << map_name << " height field (cell size " << cell_size << ", tolerance " << tolerance << ") "
+			<< (success ? "succeeded" : "failed") << std::endl;
+
+		return success ? 0 : 1;
+	}
+
 	QServ = new QueryServ;
 
 	LogInfo("Loading server configuration");
@@ -262,6 +287,13 @@ int main(int argc, char** argv) {
 		content_db.SetMutex(mutex);
 	}
 
+	database.SetPreparedStatementsEnabled(Config->DatabasePreparedStatements);
+	content_db.SetPreparedStatementsEnabled(Config->DatabasePreparedStatements);
+
+	if (Config->DatabaseAsyncConnections > 0) {
+		database.StartAsyncPool(Config->DatabaseAsyncConnections);
+	}
+
 	//rules:
 	{
 		std::string tmp;
@@ -287,8 +319,14 @@ int main(int argc, char** argv) {
 		->SetGMSayHandler(&Zone::GMSayHookCallBackProcess)
 		->StartFileLogs();
 
+	if (Config->LogAsyncWriter) {
+		LogSys.StartAsyncWriter(Config->LogAsyncQueueSize, Config->LogAsyncBlockWhenFull);
+	}
+
 	player_event_logs.SetDatabase(&database)->Init();
 
+	zone_profiler.Init();
+
 	const auto c = EQEmuConfig::get();
 	if (c->auto_database_updates) {
 		if (database_update.SetDatabase(&database)->HasPendingUpdates()) {
@@ -525,6 +563,9 @@ int main(int argc, char** argv) {
 			opts.daybreak_options.resend_delay_min = RuleI(Network, ResendDelayMinMS);
 			opts.daybreak_options.resend_delay_max = RuleI(Network, ResendDelayMaxMS);
 			opts.daybreak_options.outgoing_data_rate = RuleR(Network, ClientDataRate);
+			opts.daybreak_options.batched_io = RuleB(Network, BatchedUDP);
+			opts.daybreak_options.batch_size = static_cast<size_t>(EQ::Clamp(RuleI(Network, BatchedUDPSize), 1, 1024));
+			opts.daybreak_options.compress_min_size = RuleI(Network, CompressMinSize);
 			eqsm = std::make_unique<EQ::Net::EQStreamManager>(opts);
 			eqsf_open = true;
 
@@ -540,8 +581,14 @@ int main(int argc, char** argv) {
 			);
 		}
 
+		zone_profiler.BeginTick(RuleB(Zone, EnableTickProfiler), RuleI(Zone, TickProfilerOverrunMS));
+		const bool profile_tick = zone_profiler.Enter(ZoneProfiler::Tick);
+
 		//give the stream identifier a chance to do its work....
-		stream_identifier.Process();
+		{
+			ZoneProfileScope profile(ZoneProfiler::StreamIdentify);
+			stream_identifier.Process();
+		}
 
 		//check the stream identifier for any now-identified streams
 		while ((eqsi = stream_identifier.PopIdentified())) {
@@ -565,28 +612,67 @@ int main(int argc, char** argv) {
 
 		if (is_zone_loaded) {
 			{
-				entity_list.GroupProcess();
-				entity_list.DoorProcess();
-				entity_list.ObjectProcess();
-				entity_list.CorpseProcess();
-				entity_list.TrapProcess();
-				entity_list.RaidProcess();
-				entity_list.Process();
-				entity_list.MobProcess();
-				entity_list.BeaconProcess();
-				entity_list.EncounterProcess();
-				event_scheduler.Process(zone, &content_service);
+				{
+					ZoneProfileScope profile(ZoneProfiler::GroupProcess);
+					entity_list.GroupProcess();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::DoorProcess);
+					entity_list.DoorProcess();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::ObjectProcess);
+					entity_list.ObjectProcess();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::CorpseProcess);
+					entity_list.CorpseProcess();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::TrapProcess);
+					entity_list.TrapProcess();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::RaidProcess);
+					entity_list.RaidProcess();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::ClientPackets);
+					entity_list.Process();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::MobProcess);
+					entity_list.MobProcess();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::BeaconProcess);
+					entity_list.BeaconProcess();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::EncounterProcess);
+					entity_list.EncounterProcess();
+				}
+				{
+					ZoneProfileScope profile(ZoneProfiler::EventScheduler);
+					event_scheduler.Process(zone, &content_service);
+				}
 
 				if (zone) {
+					ZoneProfileScope profile(ZoneProfiler::ZoneProcess);
 					if (!zone->Process()) {
 						Zone::Shutdown();
 					}
 				}
 
 				if (quest_timers.Check()) {
+					ZoneProfileScope profile(ZoneProfiler::QuestTimers);
 					quest_manager.Process();
 				}
 
+				{
+					ZoneProfileScope profile(ZoneProfiler::CharacterSaves);
+					database.ProcessCharacterSaveBatch();
+				}
 			}
 		}
 
@@ -596,6 +682,12 @@ int main(int argc, char** argv) {
 			content_db.ping();
 			entity_list.UpdateWho();
 		}
+
+		if (profile_tick) {
+			zone_profiler.Leave();
+		}
+
+		zone_profiler.EndTick();
 	};
 
 	EQ::Timer process_timer(loop_fn);
@@ -603,9 +695,13 @@ int main(int argc, char** argv) {
 
 	EQ::EventLoop::Get().Run();
 
+	database.StopAsyncPool();
+
 	entity_list.Clear();
 	entity_list.RemoveAllEncounters(); // gotta do it manually or rewrite lots of shit :P
 
+	database.FlushCharacterSaveBatch();
+
 	parse->ClearInterfaces();
 
 #ifdef EMBPERL
@@ -623,6 +719,9 @@ int main(int argc, char** argv) {
 	bot_command_deinit();
 	safe_delete(parse);
 	LogInfo("Proper zone shutdown complete.");
+
+	// drain and join the log writer thread while the globals it writes through are still alive
+	LogSys.StopAsyncWriter();
 	LogSys.CloseFileLogs();
 
 	safe_delete(mutex);
@@ -3,11 +3,14 @@
 #include "../common/compression.h"
 
 #include "map.h"
+#include "map_height_field.h"
+#include "map_los_cache.h"
 #include "raycast_mesh.h"
 #include "zone.h"
 #include "../common/file.h"
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <tuple>
@@ -15,7 +18,11 @@
 
 struct Map::impl
 {
-	RaycastMesh *rm;
+	RaycastMesh         *rm;
+	MapHeightField      height_field;
+	MapLoSCache         los_cache;
+	std::atomic<uint64> height_field_hits{0};
+	std::atomic<uint64> height_field_fallbacks{0};
 };
 
 Map::Map() {
@@ -38,6 +45,20 @@ float Map::FindBestZ(glm::vec3 &start, glm::vec3 *result) const {
 		result = &tmp;
 
 	start.z += RuleI(Map, FindBestZHeightAdjust);
+
+	if (imp->height_field.IsLoaded()) {
+		float best_z;
+		if (imp->height_field.FindBestZ(start.x, start.y, start.z, best_z)) {
+			imp->height_field_hits.fetch_add(1, std::memory_order_relaxed);
+			result->x = start.x;
+			result->y = start.y;
+			result->z = best_z;
+			return best_z;
+		}
+
+		imp->height_field_fallbacks.fetch_add(1, std::memory_order_relaxed);
+	}
+
 	glm::vec3 from(start.x, start.y, start.z);
 	glm::vec3 to(start.x, start.y, BEST_Z_INVALID);
 	float hit_distance;
@@ -190,7 +211,20 @@ bool Map::CheckLoS(glm::vec3 myloc, glm::vec3 oloc) const {
 	if(!imp)
 		return false;
 
-	return !imp->rm->raycast((const RmReal*)&myloc, (const RmReal*)&oloc, nullptr, nullptr, nullptr);
+	if (!imp->los_cache.IsEnabled()) {
+		return !imp->rm->raycast((const RmReal*)&myloc, (const RmReal*)&oloc, nullptr, nullptr, nullptr);
+	}
+
+	bool los;
+	auto key = imp->los_cache.MakeKey(myloc, oloc);
+	if (imp->los_cache.Find(key, los)) {
+		return los;
+	}
+
+	los = !imp->rm->raycast((const RmReal*)&myloc, (const RmReal*)&oloc, nullptr, nullptr, nullptr);
+	imp->los_cache.Store(key, los);
+
+	return los;
 }
 
 // returns true if a collision happens
@@ -209,6 +243,11 @@ Map *Map::LoadMapFile(std::string file) {
 
 	auto m = new Map();
 	if (m->Load(filename)) {
+		if (RuleB(Map, UseHeightField)) {
+			m->LoadHeightField(GetHeightFieldFileName(file));
+		}
+
+		m->SetLoSCache(RuleI(Map, LoSCacheSize), RuleR(Map, LoSCacheCellSize));
 		return m;
 	}
 
@@ -216,6 +255,80 @@ Map *Map::LoadMapFile(std::string file) {
 	return nullptr;
 }
 
+std::string Map::GetHeightFieldFileName(std::string file) {
+	std::transform(file.begin(), file.end(), file.begin(), ::tolower);
+	return fmt::format("{}/base/{}.hfield", path.GetMapsPath(), file);
+}
+
+bool Map::LoadHeightField(const std::string &filename) {
+	if (!imp) {
+		return false;
+	}
+
+	if (!imp->height_field.Load(filename, imp->rm->getBoundMin(), imp->rm->getBoundMax())) {
+		return false;
+	}
+
+	LogInfo(
+		"Loaded height field [{}] cells [{}x{}] cell size [{}] resolved [{}]",
+		filename,
+		imp->height_field.GetColumns(),
+		imp->height_field.GetRows(),
+		imp->height_field.GetCellSize(),
+		imp->height_field.GetResolvedCells()
+	);
+
+	return true;
+}
+
+bool Map::BuildHeightField(const std::string &filename, float cell_size, float tolerance) const {
+	if (!imp) {
+		return false;
+	}
+
+	uint32 resolved_cells = 0;
+	uint32 total_cells    = 0;
+	if (!MapHeightField::Build(imp->rm, filename, cell_size, tolerance, resolved_cells, total_cells)) {
+		return false;
+	}
+
+	LogInfo(
+		"Built height field [{}] cells [{}] resolved [{}] ({:.1f}%)",
+		filename,
+		total_cells,
+		resolved_cells,
+		total_cells ? 100.0 * resolved_cells / total_cells : 0.0
+	);
+
+	return true;
+}
+
+void Map::SetLoSCache(uint32 capacity, float cell_size) {
+	if (imp) {
+		imp->los_cache.Configure(capacity, cell_size);
+	}
+}
+
+Map::CacheStats Map::GetCacheStats() const {
+	CacheStats stats{};
+	if (!imp) {
+		return stats;
+	}
+
+	stats.height_field_loaded    = imp->height_field.IsLoaded();
+	stats.height_field_cells     = imp->height_field.GetColumns() * imp->height_field.GetRows();
+	stats.height_field_resolved  = imp->height_field.GetResolvedCells();
+	stats.height_field_hits      = imp->height_field_hits.load(std::memory_order_relaxed);
+	stats.height_field_fallbacks = imp->height_field_fallbacks.load(std::memory_order_relaxed);
+	stats.los_hits               = imp->los_cache.GetHits();
+	stats.los_misses             = imp->los_cache.GetMisses();
+	stats.los_evictions          = imp->los_cache.GetEvictions();
+	stats.los_entries            = imp->los_cache.GetSize();
+	stats.los_capacity           = imp->los_cache.GetCapacity();
+
+	return stats;
+}
+
 #ifdef USE_MAP_MMFS
 bool Map::Load(std::string filename, bool force_mmf_overwrite)
 {
@@ -24,6 +24,7 @@
 
 #include "position.h"
 #include <stdio.h>
+#include <string>
 
 #include "zone_config.h"
 
@@ -44,6 +45,24 @@ public:
 	bool CheckLoS(glm::vec3 myloc, glm::vec3 oloc) const;
 	bool DoCollisionCheck(glm::vec3 myloc, glm::vec3 oloc, glm::vec3 &outnorm, float &distance) const;
 
+	struct CacheStats {
+		bool   height_field_loaded;
+		uint32 height_field_cells;
+		uint32 height_field_resolved;
+		uint64 height_field_hits;
+		uint64 height_field_fallbacks;
+		uint64 los_hits;
+		uint64 los_misses;
+		uint64 los_evictions;
+		size_t los_entries;
+		uint32 los_capacity;
+	};
+
+	bool LoadHeightField(const std::string &filename);
+	bool BuildHeightField(const std::string &filename, float cell_size, float tolerance) const;
+	void SetLoSCache(uint32 capacity, float cell_size);
+	CacheStats GetCacheStats() const;
+
 #ifdef USE_MAP_MMFS
 	bool Load(std::string filename, bool force_mmf_overwrite = false);
 #else
@@ -51,6 +70,7 @@ public:
 #endif
 
 	static Map *LoadMapFile(std::string file);
+	static std::string GetHeightFieldFileName(std::string file);
 private:
 	void RotateVertex(glm::vec3 &v, float rx, float ry, float rz);
 	void ScaleVertex(glm::vec3 &v, float sx, float sy, float sz);
@@ -0,0 +1,356 @@
+/*
+	EQEMu:  Everquest Server Emulator
+
+	Copyright (C) 2001-2014 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*/
+
+#include "map_height_field.h"
+#include "map.h"
+#include "raycast_mesh.h"
+#include "../common/eqemu_exception.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/file.h"
+#include "../common/memory_mapped_file.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+#include <vector>
+
+// layer value for an empty slot, and the marker for a cell the grid cannot answer for
+static constexpr float HF_NO_SURFACE = BEST_Z_INVALID;
+static constexpr float HF_UNRESOLVED = -BEST_Z_INVALID;
+
+// gap below a hit before casting again for the next surface down
+static constexpr float HF_LAYER_EPSILON = 0.05f;
+
+// how far a sample may sit off its layer's plane, anything more and the cell is left to the raycaster
+static constexpr float HF_PLANE_EPSILON = 0.01f;
+
+// each layer is stored as its Z at the cell center and its slope along x and y
+static constexpr uint32 HF_LAYER_FLOATS = 3;
+
+// keep generated files well inside what MemoryMappedFile can address
+static constexpr uint64 HF_MAX_FILE_SIZE = 1024ull * 1024ull * 1024ull;
+
+namespace {
+	struct Sample {
+		uint32 count;
+		float  z[MapHeightField::MAX_LAYERS + 1];
+	};
+
+	// every surface straight down from the top of the mesh, count past MAX_LAYERS means too many to store
+	void SampleColumn(RaycastMesh *rm, float x, float y, float top, float bottom, Sample &s)
+	{
+		s.count = 0;
+
+		float from[3] = {x, y, top};
+		float to[3]   = {x, y, bottom};
+		float hit[3];
+
+		while (s.count <= MapHeightField::MAX_LAYERS) {
+			if (!rm->raycast(from, to, hit, nullptr, nullptr)) {
+				break;
+			}
+
+			s.z[s.count++] = hit[2];
+			from[2] = hit[2] - HF_LAYER_EPSILON;
+
+			if (from[2] <= bottom) {
+				break;
+			}
+		}
+	}
+
+	void SampleRow(RaycastMesh *rm, float min_x, float y, float step, float top, float bottom, std::vector<Sample> &row)
+	{
+		for (size_t i = 0; i < row.size(); ++i) {
+			SampleColumn(rm, min_x + step * i, y, top, bottom, row[i]);
+		}
+	}
+}
+
+MapHeightField::MapHeightField() = default;
+
+MapHeightField::~MapHeightField() = default;
+
+bool MapHeightField::Build(
+	RaycastMesh *rm,
+	const std::string &filename,
+	float cell_size,
+	float tolerance,
+	uint32 &resolved_cells,
+	uint32 &total_cells
+)
+{
+	resolved_cells = 0;
+	total_cells    = 0;
+
+	if (!rm || cell_size <= 0.0f || tolerance < 0.0f) {
+		return false;
+	}
+
+	const float *bmin = rm->getBoundMin();
+	const float *bmax = rm->getBoundMax();
+
+	const auto columns = static_cast<uint32>(std::ceil((bmax[0] - bmin[0]) / cell_size));
+	const auto rows    = static_cast<uint32>(std::ceil((bmax[1] - bmin[1]) / cell_size));
+	if (columns == 0 || rows == 0) {
+		return false;
+	}
+
+	const uint64 cells_size = static_cast<uint64>(columns) * rows * MAX_LAYERS * HF_LAYER_FLOATS * sizeof(float);
+	if (sizeof(Header) + cells_size > HF_MAX_FILE_SIZE) {
+		LogError(
+			"Height field for [{}] would be [{}] bytes at cell size [{}], use a larger cell size",
+			filename,
+			sizeof(Header) + cells_size,
+			cell_size
+		);
+		return false;
+	}
+
+	std::unique_ptr<EQ::MemoryMappedFile> file;
+	try {
+		file = std::make_unique<EQ::MemoryMappedFile>(filename, static_cast<uint32>(sizeof(Header) + cells_size));
+	}
+	catch (std::exception &ex) {
+		LogError("Failed to create height field [{}] [{}]", filename, ex.what());
+		return false;
+	}
+
+	file->ZeroFile();
+
+	auto header = reinterpret_cast<Header *>(file->Get());
+	auto cells  = reinterpret_cast<float *>(reinterpret_cast<char *>(file->Get()) + sizeof(Header));
+
+	const float top    = bmax[2] + 10.0f;
+	const float bottom = bmin[2] - 10.0f;
+	const float half   = cell_size / 2.0f;
+
+	// sample points sit on cell corners, edge midpoints and centers so neighbouring cells share them
+	std::vector<Sample> row_a(columns * 2 + 1);
+	std::vector<Sample> row_b(columns * 2 + 1);
+	std::vector<Sample> row_c(columns * 2 + 1);
+
+	SampleRow(rm, bmin[0], bmin[1], half, top, bottom, row_a);
+
+	for (uint32 r = 0; r < rows; ++r) {
+		const float y = bmin[1] + cell_size * r;
+		SampleRow(rm, bmin[0], y + half, half, top, bottom, row_b);
+		SampleRow(rm, bmin[0], y + cell_size, half, top, bottom, row_c);
+
+		for (uint32 c = 0; c < columns; ++c) {
+			float *cell = &cells[(static_cast<size_t>(r) * columns + c) * MAX_LAYERS * HF_LAYER_FLOATS];
+			std::fill(cell, cell + MAX_LAYERS * HF_LAYER_FLOATS, 0.0f);
+
+			const Sample *samples[9] = {
+				&row_a[c * 2], &row_a[c * 2 + 1], &row_a[c * 2 + 2],
+				&row_b[c * 2], &row_b[c * 2 + 1], &row_b[c * 2 + 2],
+				&row_c[c * 2], &row_c[c * 2 + 1], &row_c[c * 2 + 2]
+			};
+
+			const uint32 count    = samples[0]->count;
+			bool         resolved = count <= MAX_LAYERS;
+			for (auto s : samples) {
+				if (s->count != count) {
+					resolved = false;
+					break;
+				}
+			}
+
+			// fit a plane through each layer's samples, the cell is only kept when every sample
+			// sits on it so a lookup anywhere in the cell gives what the raycaster would
+			for (uint32 l = 0; resolved && l < count; ++l) {
+				float z[9];
+				float sum = 0.0f;
+				for (int i = 0; i < 9; ++i) {
+					z[i] = samples[i]->z[l];
+					sum += z[i];
+				}
+
+				const float center = sum / 9.0f;
+				const float dx     = ((z[2] + z[5] + z[8]) - (z[0] + z[3] + z[6])) / (3.0f * cell_size);
+				const float dy     = ((z[6] + z[7] + z[8]) - (z[0] + z[1] + z[2])) / (3.0f * cell_size);
+
+				for (int i = 0; i < 9; ++i) {
+					const float plane_z = center + dx * half * (i % 3 - 1) + dy * half * (i / 3 - 1);
+					if (std::fabs(z[i] - plane_z) > HF_PLANE_EPSILON) {
+						resolved = false;
+						break;
+					}
+				}
+
+				cell[l * HF_LAYER_FLOATS]     = center;
+				cell[l * HF_LAYER_FLOATS + 1] = dx;
+				cell[l * HF_LAYER_FLOATS + 2] = dy;
+			}
+
+			for (uint32 l = count; resolved && l < MAX_LAYERS; ++l) {
+				cell[l * HF_LAYER_FLOATS] = HF_NO_SURFACE;
+			}
+
+			if (resolved) {
+				resolved_cells++;
+			}
+			else {
+				std::fill(cell, cell + MAX_LAYERS * HF_LAYER_FLOATS, 0.0f);
+				cell[0] = HF_UNRESOLVED;
+			}
+		}
+
+		std::swap(row_a, row_c);
+	}
+
+	header->magic          = MAGIC;
+	header->version        = VERSION;
+	header->layers         = MAX_LAYERS;
+	header->columns        = columns;
+	header->rows           = rows;
+	header->resolved_cells = resolved_cells;
+	header->cell_size      = cell_size;
+	header->tolerance      = tolerance;
+	memcpy(header->bound_min, bmin, sizeof(header->bound_min));
+	memcpy(header->bound_max, bmax, sizeof(header->bound_max));
+
+	total_cells = columns * rows;
+
+	return true;
+}
+
+bool MapHeightField::Load(const std::string &filename, const float *bound_min, const float *bound_max)
+{
+	m_header = nullptr;
+	m_cells  = nullptr;
+	m_file.reset();
+
+	if (!File::Exists(filename)) {
+		return false;
+	}
+
+	try {
+		m_file = std::make_unique<EQ::MemoryMappedFile>(filename);
+	}
+	catch (std::exception &ex) {
+		LogError("Failed to map height field [{}] [{}]", filename, ex.what());
+		return false;
+	}
+
+	auto header = reinterpret_cast<const Header *>(m_file->Get());
+	if (
+		m_file->Size() < sizeof(Header) ||
+		header->magic != MAGIC ||
+		header->version != VERSION ||
+		header->layers != MAX_LAYERS
+	) {
+		LogError("Height field [{}] is not a valid version [{}] height field, rebuild it", filename, VERSION);
+		m_file.reset();
+		return false;
+	}
+
+	const uint64 expected = sizeof(Header) + static_cast<uint64>(header->columns) * header->rows * MAX_LAYERS * HF_LAYER_FLOATS * sizeof(float);
+	if (m_file->Size() < expected) {
+		LogError("Height field [{}] is truncated, rebuild it", filename);
+		m_file.reset();
+		return false;
+	}
+
+	// a different mesh means the map was updated after the grid was generated
+	for (int i = 0; i < 3; ++i) {
+		if (header->bound_min[i] != bound_min[i] || header->bound_max[i] != bound_max[i]) {
+			LogError("Height field [{}] does not match the loaded map, rebuild it", filename);
+			m_file.reset();
+			return false;
+		}
+	}
+
+	m_header = header;
+	m_cells  = reinterpret_cast<const float *>(reinterpret_cast<const char *>(m_file->Get()) + sizeof(Header));
+
+	return true;
+}
+
+bool MapHeightField::FindBestZ(float x, float y, float z, float &best_z) const
+{
+	if (!m_header) {
+		return false;
+	}
+
+	const float fx = (x - m_header->bound_min[0]) / m_header->cell_size;
+	const float fy = (y - m_header->bound_min[1]) / m_header->cell_size;
+	if (fx < 0.0f || fy < 0.0f) {
+		return false;
+	}
+
+	const auto c = static_cast<uint32>(fx);
+	const auto r = static_cast<uint32>(fy);
+	if (c >= m_header->columns || r >= m_header->rows) {
+		return false;
+	}
+
+	const float *cell = &m_cells[(static_cast<size_t>(r) * m_header->columns + c) * MAX_LAYERS * HF_LAYER_FLOATS];
+	if (cell[0] == HF_UNRESOLVED) {
+		return false;
+	}
+
+	const float ox = (fx - c - 0.5f) * m_header->cell_size;
+	const float oy = (fy - r - 0.5f) * m_header->cell_size;
+
+	// layers run top down, the first one under us is what a downward ray hits and failing that
+	// the lowest one above us is what the upward ray hits
+	float above = HF_NO_SURFACE;
+	for (uint32 l = 0; l < MAX_LAYERS && cell[l * HF_LAYER_FLOATS] != HF_NO_SURFACE; ++l) {
+		const float *layer  = &cell[l * HF_LAYER_FLOATS];
+		const float surface = layer[0] + layer[1] * ox + layer[2] * oy;
+
+		if (std::fabs(z - surface) <= m_header->tolerance) {
+			return false;
+		}
+
+		if (surface < z) {
+			best_z = surface;
+			return true;
+		}
+
+		above = surface;
+	}
+
+	best_z = above;
+
+	return true;
+}
+
+uint32 MapHeightField::GetColumns() const
+{
+	return m_header ? m_header->columns : 0;
+}
+
+uint32 MapHeightField::GetRows() const
+{
+	return m_header ? m_header->rows : 0;
+}
+
+uint32 MapHeightField::GetResolvedCells() const
+{
+	return m_header ? m_header->resolved_cells : 0;
+}
+
+float MapHeightField::GetCellSize() const
+{
+	return m_header ? m_header->cell_size : 0.0f;
+}
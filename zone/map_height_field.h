@@ -0,0 +1,95 @@
+/*
+	EQEMu:  Everquest Server Emulator
+
+	Copyright (C) 2001-2014 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*/
+
+#ifndef ZONE_MAP_HEIGHT_FIELD_H
+#define ZONE_MAP_HEIGHT_FIELD_H
+
+#include <memory>
+#include <string>
+
+#include "../common/types.h"
+
+class RaycastMesh;
+
+namespace EQ {
+	class MemoryMappedFile;
+}
+
+/**
+ * Precomputed best-Z grid for a zone mesh
+ *
+ * Each cell holds up to MAX_LAYERS walkable surfaces (stacked floors, bridges, caves) ordered
+ * top down, each stored as a plane. A cell is only resolved when every point of a 3x3 sample
+ * grid across it sits on its layer's plane, anything else (edges, steps, uneven ground) is
+ * marked unresolved and left to the raycaster. Lookups within the build tolerance of a
+ * surface are also left to the raycaster. The file is generated offline with
+ * `zone build_height_field <zone>` and memory mapped at boot
+ */
+class MapHeightField {
+public:
+	static constexpr uint32 MAX_LAYERS = 4;
+
+	MapHeightField();
+	~MapHeightField();
+
+	static bool Build(
+		RaycastMesh *rm,
+		const std::string &filename,
+		float cell_size,
+		float tolerance,
+		uint32 &resolved_cells,
+		uint32 &total_cells
+	);
+
+	bool Load(const std::string &filename, const float *bound_min, const float *bound_max);
+
+	// true when the grid can answer for this point, false means fall back to a raycast
+	bool FindBestZ(float x, float y, float z, float &best_z) const;
+
+	inline bool IsLoaded() const { return m_header != nullptr; }
+	uint32 GetColumns() const;
+	uint32 GetRows() const;
+	uint32 GetResolvedCells() const;
+	float GetCellSize() const;
+
+private:
+	static constexpr uint32 MAGIC   = 0x44464845; // "EHFD"
+	static constexpr uint32 VERSION = 2;
+
+	struct Header {
+		uint32 magic;
+		uint32 version;
+		uint32 layers;
+		uint32 columns;
+		uint32 rows;
+		uint32 resolved_cells;
+		float  cell_size;
+		float  tolerance;
+		float  bound_min[3];
+		float  bound_max[3];
+	};
+
+	std::unique_ptr<EQ::MemoryMappedFile> m_file;
+	const Header                          *m_header = nullptr;
+	const float                           *m_cells  = nullptr;
+};
+
+#endif
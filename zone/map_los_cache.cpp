@@ -0,0 +1,138 @@
+/*
+	EQEMu:  Everquest Server Emulator
+
+	Copyright (C) 2001-2014 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*/
+
+#include "map_los_cache.h"
+
+#include <cmath>
+
+bool MapLoSCache::Key::operator==(const Key &o) const
+{
+	return from[0] == o.from[0] && from[1] == o.from[1] && from[2] == o.from[2] &&
+		to[0] == o.to[0] && to[1] == o.to[1] && to[2] == o.to[2];
+}
+
+size_t MapLoSCache::KeyHash::operator()(const Key &k) const
+{
+	uint64 h = 1469598103934665603ull;
+	for (int i = 0; i < 3; ++i) {
+		h = (h ^ static_cast<uint32>(k.from[i])) * 1099511628211ull;
+		h = (h ^ static_cast<uint32>(k.to[i])) * 1099511628211ull;
+	}
+
+	return static_cast<size_t>(h);
+}
+
+void MapLoSCache::Configure(uint32 capacity, float cell_size)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_capacity  = capacity;
+	m_cell_size = cell_size > 0.0f ? cell_size : 1.0f;
+	m_lru.clear();
+	m_index.clear();
+	m_index.reserve(capacity);
+}
+
+void MapLoSCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_lru.clear();
+	m_index.clear();
+}
+
+MapLoSCache::Key MapLoSCache::MakeKey(const glm::vec3 &from, const glm::vec3 &to) const
+{
+	Key k;
+	for (int i = 0; i < 3; ++i) {
+		k.from[i] = static_cast<int32>(std::floor(from[i] / m_cell_size));
+		k.to[i]   = static_cast<int32>(std::floor(to[i] / m_cell_size));
+	}
+
+	return k;
+}
+
+bool MapLoSCache::Find(const Key &key, bool &los)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	auto iter = m_index.find(key);
+	if (iter == m_index.end()) {
+		m_misses++;
+		return false;
+	}
+
+	m_lru.splice(m_lru.begin(), m_lru, iter->second);
+	los = iter->second->second;
+	m_hits++;
+
+	return true;
+}
+
+void MapLoSCache::Store(const Key &key, bool los)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_capacity == 0) {
+		return;
+	}
+
+	// another thread may have raced us to the same pair
+	auto iter = m_index.find(key);
+	if (iter != m_index.end()) {
+		iter->second->second = los;
+		m_lru.splice(m_lru.begin(), m_lru, iter->second);
+		return;
+	}
+
+	if (m_index.size() >= m_capacity) {
+		m_index.erase(m_lru.back().first);
+		m_lru.pop_back();
+		m_evictions++;
+	}
+
+	m_lru.emplace_front(key, los);
+	m_index.emplace(key, m_lru.begin());
+}
+
+uint64 MapLoSCache::GetHits()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	return m_hits;
+}
+
+uint64 MapLoSCache::GetMisses()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	return m_misses;
+}
+
+uint64 MapLoSCache::GetEvictions()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	return m_evictions;
+}
+
+size_t MapLoSCache::GetSize()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+	return m_index.size();
+}
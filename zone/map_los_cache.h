@@ -0,0 +1,81 @@
+/*
+	EQEMu:  Everquest Server Emulator
+
+	Copyright (C) 2001-2014 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*/
+
+#ifndef ZONE_MAP_LOS_CACHE_H
+#define ZONE_MAP_LOS_CACHE_H
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "../common/types.h"
+#include "position.h"
+
+/**
+ * LRU of line of sight results between quantized positions
+ *
+ * Zone geometry never changes at runtime so a result stays valid until it is evicted. Both
+ * endpoints are snapped to cell_size cubes, callers that stand still (casters, guards,
+ * engaged npcs) keep hitting the same pair. Guarded by a mutex so it can be shared by
+ * worker threads
+ */
+class MapLoSCache {
+public:
+	struct Key {
+		int32 from[3];
+		int32 to[3];
+
+		bool operator==(const Key &o) const;
+	};
+
+	void Configure(uint32 capacity, float cell_size);
+	void Clear();
+
+	inline bool IsEnabled() const { return m_capacity > 0; }
+
+	Key MakeKey(const glm::vec3 &from, const glm::vec3 &to) const;
+	bool Find(const Key &key, bool &los);
+	void Store(const Key &key, bool los);
+
+	uint64 GetHits();
+	uint64 GetMisses();
+	uint64 GetEvictions();
+	size_t GetSize();
+	inline uint32 GetCapacity() const { return m_capacity; }
+
+private:
+	struct KeyHash {
+		size_t operator()(const Key &k) const;
+	};
+
+	typedef std::list<std::pair<Key, bool>> LRUList;
+
+	std::mutex                                          m_lock;
+	uint32                                              m_capacity  = 0;
+	float                                               m_cell_size = 1.0f;
+	LRUList                                             m_lru;
+	std::unordered_map<Key, LRUList::iterator, KeyHash> m_index;
+	uint64                                              m_hits      = 0;
+	uint64                                              m_misses    = 0;
+	uint64                                              m_evictions = 0;
+};
+
+#endif
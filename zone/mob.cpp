@@ -555,6 +555,7 @@ Mob::~Mob()
 	UninitializeBuffSlots();
 
 	entity_list.RemoveMobFromCloseLists(this);
+	entity_list.RemoveMobFromEntityGrid(this);
 	entity_list.RemoveAuraFromMobs(this);
 
 	close_mobs.clear();
@@ -1574,6 +1575,15 @@ void Mob::StopMoving(float new_heading)
 	}
 }
 
+void Mob::SetPosition(const float x, const float y, const float z)
+{
+	m_Position.x = x;
+	m_Position.y = y;
+	m_Position.z = z;
+
+	entity_list.UpdateEntityGrid(this, x, y);
+}
+
 void Mob::SentPositionPacket(float dx, float dy, float dz, float dh, int anim, bool send_to_self)
 {
 	EQApplicationPacket outapp(OP_ClientUpdate, sizeof(PlayerPositionUpdateServer_Struct));
@@ -659,7 +659,7 @@ public:
 	uint32 GetNPCTypeID() const { return npctype_id; }
 	void SetNPCTypeID(uint32 npctypeid) { npctype_id = npctypeid; }
 	inline const glm::vec4& GetPosition() const { return m_Position; }
-	inline void SetPosition(const float x, const float y, const float z) { m_Position.x = x; m_Position.y = y; m_Position.z = z; }
+	void SetPosition(const float x, const float y, const float z);
 	inline const float GetX() const { return m_Position.x; }
 	inline const float GetY() const { return m_Position.y; }
 	inline const float GetZ() const { return m_Position.z; }
@@ -771,7 +771,7 @@ public:
 	void ClearFeignMemory();
 	bool IsOnFeignMemory(Mob *attacker) const;
 	void PrintHateListToClient(Client *who) { hate_list.PrintHateListToClient(who); }
-	std::list<struct_HateList*>& GetHateList() { return hate_list.GetHateList(); }
+	std::vector<struct_HateList*>& GetHateList() { return hate_list.GetHateList(); }
 	bool CheckLosFN(Mob* other);
 	bool CheckLosFN(float posX, float posY, float posZ, float mobSize);
 	static bool CheckLosFN(glm::vec3 posWatcher, float sizeWatcher, glm::vec3 posTarget, float sizeTarget);
@@ -780,7 +780,7 @@ public:
 	inline bool CheckLastLosState() const { return last_los_check; }
 	std::string GetMobDescription();
 
-	std::list<struct_HateList*> GetFilteredHateList(
+	std::vector<struct_HateList*> GetFilteredHateList(
 		EntityFilterType filter_type = EntityFilterType::All,
 		uint32 distance = 0
 	) {
@@ -1146,6 +1146,7 @@ public:
 	virtual void AI_Stop();
 	virtual void AI_ShutDown();
 	virtual void AI_Process();
+	void AI_Think(uint32 tick);
 
 	bool ClearEntityVariables();
 	bool DeleteEntityVariable(std::string variable_name);
@@ -1243,6 +1244,7 @@ public:
 	void SetLooting(uint16 val) { entity_id_being_looted = val; }
 
 	bool CheckWillAggro(Mob *mob);
+	bool CheckWillAggroPrefilter(Mob *mob);
 
 	void InstillDoubt(Mob *who);
 	bool Charmed() const { return typeofpet == petCharmed; }
@@ -1768,6 +1770,21 @@ protected:
 	std::unique_ptr<Timer> AI_scan_door_open_timer;
 	uint32 time_until_can_move;
 	HateList hate_list;
+
+	// filled by AI_Think off the main thread, only trusted by AI_Process for the tick it was made in
+	struct AIThinkResult {
+		uint32              tick          = 0;
+		uint64              hate_version  = 0;
+		Mob                 *prior_target = nullptr;
+		Mob                 *top_hate     = nullptr;
+		bool                has_top_hate  = false;
+		bool                has_aggro     = false;
+		bool                thinking      = false; // CombatRange holds its SetPseudoRoot back while set
+		int8                pseudo_root   = -1;    // held back SetPseudoRoot, -1 when CombatRange made none
+		std::vector<uint16> aggro_candidates;
+	};
+	AIThinkResult m_ai_think;
+	Mob *AI_GetTopHateTarget();
 	std::set<uint32> feign_memory_list;
 	// This is to keep track of mobs we cast faction mod spells on
 	std::map<uint32,int32> faction_bonuses; // Primary FactionID, Bonus
@@ -1843,6 +1860,25 @@ protected:
 	std::unordered_map<uint32, std::pair<uint32, uint32>> aa_ranks;
 	Timer aa_timers[aaTimerMax];
 
+	// focus sources grouped by focusType so a cast only looks at gear, buffs and AAs that carry that focus.
+	// Built on the first focus check and rebuilt after CalcBonuses recalculates the matching bonuses
+	struct FocusIndex {
+		struct ItemFocus {
+			const EQ::ItemData *item; // named in the focus message, the parent item for augments
+			uint16             focus_id;
+		};
+
+		std::vector<ItemFocus>                 items[HIGHEST_FOCUS + 1];
+		std::vector<int>                       buff_slots[HIGHEST_FOCUS + 1];
+		std::vector<std::pair<uint32, uint32>> aa_ranks[HIGHEST_FOCUS + 1]; // aa id, rank id
+		bool                                   items_dirty = true;
+		bool                                   buffs_dirty = true;
+		bool                                   aas_dirty   = true;
+	};
+
+	std::unique_ptr<FocusIndex> m_focus_index;
+	void BuildFocusIndex();
+
 	bool is_horse;
 
 	AuraMgr aura_mgr;
@@ -961,6 +961,93 @@ void Mob::ProcessForcedMovement()
 	}
 }
 
+/**
+ * Read only part of AI_Process, called from EntityList::AIThinkProcess on the think pool
+ *
+ * Works out what AI_Process would pick for its top hate target and which close npcs pass
+ * the cheap aggro checks, from the state the zone is in before any mob processes this tick.
+ * Must not change anything outside m_ai_think, roll, raycast, log or touch quests
+ */
+void Mob::AI_Think(uint32 tick)
+{
+	m_ai_think.tick         = tick;
+	m_ai_think.has_top_hate = false;
+	m_ai_think.has_aggro    = false;
+	m_ai_think.pseudo_root  = -1;
+	m_ai_think.aggro_candidates.clear();
+
+	if (!IsAIControlled() || IsCasting()) {
+		return;
+	}
+
+	// AI_Process will bail on the same timers, a remaining time of 0 means Check() would fire
+	if (AI_think_timer->GetRemainingTime() != 0 && attack_timer.GetRemainingTime() != 0) {
+		return;
+	}
+
+	if (IsEngaged()) {
+		if ((IsRooted() && !GetSpecialAbility(IGNORE_ROOT_AGGRO_RULES)) || IsBlind()) {
+			return;
+		}
+
+		if (AI_target_check_timer->GetRemainingTime() != 0) {
+			return;
+		}
+
+		m_ai_think.hate_version = hate_list.GetVersion();
+		m_ai_think.prior_target = target;
+		m_ai_think.thinking     = true;
+		m_ai_think.top_hate     = hate_list.GetEntWithMostHateOnList(this);
+		m_ai_think.thinking     = false;
+		m_ai_think.has_top_hate = true;
+		return;
+	}
+
+	if (
+		!IsNPC() ||
+		!zone->CanDoCombat() ||
+		!CastToNPC()->WillAggroNPCs() ||
+		AI_scan_area_timer->GetRemainingTime() != 0
+	) {
+		return;
+	}
+
+	for (auto &close_mob : close_mobs) {
+		Mob *mob = close_mob.second;
+		if (mob->IsClient()) {
+			continue;
+		}
+
+		if (CheckWillAggroPrefilter(mob)) {
+			m_ai_think.aggro_candidates.push_back(close_mob.first);
+		}
+	}
+
+	m_ai_think.has_aggro = true;
+}
+
+// the think phase answer is only good while nothing it looked at has changed since
+Mob *Mob::AI_GetTopHateTarget()
+{
+	if (
+		m_ai_think.has_top_hate &&
+		m_ai_think.tick == entity_list.GetAIThinkTick() &&
+		m_ai_think.hate_version == hate_list.GetVersion() &&
+		m_ai_think.prior_target == target
+	) {
+		m_ai_think.has_top_hate = false;
+
+		if (m_ai_think.pseudo_root != -1) {
+			SetPseudoRoot(m_ai_think.pseudo_root == 1);
+			m_ai_think.pseudo_root = -1;
+		}
+
+		return m_ai_think.top_hate;
+	}
+
+	return hate_list.GetEntWithMostHateOnList(this);
+}
+
 void Mob::AI_Process() {
 	if (!IsAIControlled())
 		return;
@@ -1064,12 +1151,12 @@ void Mob::AI_Process() {
 			if (AI_target_check_timer->Check()) {
 				if (IsFocused()) {
 					if (!target) {
-						SetTarget(hate_list.GetEntWithMostHateOnList(this));
+						SetTarget(AI_GetTopHateTarget());
 					}
 				}
 				else {
 					if (!ImprovedTaunt())
-						SetTarget(hate_list.GetEntWithMostHateOnList(this));
+						SetTarget(AI_GetTopHateTarget());
 				}
 
 			}
@@ -1382,18 +1469,35 @@ void Mob::AI_Process() {
 			/**
 			 * NPC to NPC aggro (npc_aggro flag set)
 			 */
-			for (auto &close_mob : close_mobs) {
-				Mob *mob = close_mob.second;
+			if (m_ai_think.has_aggro && m_ai_think.tick == entity_list.GetAIThinkTick()) {
+				// the think phase already dropped everyone failing the cheap checks
+				for (auto id : m_ai_think.aggro_candidates) {
+					Mob *mob = entity_list.GetMob(id);
+					if (!mob || mob->IsClient()) {
+						continue;
+					}
 
-				if (mob->IsClient()) {
-					continue;
+					if (CheckWillAggro(mob)) {
+						AddToHateList(mob);
+					}
 				}
+			}
+			else {
+				for (auto &close_mob : close_mobs) {
+					Mob *mob = close_mob.second;
+
+					if (mob->IsClient()) {
+						continue;
+					}
 
-				if (CheckWillAggro(mob)) {
-					AddToHateList(mob);
+					if (CheckWillAggro(mob)) {
+						AddToHateList(mob);
+					}
 				}
 			}
 
+			m_ai_think.has_aggro = false;
+
 			AI_scan_area_timer->Disable();
 			AI_scan_area_timer->Start(
 				RandomTimer(RuleI(NPC, NPCToNPCAggroTimerMin), RuleI(NPC, NPCToNPCAggroTimerMax)),
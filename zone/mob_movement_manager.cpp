@@ -4,13 +4,16 @@
 #include "zone.h"
 #include "position.h"
 #include "water_map.h"
+#include "mob_movement_queue.h"
 #include "../common/eq_packet_structs.h"
 #include "../common/misc_functions.h"
 #include "../common/data_verification.h"
 
+#include <algorithm>
 #include <vector>
 #include <deque>
 #include <map>
+#include <unordered_map>
 #include <stdlib.h>
 
 extern double frame_time;
@@ -624,6 +627,9 @@ struct MovementStats {
 		TotalSentMovement = 0ULL;
 		TotalSentPosition = 0ULL;
 		TotalSentHeading  = 0ULL;
+		TotalBytes        = 0ULL;
+		TotalMerged       = 0ULL;
+		TotalHeld         = 0ULL;
 	}
 
 	double   LastResetTime;
@@ -631,6 +637,26 @@ struct MovementStats {
 	uint64_t TotalSentMovement;
 	uint64_t TotalSentPosition;
 	uint64_t TotalSentHeading;
+	uint64_t TotalBytes;
+	uint64_t TotalMerged; // updates replaced by a newer one for the same npc before they were sent
+	uint64_t TotalHeld;   // movement updates held back by the client's update rate tier
+};
+
+enum MovementUpdateKind : uint8 {
+	UpdateMovement,
+	UpdateHeading,
+	UpdatePosition
+};
+
+struct ClientMovementUpdate {
+	PlayerPositionUpdateServer_Struct update;
+	uint8                             kind;
+};
+
+struct ClientMovementQueue {
+	MovementUpdateQueue<ClientMovementUpdate> Updates;
+	uint64_t                                  PacketsSent = 0;
+	uint64_t                                  BytesSent   = 0;
 };
 
 struct NavigateTo {
@@ -650,9 +676,19 @@ struct NavigateTo {
 	double last_set_time;
 };
 
+// ground path waiting on the batched solve at the start of the next Process
+struct PendingPath {
+	bool            pending = false;
+	float           x       = 0.0f;
+	float           y       = 0.0f;
+	float           z       = 0.0f;
+	MobMovementMode mode    = MovementRunning;
+};
+
 struct MobMovementEntry {
 	std::deque<std::unique_ptr<IMovementCommand>> Commands;
 	NavigateTo                                    NavTo;
+	PendingPath                                   Path;
 };
 
 void AdjustRoute(std::list<IPathfinder::IPathNode> &nodes, Mob *who)
@@ -674,9 +710,12 @@ void AdjustRoute(std::list<IPathfinder::IPathNode> &nodes, Mob *who)
 }
 
 struct MobMovementManager::Implementation {
-	std::map<Mob *, MobMovementEntry> Entries;
-	std::vector<Client *>             Clients;
-	MovementStats                     Stats;
+	std::map<Mob *, MobMovementEntry>      Entries;
+	std::vector<Client *>                  Clients;
+	std::unordered_map<Client *, ClientMovementQueue> ClientQueues;
+	MovementStats                          Stats;
+	std::vector<Mob *>                     PendingPaths;
+	std::vector<IPathfinder::PathRequest>  PathRequests;
 };
 
 MobMovementManager::MobMovementManager()
@@ -690,6 +729,8 @@ MobMovementManager::~MobMovementManager()
 
 void MobMovementManager::Process()
 {
+	ProcessPendingPaths();
+
 	for (auto &iter : _impl->Entries) {
 		auto &ent      = iter.second;
 		auto &commands = ent.Commands;
@@ -705,6 +746,8 @@ void MobMovementManager::Process()
 			commands.pop_front();
 		}
 	}
+
+	FlushClientUpdates();
 }
 
 /**
@@ -721,6 +764,21 @@ void MobMovementManager::AddMob(Mob *mob)
 void MobMovementManager::RemoveMob(Mob *mob)
 {
 	_impl->Entries.erase(mob);
+
+	ClearPendingUpdates(mob);
+}
+
+/**
+ * Drops every update still waiting to go out for the mob, an npc calls this as it dies so
+ * nothing queued before OP_Death reaches its corpse, which takes over the spawn id
+ *
+ * @param mob
+ */
+void MobMovementManager::ClearPendingUpdates(Mob *mob)
+{
+	for (auto &iter : _impl->ClientQueues) {
+		iter.second.Updates.Remove(mob);
+	}
 }
 
 /**
@@ -729,6 +787,7 @@ void MobMovementManager::RemoveMob(Mob *mob)
 void MobMovementManager::AddClient(Client *client)
 {
 	_impl->Clients.push_back(client);
+	_impl->ClientQueues[client];
 }
 
 /**
@@ -736,6 +795,8 @@ void MobMovementManager::AddClient(Client *client)
  */
 void MobMovementManager::RemoveClient(Client *client)
 {
+	_impl->ClientQueues.erase(client);
+
 	auto iter = _impl->Clients.begin();
 	while (iter != _impl->Clients.end()) {
 		if (client == *iter) {
@@ -757,7 +818,7 @@ void MobMovementManager::RotateTo(Mob *who, float to, MobMovementMode mob_moveme
 	auto iter = _impl->Entries.find(who);
 	auto &ent = (*iter);
 
-	if (true != ent.second.Commands.empty()) {
+	if (true != ent.second.Commands.empty() || ent.second.Path.pending) {
 		return;
 	}
 
@@ -777,6 +838,7 @@ void MobMovementManager::Teleport(Mob *who, float x, float y, float z, float hea
 	auto &ent = (*iter);
 
 	ent.second.Commands.clear();
+	ent.second.Path.pending = false;
 
 	PushTeleportTo(ent.second, x, y, z, heading);
 }
@@ -838,6 +900,8 @@ void MobMovementManager::StopNavigation(Mob *who)
 	nav.navigate_to_z       = 0.0;
 	nav.navigate_to_heading = 0.0;
 
+	ent.second.Path.pending = false;
+
 	if (true == ent.second.Commands.empty()) {
 		PushStopMoving(ent.second);
 		return;
@@ -853,6 +917,11 @@ void MobMovementManager::StopNavigation(Mob *who)
 }
 
 /**
+ * Updates are queued per client and sent together at the end of Process, where they leave
+ * back to back and are packed into combined packets by the stream. Movement updates for
+ * clients out past short range are limited to one per npc per tier interval, a held update
+ * goes out with the npc's position at the time it is sent
+ *
  * @param mob
  * @param delta_x
  * @param delta_y
@@ -874,90 +943,140 @@ void MobMovementManager::SendCommandToClients(
 	Client* ignore_client
 )
 {
-	if (range == ClientRangeNone) {
+	// a dead npc has handed its spawn id to the corpse
+	if (range == ClientRangeNone || mob->GetID() == 0) {
 		return;
 	}
 
-	EQApplicationPacket outapp(OP_ClientUpdate, sizeof(PlayerPositionUpdateServer_Struct));
-	auto                *spu = (PlayerPositionUpdateServer_Struct *) outapp.pBuffer;
+	PlayerPositionUpdateServer_Struct spu;
+	FillCommandStruct(&spu, mob, delta_x, delta_y, delta_z, delta_heading, anim);
 
-	FillCommandStruct(spu, mob, delta_x, delta_y, delta_z, delta_heading, anim);
+	uint8 kind = UpdatePosition;
+	if (anim != 0) {
+		kind = UpdateMovement;
+	}
+	else if (delta_heading != 0) {
+		kind = UpdateHeading;
+	}
 
-	if (range == ClientRangeAny) {
-		for (auto &c : _impl->Clients) {
-			if (single_client && c != single_client) {
-				continue;
-			}
+	float  short_range     = RuleR(Pathing, ShortMovementUpdateRange);
+	float  long_range      = zone->GetNpcPositionUpdateDistance();
+	uint32 medium_interval = kind == UpdateMovement ? RuleI(Pathing, MediumRangeMovementUpdateInterval) : 0;
+	uint32 long_interval   = kind == UpdateMovement ? RuleI(Pathing, LongRangeMovementUpdateInterval) : 0;
+	uint32 now             = Timer::GetCurrentTime();
 
-			if (ignore_client && c == ignore_client) {
-				continue;
-			}
+	for (auto &c : _impl->Clients) {
+		if (single_client && c != single_client) {
+			continue;
+		}
 
-			_impl->Stats.TotalSent++;
+		if (ignore_client && c == ignore_client) {
+			continue;
+		}
+
+		uint32 interval = 0;
 
-			if (anim != 0) {
-				_impl->Stats.TotalSentMovement++;
+		if (range != ClientRangeAny || medium_interval || long_interval) {
+			float distance = c->CalculateDistance(mob->GetX(), mob->GetY(), mob->GetZ());
+
+			if (range != ClientRangeAny) {
+				bool match = false;
+				if (range & ClientRangeClose) {
+					if (distance < short_range) {
+						match = true;
+					}
+				}
+
+				if (!match && range & ClientRangeMedium) {
+					if (distance >= short_range && distance < long_range) {
+						match = true;
+					}
+				}
+
+				if (!match && range & ClientRangeLong) {
+					if (distance >= long_range) {
+						match = true;
+					}
+				}
+
+				if (!match) {
+					continue;
+				}
 			}
-			else if (delta_heading != 0) {
-				_impl->Stats.TotalSentHeading++;
+
+			if (distance >= long_range) {
+				interval = long_interval;
 			}
-			else {
-				_impl->Stats.TotalSentPosition++;
+			else if (distance >= short_range) {
+				interval = medium_interval;
 			}
+		}
 
-			c->QueuePacket(&outapp, false);
+		auto &queue = _impl->ClientQueues[c];
+
+		uint32 not_before = 0;
+		uint32 last       = 0;
+		if (interval && queue.Updates.GetLastSent(mob, last) && now - last < interval) {
+			not_before = last + interval;
+
+			_impl->Stats.TotalHeld++;
+		}
+
+		if (queue.Updates.Queue(mob, ClientMovementUpdate{spu, kind}, kind == UpdateMovement, not_before)) {
+			_impl->Stats.TotalMerged++;
 		}
 	}
-	else {
-		float short_range = RuleR(Pathing, ShortMovementUpdateRange);
-		float long_range  = zone->GetNpcPositionUpdateDistance();
+}
 
-		for (auto &c : _impl->Clients) {
-			if (single_client && c != single_client) {
-				continue;
-			}
+void MobMovementManager::FlushClientUpdates()
+{
+	uint32 now = Timer::GetCurrentTime();
 
-			if (ignore_client && c == ignore_client) {
-				continue;
-			}
+	EQApplicationPacket outapp(OP_ClientUpdate, sizeof(PlayerPositionUpdateServer_Struct));
 
-			float distance = c->CalculateDistance(mob->GetX(), mob->GetY(), mob->GetZ());
+	for (auto &c : _impl->Clients) {
+		auto iter = _impl->ClientQueues.find(c);
+		if (iter == _impl->ClientQueues.end() || iter->second.Updates.Empty()) {
+			continue;
+		}
 
-			bool match = false;
-			if (range & ClientRangeClose) {
-				if (distance < short_range) {
-					match = true;
-				}
-			}
+		auto &queue = iter->second;
 
-			if (!match && range & ClientRangeMedium) {
-				if (distance >= short_range && distance < long_range) {
-					match = true;
-				}
-			}
+		queue.Updates.Flush(
+			now,
+			[&](MovementUpdateQueue<ClientMovementUpdate>::Entry &e) {
+				auto &u = e.update;
 
-			if (!match && range & ClientRangeLong) {
-				if (distance >= long_range) {
-					match = true;
+				// a held update goes out with where the mob is now, queued ones are removed before it is freed
+				if (e.not_before) {
+					auto mob = static_cast<const Mob *>(e.mob);
+
+					u.update.x_pos   = FloatToEQ19(mob->GetX());
+					u.update.y_pos   = FloatToEQ19(mob->GetY());
+					u.update.z_pos   = FloatToEQ19(mob->GetZ());
+					u.update.heading = FloatToEQ12(mob->GetHeading());
 				}
-			}
 
-			if (match) {
+				memcpy(outapp.pBuffer, &u.update, sizeof(PlayerPositionUpdateServer_Struct));
+				c->QueuePacket(&outapp, false);
+
+				queue.PacketsSent++;
+				queue.BytesSent += outapp.size;
+
 				_impl->Stats.TotalSent++;
+				_impl->Stats.TotalBytes += outapp.size;
 
-				if (anim != 0) {
+				if (u.kind == UpdateMovement) {
 					_impl->Stats.TotalSentMovement++;
 				}
-				else if (delta_heading != 0) {
+				else if (u.kind == UpdateHeading) {
 					_impl->Stats.TotalSentHeading++;
 				}
 				else {
 					_impl->Stats.TotalSentPosition++;
 				}
-
-				c->QueuePacket(&outapp, false);
 			}
-		}
+		);
 	}
 }
 
@@ -1012,6 +1131,35 @@ void MobMovementManager::DumpStats(Client *client)
 		_impl->Stats.TotalSentPosition,
 		static_cast<double>(_impl->Stats.TotalSentPosition) / total_time
 	);
+	client->Message(
+		Chat::System,
+		"Total Bytes: %u (%.2f / sec)",
+		_impl->Stats.TotalBytes,
+		static_cast<double>(_impl->Stats.TotalBytes) / total_time
+	);
+	client->Message(
+		Chat::System,
+		"Total Merged: %u Held: %u",
+		_impl->Stats.TotalMerged,
+		_impl->Stats.TotalHeld
+	);
+
+	for (auto &c : _impl->Clients) {
+		auto iter = _impl->ClientQueues.find(c);
+		if (iter == _impl->ClientQueues.end()) {
+			continue;
+		}
+
+		client->Message(
+			Chat::System,
+			"%s Packets: %u (%.2f / sec) Bytes: %u (%.2f / sec)",
+			c->GetCleanName(),
+			iter->second.PacketsSent,
+			static_cast<double>(iter->second.PacketsSent) / total_time,
+			iter->second.BytesSent,
+			static_cast<double>(iter->second.BytesSent) / total_time
+		);
+	}
 }
 
 void MobMovementManager::ClearStats()
@@ -1021,6 +1169,14 @@ void MobMovementManager::ClearStats()
 	_impl->Stats.TotalSentHeading  = 0;
 	_impl->Stats.TotalSentMovement = 0;
 	_impl->Stats.TotalSentPosition = 0;
+	_impl->Stats.TotalBytes        = 0;
+	_impl->Stats.TotalMerged       = 0;
+	_impl->Stats.TotalHeld         = 0;
+
+	for (auto &iter : _impl->ClientQueues) {
+		iter.second.PacketsSent = 0;
+		iter.second.BytesSent   = 0;
+	}
 }
 
 /**
@@ -1109,6 +1265,9 @@ void MobMovementManager::UpdatePath(Mob *who, float x, float y, float z, MobMove
 		PushSwimTo(ent.second, x, y, z, mob_movement_mode);
 		PushStopMoving(ent.second);
 	}
+	else if (RuleI(Pathing, PathWorkerThreads) > 0) {
+		QueuePathGround(who, x, y, z, mob_movement_mode);
+	}
 	else {
 		UpdatePathGround(who, x, y, z, mob_movement_mode);
 	}
@@ -1123,12 +1282,6 @@ void MobMovementManager::UpdatePath(Mob *who, float x, float y, float z, MobMove
  */
 void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, MobMovementMode mode)
 {
-	PathfinderOptions opts;
-	opts.smooth_path = true;
-	opts.step_size   = RuleR(Pathing, NavmeshStepSize);
-	opts.offset      = who->GetZOffset();
-	opts.flags       = PathingNotDisabled ^ PathingZoneLine;
-
 	//This is probably pointless since the nav mesh tool currently sets zonelines to disabled anyway
 	auto partial = false;
 	auto stuck   = false;
@@ -1137,9 +1290,128 @@ void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, M
 		glm::vec3(x, y, z),
 		partial,
 		stuck,
-		opts
+		GetGroundPathOptions(who)
+	);
+
+	ApplyPathGround(who, x, y, z, mode, route, stuck);
+}
+
+/**
+ * @param who
+ */
+PathfinderOptions MobMovementManager::GetGroundPathOptions(Mob *who)
+{
+	PathfinderOptions opts;
+	opts.smooth_path = true;
+	opts.step_size   = RuleR(Pathing, NavmeshStepSize);
+	opts.offset      = who->GetZOffset();
+	opts.flags       = PathingNotDisabled ^ PathingZoneLine;
+
+	return opts;
+}
+
+/**
+ * Defers a ground path to the batched solve at the start of Process
+ *
+ * @param who
+ * @param x
+ * @param y
+ * @param z
+ * @param mode
+ */
+void MobMovementManager::QueuePathGround(Mob *who, float x, float y, float z, MobMovementMode mode)
+{
+	auto &ent = _impl->Entries.find(who)->second;
+
+	if (!ent.Path.pending) {
+		_impl->PendingPaths.push_back(who);
+	}
+
+	ent.Path.pending = true;
+	ent.Path.x       = x;
+	ent.Path.y       = y;
+	ent.Path.z       = z;
+	ent.Path.mode    = mode;
+}
+
+/**
+ * Solves every ground path queued since the last Process in one FindPaths call, which the
+ * navmesh spreads across Pathing:PathWorkerThreads, then turns each route into commands
+ */
+void MobMovementManager::ProcessPendingPaths()
+{
+	if (_impl->PendingPaths.empty()) {
+		return;
+	}
+
+	// applying a route can queue new paths (stuck handling navigates again), those wait for the next batch
+	std::vector<Mob *> batch;
+	batch.swap(_impl->PendingPaths);
+
+	// anything that stopped, teleported or despawned the mob since it queued has dropped its request
+	batch.erase(
+		std::remove_if(
+			batch.begin(),
+			batch.end(),
+			[this](Mob *who) {
+				auto iter = _impl->Entries.find(who);
+				return iter == _impl->Entries.end() || !iter->second.Path.pending;
+			}
+		),
+		batch.end()
 	);
 
+	auto &requests = _impl->PathRequests;
+	requests.clear();
+
+	for (auto who : batch) {
+		auto &path = _impl->Entries.find(who)->second.Path;
+
+		IPathfinder::PathRequest r;
+		r.start = glm::vec3(who->GetX(), who->GetY(), who->GetZ());
+		r.end   = glm::vec3(path.x, path.y, path.z);
+		r.opts  = GetGroundPathOptions(who);
+		requests.push_back(std::move(r));
+	}
+
+	zone->pathing->FindPaths(requests);
+
+	for (size_t i = 0; i < batch.size(); ++i) {
+		Mob  *who  = batch[i];
+		auto iter  = _impl->Entries.find(who);
+
+		// applying an earlier route can run into code that cancels or despawns this one
+		if (iter == _impl->Entries.end() || !iter->second.Path.pending) {
+			continue;
+		}
+
+		auto &path = iter->second.Path;
+		path.pending = false;
+		ApplyPathGround(who, path.x, path.y, path.z, path.mode, requests[i].route, requests[i].stuck);
+	}
+
+	requests.clear();
+}
+
+/**
+ * @param who
+ * @param x
+ * @param y
+ * @param z
+ * @param mode
+ * @param route
+ * @param stuck
+ */
+void MobMovementManager::ApplyPathGround(
+	Mob *who,
+	float x,
+	float y,
+	float z,
+	MobMovementMode mode,
+	IPathfinder::IPath &route,
+	bool stuck
+)
+{
 	auto eiter = _impl->Entries.find(who);
 	auto &ent  = (*eiter);
 
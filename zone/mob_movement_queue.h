@@ -0,0 +1,109 @@
+#ifndef MOB_MOVEMENT_QUEUE_H
+#define MOB_MOVEMENT_QUEUE_H
+
+#include "../common/types.h"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * One client's movement updates waiting for the end of tick flush
+ *
+ * Keeps at most one update per mob so only the newest goes out. Everything is keyed by the mob
+ * pointer rather than its entity id, the id is cleared when an npc dies and reused by its corpse,
+ * so Remove still finds a mob's entries after that. The mob pointer is never dereferenced here
+ */
+template <typename Update>
+class MovementUpdateQueue {
+public:
+	struct Entry {
+		const void *mob;
+		Update     update;
+		bool       rate_limited; // counts as the mob's last sent update once flushed
+		uint32     not_before;   // held until this time, 0 goes out at the next flush
+	};
+
+	// returns true when the update replaced one already waiting for the mob
+	bool Queue(const void *mob, const Update &update, bool rate_limited, uint32 not_before)
+	{
+		auto pending = m_index.find(mob);
+		if (pending != m_index.end()) {
+			m_pending[pending->second] = Entry{mob, update, rate_limited, not_before};
+			return true;
+		}
+
+		m_index[mob] = m_pending.size();
+		m_pending.push_back(Entry{mob, update, rate_limited, not_before});
+
+		return false;
+	}
+
+	// when a rate limited update for the mob was last flushed, false if none has been
+	bool GetLastSent(const void *mob, uint32 &time) const
+	{
+		auto last = m_last_sent.find(mob);
+		if (last == m_last_sent.end()) {
+			return false;
+		}
+
+		time = last->second;
+		return true;
+	}
+
+	// drops everything held for the mob, call before it dies or is freed
+	void Remove(const void *mob)
+	{
+		auto pending = m_index.find(mob);
+		if (pending != m_index.end()) {
+			size_t i = pending->second;
+			m_index.erase(pending);
+
+			if (i != m_pending.size() - 1) {
+				m_pending[i]              = m_pending.back();
+				m_index[m_pending[i].mob] = i;
+			}
+
+			m_pending.pop_back();
+		}
+
+		m_last_sent.erase(mob);
+	}
+
+	// hands every entry that is due to send, held entries stay queued in their order
+	template <typename SendFn>
+	void Flush(uint32 now, SendFn send)
+	{
+		size_t held = 0;
+
+		for (size_t i = 0; i < m_pending.size(); ++i) {
+			Entry e = m_pending[i];
+
+			if (e.not_before && static_cast<int32>(now - e.not_before) < 0) {
+				m_pending[held] = e;
+				m_index[e.mob]  = held;
+				held++;
+				continue;
+			}
+
+			m_index.erase(e.mob);
+
+			if (e.rate_limited) {
+				m_last_sent[e.mob] = now;
+			}
+
+			send(e);
+		}
+
+		m_pending.resize(held);
+	}
+
+	inline bool Empty() const { return m_pending.empty(); }
+	inline size_t GetPendingCount() const { return m_pending.size(); }
+
+private:
+	std::vector<Entry>                      m_pending;
+	std::unordered_map<const void *, size_t> m_index;
+	std::unordered_map<const void *, uint32> m_last_sent;
+};
+
+#endif
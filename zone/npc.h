@@ -304,6 +304,9 @@ public:
 	uint32	GetMaxDamage(uint8 tlevel);
 	void	SetTaunting(bool is_taunting);
 	bool	IsTaunting() const { return taunting; }
+	// keeps this npc out of the parallel AI think phase, for scripts that steer its targeting mid tick
+	void	SetSerialAI(bool is_serial) { serial_ai = is_serial; }
+	bool	IsSerialAI() const { return serial_ai; }
 	void	PickPocket(Client* thief);
 	void	Disarm(Client* client, int chance);
 	void	StartSwarmTimer(uint32 duration) { swarm_timer.Start(duration); }
@@ -630,6 +633,7 @@ protected:
 	//pet crap:
 	uint16	pet_spell_id;
 	bool	taunting;
+	bool	serial_ai = false;
 	Timer	taunt_timer;		//for pet taunting
 
 	bool npc_aggro;
@@ -2,6 +2,7 @@
 
 #include "map.h"
 #include <list>
+#include <vector>
 
 class Client;
 class Seperator;
@@ -70,11 +71,32 @@ public:
 
 	typedef std::list<IPathNode> IPath;
 
+	// one FindPath call queued for FindPaths, route / partial / stuck are filled in on return
+	struct PathRequest
+	{
+		glm::vec3 start;
+		glm::vec3 end;
+		PathfinderOptions opts;
+		IPath route;
+		bool partial = false;
+		bool stuck = false;
+	};
+
 	IPathfinder() { }
 	virtual ~IPathfinder() { }
 
 	virtual IPath FindRoute(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, int flags = PathingNotDisabled) = 0;
 	virtual IPath FindPath(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions& opts) = 0;
+
+	// solves a tick's worth of requests at once, implementations may spread them across threads
+	virtual void FindPaths(std::vector<PathRequest> &requests) {
+		for (auto &r : requests) {
+			r.route = FindPath(r.start, r.end, r.partial, r.stuck, r.opts);
+		}
+	}
+
+	// zone state that can change which routes are walkable (doors) changed, drop any cached routes
+	virtual void InvalidatePathCache() { }
 	virtual glm::vec3 GetRandomLocation(const glm::vec3 &start) = 0;
 	virtual void DebugCommand(Client *c, const Seperator *sep) = 0;
 
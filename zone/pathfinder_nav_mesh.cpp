@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <memory>
 #include <stdio.h>
 #include <vector>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include "pathfinder_nav_mesh.h"
 #include <DetourCommon.h>
 #include <DetourNavMeshQuery.h>
@@ -9,13 +13,69 @@
 #include "water_map.h"
 #include "client.h"
 #include "../common/compression.h"
+#include "../common/event/work_stealing_pool.h"
 
 extern Zone *zone;
 
+namespace {
+	// polygon corridor found between two polygons under one set of filter settings
+	struct CorridorKey
+	{
+		dtPolyRef start_ref;
+		dtPolyRef end_ref;
+		uint64 filter;
+
+		bool operator==(const CorridorKey &o) const {
+			return start_ref == o.start_ref && end_ref == o.end_ref && filter == o.filter;
+		}
+	};
+
+	struct CorridorKeyHash
+	{
+		size_t operator()(const CorridorKey &k) const {
+			uint64 h = 1469598103934665603ull;
+			h = (h ^ static_cast<uint64>(k.start_ref)) * 1099511628211ull;
+			h = (h ^ static_cast<uint64>(k.end_ref)) * 1099511628211ull;
+			h = (h ^ k.filter) * 1099511628211ull;
+			return static_cast<size_t>(h);
+		}
+	};
+
+	// everything findPath looks at in a filter, two requests with the same key walk the same graph
+	uint64 GetFilterKey(const dtQueryFilter &filter)
+	{
+		uint64 h = 1469598103934665603ull;
+		h = (h ^ filter.getIncludeFlags()) * 1099511628211ull;
+		h = (h ^ filter.getExcludeFlags()) * 1099511628211ull;
+		for (int i = 0; i < DT_MAX_AREAS; ++i) {
+			const float cost = filter.getAreaCost(i);
+			uint32 bits;
+			memcpy(&bits, &cost, sizeof(bits));
+			h = (h ^ bits) * 1099511628211ull;
+		}
+
+		return h;
+	}
+}
+
 struct PathfinderNavmesh::Implementation
 {
 	dtNavMesh *nav_mesh;
 	dtNavMeshQuery *query;
+	int query_max_nodes = 0;
+
+	// FindPaths workers, a dtNavMeshQuery holds per search state so every worker gets its own
+	std::unique_ptr<EQ::Event::WorkStealingPool> workers;
+	std::vector<dtNavMeshQuery *> worker_queries;
+	int worker_max_nodes = 0;
+
+	// LRU of corridors, shared by every query so it is locked
+	typedef std::list<std::pair<CorridorKey, std::vector<dtPolyRef>>> CorridorList;
+	std::mutex cache_lock;
+	uint32 cache_capacity = 0;
+	CorridorList cache_lru;
+	std::unordered_map<CorridorKey, CorridorList::iterator, CorridorKeyHash> cache_index;
+	PathCacheStats cache_stats;
 };
 
 PathfinderNavmesh::PathfinderNavmesh(const std::string &path)
@@ -39,11 +99,7 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 		return IPath();
 	}
 
-	if (!m_impl->query) {
-		m_impl->query = dtAllocNavMeshQuery();
-	}
-
-	m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
+	auto query = GetQuery();
 	glm::vec3 current_location(start.x, start.z, start.y);
 	glm::vec3 dest_location(end.x, end.z, end.y);
 
@@ -64,8 +120,8 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 	dtPolyRef end_ref;
 	glm::vec3 ext(5.0f, 100.0f, 5.0f);
 
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
-	m_impl->query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
+	query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
+	query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
 
 	if (!start_ref || !end_ref) {
 		return IPath();
@@ -73,12 +129,12 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 
 	int npoly = 0;
 	dtPolyRef path[1024] = { 0 };
-	auto status = m_impl->query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, 1024);
+	FindCorridor(query, filter, start_ref, end_ref, current_location, dest_location, path, &npoly, 1024);
 
 	if (npoly) {
 		glm::vec3 epos = dest_location;
 		if (path[npoly - 1] != end_ref) {
-			m_impl->query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
+			query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
 			partial = true;
 
 			auto dist = DistanceSquared(epos, current_location);
@@ -93,7 +149,7 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 		int n_straight_polys;
 		dtPolyRef straight_path_polys[2048];
 
-		status = m_impl->query->findStraightPath(&current_location[0], &epos[0], path, npoly,
+		auto status = query->findStraightPath(&current_location[0], &epos[0], path, npoly,
 			straight_path, straight_path_flags,
 			straight_path_polys, &n_straight_polys, 2048, DT_STRAIGHTPATH_AREA_CROSSINGS);
 
@@ -137,11 +193,11 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 		return IPath();
 	}
 
-	if (!m_impl->query) {
-		m_impl->query = dtAllocNavMeshQuery();
-	}
+	return FindPathWithQuery(GetQuery(), start, end, partial, stuck, opts);
+}
 
-	m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
+IPathfinder::IPath PathfinderNavmesh::FindPathWithQuery(dtNavMeshQuery *query, const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions &opts)
+{
 	glm::vec3 current_location(start.x, start.z, start.y);
 	glm::vec3 dest_location(end.x, end.z, end.y);
 
@@ -163,8 +219,8 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 	dtPolyRef end_ref;
 	glm::vec3 ext(10.0f, 200.0f, 10.0f);
 
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
-	m_impl->query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
+	query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
+	query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
 
 	if (!start_ref || !end_ref) {
 		return IPath();
@@ -172,12 +228,12 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 
 	int npoly = 0;
 	dtPolyRef path[max_polys] = { 0 };
-	auto status = m_impl->query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, max_polys);
+	FindCorridor(query, filter, start_ref, end_ref, current_location, dest_location, path, &npoly, max_polys);
 
 	if (npoly) {
 		glm::vec3 epos = dest_location;
 		if (path[npoly - 1] != end_ref) {
-			m_impl->query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
+			query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
 			partial = true;
 
 			auto dist = DistanceSquared(epos, current_location);
@@ -191,9 +247,9 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 		unsigned char straight_path_flags[max_polys];
 		dtPolyRef straight_path_polys[max_polys];
 
-		auto status = m_impl->query->findStraightPath(&current_location[0], &epos[0], path, npoly,
+		auto status = query->findStraightPath(&current_location[0], &epos[0], path, npoly,
 			(float*)&straight_path[0], straight_path_flags,
-			straight_path_polys, &n_straight_polys, 2048, DT_STRAIGHTPATH_AREA_CROSSINGS | DT_STRAIGHTPATH_ALL_CROSSINGS);
+			straight_path_polys, &n_straight_polys, max_polys, DT_STRAIGHTPATH_AREA_CROSSINGS | DT_STRAIGHTPATH_ALL_CROSSINGS);
 
 		if (dtStatusFailed(status)) {
 			return IPath();
@@ -300,6 +356,193 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 	return IPath();
 }
 
+void PathfinderNavmesh::FindPaths(std::vector<PathRequest> &requests)
+{
+	if (requests.empty()) {
+		return;
+	}
+
+	if (!m_impl->nav_mesh) {
+		for (auto &r : requests) {
+			r.partial = false;
+			r.route.clear();
+		}
+		return;
+	}
+
+	const int threads = RuleI(Pathing, PathWorkerThreads);
+	if (threads <= 0) {
+		m_impl->workers.reset();
+
+		for (auto q : m_impl->worker_queries) {
+			dtFreeNavMeshQuery(q);
+		}
+
+		m_impl->worker_queries.clear();
+	}
+
+	// a lone request is not worth waking the pool for, it is kept for the next busy tick
+	if (threads <= 0 || requests.size() < 2) {
+		auto query = GetQuery();
+		for (auto &r : requests) {
+			r.partial = false;
+			r.route = FindPathWithQuery(query, r.start, r.end, r.partial, r.stuck, r.opts);
+		}
+		return;
+	}
+
+	UpdateCacheCapacity();
+
+	if (!m_impl->workers || m_impl->workers->GetThreadCount() != static_cast<size_t>(threads)) {
+		m_impl->workers = std::make_unique<EQ::Event::WorkStealingPool>(threads);
+	}
+
+	// rule reads and query setup stay on this thread, the workers only search
+	const int max_nodes = RuleI(Pathing, MaxNavmeshNodes);
+	if (m_impl->worker_queries.size() != m_impl->workers->GetWorkerCount() || m_impl->worker_max_nodes != max_nodes) {
+		for (auto q : m_impl->worker_queries) {
+			dtFreeNavMeshQuery(q);
+		}
+
+		m_impl->worker_queries.clear();
+		for (size_t i = 0; i < m_impl->workers->GetWorkerCount(); ++i) {
+			auto q = dtAllocNavMeshQuery();
+			q->init(m_impl->nav_mesh, max_nodes);
+			m_impl->worker_queries.push_back(q);
+		}
+
+		m_impl->worker_max_nodes = max_nodes;
+	}
+
+	m_impl->workers->ParallelForWithWorker(
+		static_cast<uint32>(requests.size()),
+		[this, &requests](uint32 i, size_t worker) {
+			auto &r = requests[i];
+			r.partial = false;
+			r.route = FindPathWithQuery(m_impl->worker_queries[worker], r.start, r.end, r.partial, r.stuck, r.opts);
+		}
+	);
+}
+
+void PathfinderNavmesh::InvalidatePathCache()
+{
+	std::lock_guard<std::mutex> lock(m_impl->cache_lock);
+
+	if (!m_impl->cache_index.empty()) {
+		m_impl->cache_lru.clear();
+		m_impl->cache_index.clear();
+		m_impl->cache_stats.invalidations++;
+	}
+}
+
+PathfinderNavmesh::PathCacheStats PathfinderNavmesh::GetPathCacheStats()
+{
+	std::lock_guard<std::mutex> lock(m_impl->cache_lock);
+
+	PathCacheStats stats = m_impl->cache_stats;
+	stats.entries = m_impl->cache_index.size();
+	stats.capacity = m_impl->cache_capacity;
+
+	return stats;
+}
+
+dtNavMeshQuery *PathfinderNavmesh::GetQuery()
+{
+	UpdateCacheCapacity();
+
+	// init throws away the node pool, only redo it when the rule changed
+	const int max_nodes = RuleI(Pathing, MaxNavmeshNodes);
+	if (!m_impl->query) {
+		m_impl->query = dtAllocNavMeshQuery();
+		m_impl->query_max_nodes = 0;
+	}
+
+	if (m_impl->query_max_nodes != max_nodes) {
+		m_impl->query->init(m_impl->nav_mesh, max_nodes);
+		m_impl->query_max_nodes = max_nodes;
+	}
+
+	return m_impl->query;
+}
+
+void PathfinderNavmesh::UpdateCacheCapacity()
+{
+	const uint32 capacity = static_cast<uint32>(std::max(RuleI(Pathing, PathCacheSize), 0));
+
+	std::lock_guard<std::mutex> lock(m_impl->cache_lock);
+	m_impl->cache_capacity = capacity;
+
+	while (m_impl->cache_index.size() > capacity) {
+		m_impl->cache_index.erase(m_impl->cache_lru.back().first);
+		m_impl->cache_lru.pop_back();
+	}
+}
+
+/**
+ * findPath with the result cached by start and end polygon
+ *
+ * A cached corridor is reused for any positions inside the same two polygons. findPath costs
+ * depend on the exact positions, so a fresh search from elsewhere in a polygon could pick a
+ * different corridor; the reused one is still a valid route between the polygons and
+ * findStraightPath still runs against the caller's positions. Only complete corridors are kept,
+ * a partial one stops short of end_ref. Npcs chasing the same target from the same area end up
+ * sharing one A* search
+ */
+void PathfinderNavmesh::FindCorridor(
+	dtNavMeshQuery *query,
+	const dtQueryFilter &filter,
+	dtPolyRef start_ref,
+	dtPolyRef end_ref,
+	const glm::vec3 &start_pos,
+	const glm::vec3 &end_pos,
+	dtPolyRef *path,
+	int *npoly,
+	int max_polys
+)
+{
+	CorridorKey key{start_ref, end_ref, GetFilterKey(filter)};
+
+	{
+		std::lock_guard<std::mutex> lock(m_impl->cache_lock);
+
+		auto iter = m_impl->cache_index.find(key);
+		if (iter != m_impl->cache_index.end() && static_cast<int>(iter->second->second.size()) <= max_polys) {
+			auto &corridor = iter->second->second;
+			std::copy(corridor.begin(), corridor.end(), path);
+			*npoly = static_cast<int>(corridor.size());
+
+			m_impl->cache_lru.splice(m_impl->cache_lru.begin(), m_impl->cache_lru, iter->second);
+			m_impl->cache_stats.hits++;
+			return;
+		}
+
+		m_impl->cache_stats.misses++;
+	}
+
+	*npoly = 0;
+	auto status = query->findPath(start_ref, end_ref, &start_pos[0], &end_pos[0], &filter, path, npoly, max_polys);
+	if (dtStatusFailed(status) || *npoly == 0) {
+		return;
+	}
+
+	if (dtStatusDetail(status, DT_PARTIAL_RESULT) || path[*npoly - 1] != end_ref) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_impl->cache_lock);
+	if (m_impl->cache_capacity == 0 || m_impl->cache_index.count(key)) {
+		return;
+	}
+
+	if (m_impl->cache_index.size() >= m_impl->cache_capacity) {
+		m_impl->cache_index.erase(m_impl->cache_lru.back().first);
+		m_impl->cache_lru.pop_back();
+	}
+
+	m_impl->cache_lru.emplace_front(key, std::vector<dtPolyRef>(path, path + *npoly));
+	m_impl->cache_index.emplace(key, m_impl->cache_lru.begin());
+}
+
 glm::vec3 PathfinderNavmesh::GetRandomLocation(const glm::vec3 &start)
 {
 	if (start.x == 0.0f && start.y == 0.0)
@@ -309,10 +552,7 @@ glm::vec3 PathfinderNavmesh::GetRandomLocation(const glm::vec3 &start)
 		return glm::vec3(0.f);
 	}
 
-	if (!m_impl->query) {
-		m_impl->query = dtAllocNavMeshQuery();
-		m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
-	}
+	auto query = GetQuery();
 
 	dtQueryFilter filter;
 	filter.setIncludeFlags(65535U ^ 2048);
@@ -334,14 +574,14 @@ glm::vec3 PathfinderNavmesh::GetRandomLocation(const glm::vec3 &start)
 	glm::vec3 current_location(start.x, start.z, start.y);
 	glm::vec3 ext(5.0f, 100.0f, 5.0f);
 
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
+	query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
 
 	if (!start_ref)
 	{
 		return glm::vec3(0.f);
 	}
 
-	if (dtStatusSucceed(m_impl->query->findRandomPointAroundCircle(start_ref, &current_location[0], 100.f, &filter, []() { return (float)zone->random.Real(0.0, 1.0); }, &randomRef, point)))
+	if (dtStatusSucceed(query->findRandomPointAroundCircle(start_ref, &current_location[0], 100.f, &filter, []() { return (float)zone->random.Real(0.0, 1.0); }, &randomRef, point)))
 	{
 		return glm::vec3(point[0], point[2], point[1]);
 	}
@@ -354,6 +594,33 @@ void PathfinderNavmesh::DebugCommand(Client *c, const Seperator *sep)
 	if (sep->arg[1][0] == '\0' || !strcasecmp(sep->arg[1], "help"))
 	{
 		c->Message(Chat::White, "#path show: Plots a path from the user to their target.");
+		c->Message(Chat::White, "#path cache: Shows path cache usage.");
+		c->Message(Chat::White, "#path cache clear: Empties the path cache.");
+		return;
+	}
+
+	if (!strcasecmp(sep->arg[1], "cache"))
+	{
+		if (!strcasecmp(sep->arg[2], "clear")) {
+			InvalidatePathCache();
+			c->Message(Chat::White, "Path cache cleared.");
+			return;
+		}
+
+		auto stats = GetPathCacheStats();
+		const uint64 total = stats.hits + stats.misses;
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"Path Cache | Entries: {}/{} Hits: {} Misses: {} Invalidations: {} Hit Rate: {:.1f}%",
+				stats.entries,
+				stats.capacity,
+				stats.hits,
+				stats.misses,
+				stats.invalidations,
+				total ? 100.0 * stats.hits / total : 0.0
+			).c_str()
+		);
 		return;
 	}
 
@@ -380,6 +647,21 @@ void PathfinderNavmesh::Clear()
 	if (m_impl->query) {
 		dtFreeNavMeshQuery(m_impl->query);
 	}
+
+	m_impl->workers.reset();
+	for (auto q : m_impl->worker_queries) {
+		dtFreeNavMeshQuery(q);
+	}
+
+	m_impl->nav_mesh = nullptr;
+	m_impl->query = nullptr;
+	m_impl->query_max_nodes = 0;
+	m_impl->worker_queries.clear();
+	m_impl->worker_max_nodes = 0;
+
+	std::lock_guard<std::mutex> lock(m_impl->cache_lock);
+	m_impl->cache_lru.clear();
+	m_impl->cache_index.clear();
 }
 
 void PathfinderNavmesh::Load(const std::string &path)
@@ -2,8 +2,12 @@
 
 #include "pathfinder_interface.h"
 #include <string>
+#include <vector>
 #include <DetourNavMesh.h>
 
+class dtNavMeshQuery;
+class dtQueryFilter;
+
 class PathfinderNavmesh : public IPathfinder
 {
 public:
@@ -12,13 +16,40 @@ public:
 
 	virtual IPath FindRoute(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, int flags = PathingNotDisabled);
 	virtual IPath FindPath(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions& opts);
+	virtual void FindPaths(std::vector<PathRequest> &requests);
+	virtual void InvalidatePathCache();
 	virtual glm::vec3 GetRandomLocation(const glm::vec3 &start);
 	virtual void DebugCommand(Client *c, const Seperator *sep);
 
+	struct PathCacheStats
+	{
+		uint64 hits = 0;
+		uint64 misses = 0;
+		uint64 invalidations = 0;
+		size_t entries = 0;
+		uint32 capacity = 0;
+	};
+
+	PathCacheStats GetPathCacheStats();
+
 private:
 	void Clear();
 	void Load(const std::string &path);
 	void ShowPath(Client *c, const glm::vec3 &start, const glm::vec3 &end);
+	dtNavMeshQuery *GetQuery();
+	void UpdateCacheCapacity();
+	IPath FindPathWithQuery(dtNavMeshQuery *query, const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions &opts);
+	void FindCorridor(
+		dtNavMeshQuery *query,
+		const dtQueryFilter &filter,
+		dtPolyRef start_ref,
+		dtPolyRef end_ref,
+		const glm::vec3 &start_pos,
+		const glm::vec3 &end_pos,
+		dtPolyRef *path,
+		int *npoly,
+		int max_polys
+	);
 	dtStatus GetPolyHeightNoConnections(dtPolyRef ref, const float *pos, float *height) const;
 	dtStatus GetPolyHeightOnPath(const dtPolyRef *path, const int path_len, const glm::vec3 &pos, float *h) const;
 
@@ -34,17 +34,17 @@ void Perl_HateEntry_SetDamage(struct_HateList* self, int64 value) // @categories
 
 void Perl_HateEntry_SetEnt(struct_HateList* self, Mob* mob) // @categories Script Utility, Hate and Aggro
 {
-	self->entity_on_hatelist = mob;
+	self->hate_list->SetEntryEnt(self, mob);
 }
 
 void Perl_HateEntry_SetFrenzy(struct_HateList* self, bool is_frenzy) // @categories Script Utility, Hate and Aggro
 {
-	self->is_entity_frenzy = is_frenzy;
+	self->hate_list->SetEntryFrenzy(self, is_frenzy);
 }
 
 void Perl_HateEntry_SetHate(struct_HateList* self, int64 value) // @categories Script Utility, Hate and Aggro
 {
-	self->stored_hate_amount = value;
+	self->hate_list->SetEntryHate(self, value);
 }
 
 void perl_register_hateentry()
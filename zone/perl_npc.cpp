@@ -251,6 +251,16 @@ bool Perl_NPC_IsTaunting(NPC* self)
 	return self->IsTaunting();
 }
 
+void Perl_NPC_SetSerialAI(NPC* self, bool is_serial) // @categories Script Utility
+{
+	self->SetSerialAI(is_serial);
+}
+
+bool Perl_NPC_IsSerialAI(NPC* self) // @categories Script Utility
+{
+	return self->IsSerialAI();
+}
+
 void Perl_NPC_PickPocket(NPC* self, Client* thief) // @categories Skills and Recipes
 {
 	self->PickPocket(thief);
@@ -872,6 +882,7 @@ void perl_register_npc()
 	package.add("IsOnHatelist", &Perl_NPC_IsOnHatelist);
 	package.add("IsRaidTarget", &Perl_NPC_IsRaidTarget);
 	package.add("IsRareSpawn", &Perl_NPC_IsRareSpawn);
+	package.add("IsSerialAI", &Perl_NPC_IsSerialAI);
 	package.add("IsTaunting", &Perl_NPC_IsTaunting);
 	package.add("IsUnderwaterOnly", (bool(*)(NPC*))&Perl_NPC_IsUnderwaterOnly);
 	package.add("MerchantCloseShop", &Perl_NPC_MerchantCloseShop);
@@ -919,6 +930,7 @@ void perl_register_npc()
 	package.add("SetPrimSkill", &Perl_NPC_SetPrimSkill);
 	package.add("SetSaveWaypoint", &Perl_NPC_SetSaveWaypoint);
 	package.add("SetSecSkill", &Perl_NPC_SetSecSkill);
+	package.add("SetSerialAI", &Perl_NPC_SetSerialAI);
 	package.add("SetSilver", &Perl_NPC_SetSilver);
 	package.add("SetSimpleRoamBox", (void(*)(NPC*, float))&Perl_NPC_SetSimpleRoamBox);
 	package.add("SetSimpleRoamBox", (void(*)(NPC*, float, float))&Perl_NPC_SetSimpleRoamBox);
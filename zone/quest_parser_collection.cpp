@@ -22,9 +22,11 @@
 #include "../common/features.h"
 
 #include "quest_parser_collection.h"
+#include "bot.h"
 #include "quest_interface.h"
 #include "zone.h"
 #include "questmgr.h"
+#include "zone_profiler.h"
 #include "../common/path_manager.h"
 #include "../common/repositories/perl_event_export_settings_repository.h"
 
@@ -295,6 +297,8 @@ bool QuestParserCollection::HasEncounterSub(QuestEventID evt, const std::string&
 
 int QuestParserCollection::EventNPC(QuestEventID evt, NPC *npc, Mob *init, std::string data, uint32 extra_data,
 									std::vector<std::any> *extra_pointers) {
+	ZoneProfileQuestScope profile(evt, ZoneProfiler::QuestSourceNPC, npc ? npc->GetNPCTypeID() : 0);
+
 	int rd = DispatchEventNPC(evt, npc, init, data, extra_data, extra_pointers);
 	int rl = EventNPCLocal(evt, npc, init, data, extra_data, extra_pointers);
 	int rg = EventNPCGlobal(evt, npc, init, data, extra_data, extra_pointers);
@@ -356,6 +360,8 @@ int QuestParserCollection::EventNPCGlobal(QuestEventID evt, NPC* npc, Mob *init,
 
 int QuestParserCollection::EventPlayer(QuestEventID evt, Client *client, std::string data, uint32 extra_data,
 									   std::vector<std::any> *extra_pointers) {
+	ZoneProfileQuestScope profile(evt, ZoneProfiler::QuestSourcePlayer, client ? client->CharacterID() : 0);
+
 	int rd = DispatchEventPlayer(evt, client, data, extra_data, extra_pointers);
 	int rl = EventPlayerLocal(evt, client, data, extra_data, extra_pointers);
 	int rg = EventPlayerGlobal(evt, client, data, extra_data, extra_pointers);
@@ -412,6 +418,8 @@ int QuestParserCollection::EventPlayerGlobal(QuestEventID evt, Client *client, s
 
 int QuestParserCollection::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, std::string data, uint32 extra_data,
 									 std::vector<std::any> *extra_pointers) {
+	ZoneProfileQuestScope profile(evt, ZoneProfiler::QuestSourceItem, item ? item->GetID() : 0);
+
 	// needs pointer validation check on 'item' argument
 
 	std::string item_script;
@@ -467,6 +475,8 @@ int QuestParserCollection::EventSpell(
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
+	ZoneProfileQuestScope profile(evt, ZoneProfiler::QuestSourceSpell, spell_id);
+
 	auto iter = _spell_quest_status.find(spell_id);
 	if (iter != _spell_quest_status.end()) {
 		//loaded or failed to load
@@ -505,6 +515,8 @@ int QuestParserCollection::EventSpell(
 
 int QuestParserCollection::EventEncounter(QuestEventID evt, std::string encounter_name, std::string data, uint32 extra_data,
 										  std::vector<std::any> *extra_pointers) {
+	ZoneProfileQuestScope profile(evt, ZoneProfiler::QuestSourceEncounter, 0);
+
 	auto iter = _encounter_quest_status.find(encounter_name);
 	if(iter != _encounter_quest_status.end()) {
 		//loaded or failed to load
@@ -1109,6 +1121,8 @@ int QuestParserCollection::EventBot(
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
+	ZoneProfileQuestScope profile(evt, ZoneProfiler::QuestSourceBot, bot ? bot->GetBotID() : 0);
+
 	auto rd = DispatchEventBot(evt, bot, init, data, extra_data, extra_pointers);
 	auto rl = EventBotLocal(evt, bot, init, data, extra_data, extra_pointers);
 	auto rg = EventBotGlobal(evt, bot, init, data, extra_data, extra_pointers);
@@ -6414,6 +6414,117 @@ uint16 Mob::GetSympatheticFocusEffect(focusType type, uint16 spell_id) {
 	return 0;
 }
 
+void Mob::BuildFocusIndex()
+{
+	if (!m_focus_index) {
+		m_focus_index = std::make_unique<FocusIndex>();
+	}
+
+	auto &index = *m_focus_index;
+
+	// a focus spell can carry more than one focus effect, it is listed once under each
+	auto get_focus_types = [this](uint16 focus_id, std::vector<uint8> &types) {
+		types.clear();
+		for (int i = 0; i < EFFECT_COUNT; i++) {
+			uint8 focus = IsFocusEffect(focus_id, i);
+			if (focus && focus <= HIGHEST_FOCUS && std::find(types.begin(), types.end(), focus) == types.end()) {
+				types.push_back(focus);
+			}
+		}
+	};
+
+	std::vector<uint8> types;
+
+	if (index.items_dirty) {
+		for (auto &v : index.items) {
+			v.clear();
+		}
+
+		auto add_item = [&](const EQ::ItemData *item, const EQ::ItemData *focus_item) {
+			if (!focus_item || !IsValidSpell(focus_item->Focus.Effect)) {
+				return;
+			}
+
+			get_focus_types(focus_item->Focus.Effect, types);
+			for (auto focus : types) {
+				index.items[focus].push_back(FocusIndex::ItemFocus{item, static_cast<uint16>(focus_item->Focus.Effect)});
+			}
+		};
+
+		for (int x = EQ::invslot::EQUIPMENT_BEGIN; x <= EQ::invslot::EQUIPMENT_END; x++) {
+			EQ::ItemInstance* ins = GetInv().GetItem(x);
+			if (!ins) {
+				continue;
+			}
+
+			const EQ::ItemData* item = ins->GetItem();
+			add_item(item, item);
+
+			for (int y = EQ::invaug::SOCKET_BEGIN; y <= EQ::invaug::SOCKET_END; ++y) {
+				EQ::ItemInstance *aug = ins->GetAugment(y);
+				if (aug) {
+					add_item(item, aug->GetItem());
+				}
+			}
+		}
+
+		if (IsClient()) {
+			for (int x = EQ::invslot::TRIBUTE_BEGIN; x <= EQ::invslot::TRIBUTE_END; ++x) {
+				EQ::ItemInstance* ins = GetInv().GetItem(x);
+				if (ins) {
+					add_item(ins->GetItem(), ins->GetItem());
+				}
+			}
+		}
+
+		index.items_dirty = false;
+	}
+
+	if (index.buffs_dirty) {
+		for (auto &v : index.buff_slots) {
+			v.clear();
+		}
+
+		int buff_max = GetMaxTotalSlots();
+		for (int buff_slot = 0; buff_slot < buff_max; buff_slot++) {
+			if (!IsValidSpell(buffs[buff_slot].spellid)) {
+				continue;
+			}
+
+			get_focus_types(buffs[buff_slot].spellid, types);
+			for (auto focus : types) {
+				index.buff_slots[focus].push_back(buff_slot);
+			}
+		}
+
+		index.buffs_dirty = false;
+	}
+
+	if (index.aas_dirty) {
+		for (auto &v : index.aa_ranks) {
+			v.clear();
+		}
+
+		for (const auto &aa : aa_ranks) {
+			auto rank = zone->GetAlternateAdvancementAbilityAndRank(aa.first, aa.second.first).second;
+			if (!rank) {
+				continue;
+			}
+
+			types.clear();
+			for (const auto &e : rank->effects) {
+				uint8 focus = IsFocusEffect(0, 0, true, e.effect_id);
+				if (focus && focus <= HIGHEST_FOCUS && std::find(types.begin(), types.end(), focus) == types.end()) {
+					types.push_back(focus);
+					index.aa_ranks[focus].emplace_back(aa.first, aa.second.first);
+				}
+			}
+		}
+
+		index.aas_dirty = false;
+	}
+}
+
 int64 Mob::GetFocusEffect(focusType type, uint16 spell_id, Mob *caster, bool from_buff_tic)
 {
 	if (IsBardSong(spell_id) && type != focusFcBaseEffects && type != focusSpellDuration && type != focusReduceRecastTime) {
@@ -6432,123 +6543,43 @@ int64 Mob::GetFocusEffect(focusType type, uint16 spell_id, Mob *caster, bool fro
 		rand_effectiveness = true;
 	}
 
+	if (!m_focus_index || m_focus_index->items_dirty || m_focus_index->buffs_dirty || m_focus_index->aas_dirty) {
+		BuildFocusIndex();
+	}
+
 	//Check if item focus effect exists for the mob.
 	if (itembonuses.FocusEffects[type]) {
 
-		const EQ::ItemData* TempItem = nullptr;
 		const EQ::ItemData* UsedItem = nullptr;
 		uint16 UsedFocusID = 0;
 		int32 Total = 0;
 		int32 focus_max = 0;
 		int32 focus_max_real = 0;
 
-		//item focus
-		for (int x = EQ::invslot::EQUIPMENT_BEGIN; x <= EQ::invslot::EQUIPMENT_END; x++) {
-			TempItem = nullptr;
-			EQ::ItemInstance* ins = GetInv().GetItem(x);
-			if (!ins) {
-				continue;
-			}
-
-			TempItem = ins->GetItem();
-			if (TempItem && IsValidSpell(TempItem->Focus.Effect)) {
-				if(rand_effectiveness) {
-					focus_max = CalcFocusEffect(type, TempItem->Focus.Effect, spell_id, true);
-					if (focus_max > 0 && focus_max_real >= 0 && focus_max > focus_max_real) {
-						focus_max_real = focus_max;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					} else if (focus_max < 0 && focus_max < focus_max_real) {
-						focus_max_real = focus_max;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					}
-				}
-				else {
-					Total = CalcFocusEffect(type, TempItem->Focus.Effect, spell_id);
-					if (Total > 0 && realTotal >= 0 && Total > realTotal) {
-						realTotal = Total;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					} else if (Total < 0 && Total < realTotal) {
-						realTotal = Total;
-						UsedItem = TempItem;
-						UsedFocusID = TempItem->Focus.Effect;
-					}
-				}
-			}
-
-			for (int y = EQ::invaug::SOCKET_BEGIN; y <= EQ::invaug::SOCKET_END; ++y) {
-				EQ::ItemInstance *aug = nullptr;
-				aug = ins->GetAugment(y);
-				if (aug) {
-					const EQ::ItemData* TempItemAug = aug->GetItem();
-					if (TempItemAug && IsValidSpell(TempItemAug->Focus.Effect)) {
-						if(rand_effectiveness) {
-							focus_max = CalcFocusEffect(type, TempItemAug->Focus.Effect, spell_id, true);
-							if (focus_max > 0 && focus_max_real >= 0 && focus_max > focus_max_real) {
-								focus_max_real = focus_max;
-								UsedItem = TempItem;
-								UsedFocusID = TempItemAug->Focus.Effect;
-							} else if (focus_max < 0 && focus_max < focus_max_real) {
-								focus_max_real = focus_max;
-								UsedItem = TempItem;
-								UsedFocusID = TempItemAug->Focus.Effect;
-							}
-						}
-						else {
-							Total = CalcFocusEffect(type, TempItemAug->Focus.Effect, spell_id);
-							if (Total > 0 && realTotal >= 0 && Total > realTotal) {
-								realTotal = Total;
-								UsedItem = TempItem;
-								UsedFocusID = TempItemAug->Focus.Effect;
-							} else if (Total < 0 && Total < realTotal) {
-								realTotal = Total;
-								UsedItem = TempItem;
-								UsedFocusID = TempItemAug->Focus.Effect;
-							}
-						}
-					}
+		//item, augment and client tribute focus, in inventory order
+		for (const auto &f : m_focus_index->items[type]) {
+			if(rand_effectiveness) {
+				focus_max = CalcFocusEffect(type, f.focus_id, spell_id, true);
+				if (focus_max > 0 && focus_max_real >= 0 && focus_max > focus_max_real) {
+					focus_max_real = focus_max;
+					UsedItem = f.item;
+					UsedFocusID = f.focus_id;
+				} else if (focus_max < 0 && focus_max < focus_max_real) {
+					focus_max_real = focus_max;
+					UsedItem = f.item;
+					UsedFocusID = f.focus_id;
 				}
 			}
-		}
-
-		if (IsClient()) {
-			//Client Tribute Focus
-			for (int x = EQ::invslot::TRIBUTE_BEGIN; x <= EQ::invslot::TRIBUTE_END; ++x) {
-				TempItem = nullptr;
-				EQ::ItemInstance* ins = GetInv().GetItem(x);
-				if (!ins) {
-					continue;
-				}
-
-				TempItem = ins->GetItem();
-				if (TempItem && IsValidSpell(TempItem->Focus.Effect)) {
-					if (rand_effectiveness) {
-						focus_max = CalcFocusEffect(type, TempItem->Focus.Effect, spell_id, true);
-						if (focus_max > 0 && focus_max_real >= 0 && focus_max > focus_max_real) {
-							focus_max_real = focus_max;
-							UsedItem = TempItem;
-							UsedFocusID = TempItem->Focus.Effect;
-						} else if (focus_max < 0 && focus_max < focus_max_real) {
-							focus_max_real = focus_max;
-							UsedItem = TempItem;
-							UsedFocusID = TempItem->Focus.Effect;
-						}
-					}
-					else {
-						Total = CalcFocusEffect(type, TempItem->Focus.Effect, spell_id);
-						if (Total > 0 && realTotal >= 0 && Total > realTotal) {
-							realTotal = Total;
-							UsedItem = TempItem;
-							UsedFocusID = TempItem->Focus.Effect;
-						}
-						else if (Total < 0 && Total < realTotal) {
-							realTotal = Total;
-							UsedItem = TempItem;
-							UsedFocusID = TempItem->Focus.Effect;
-						}
-					}
+			else {
+				Total = CalcFocusEffect(type, f.focus_id, spell_id);
+				if (Total > 0 && realTotal >= 0 && Total > realTotal) {
+					realTotal = Total;
+					UsedItem = f.item;
+					UsedFocusID = f.focus_id;
+				} else if (Total < 0 && Total < realTotal) {
+					realTotal = Total;
+					UsedItem = f.item;
+					UsedFocusID = f.focus_id;
 				}
 			}
 		}
@@ -6609,11 +6640,9 @@ int64 Mob::GetFocusEffect(focusType type, uint16 spell_id, Mob *caster, bool fro
 		int32 focus_max_real2 = 0;
 
 		int buff_tracker = -1;
-		int buff_slot = 0;
 		int32 focusspellid = 0;
 		int32 focusspell_tracker = 0;
-		int buff_max = GetMaxTotalSlots();
-		for (buff_slot = 0; buff_slot < buff_max; buff_slot++) {
+		for (int buff_slot : m_focus_index->buff_slots[type]) {
 			focusspellid = buffs[buff_slot].spellid;
 			if (focusspellid == 0 || focusspellid >= SPDAT_RECORDS) {
 				continue;
@@ -6664,8 +6693,8 @@ int64 Mob::GetFocusEffect(focusType type, uint16 spell_id, Mob *caster, bool fro
 
 		int32 Total3 = 0;
 
-		for (const auto &aa : aa_ranks) {
-			auto ability_rank = zone->GetAlternateAdvancementAbilityAndRank(aa.first, aa.second.first);
+		for (const auto &aa : m_focus_index->aa_ranks[type]) {
+			auto ability_rank = zone->GetAlternateAdvancementAbilityAndRank(aa.first, aa.second);
 			auto ability = ability_rank.first;
 			auto rank = ability_rank.second;
 
@@ -6772,12 +6801,14 @@ int64 NPC::GetFocusEffect(focusType type, uint16 spell_id, Mob* caster, bool fro
 		int64 focus_max2 = 0;
 		int64 focus_max_real2 = 0;
 
+		if (!m_focus_index || m_focus_index->buffs_dirty) {
+			BuildFocusIndex();
+		}
+
 		int buff_tracker = -1;
-		int buff_slot = 0;
 		int64 focusspellid = 0;
 		int64 focusspell_tracker = 0;
-		int buff_max = GetMaxTotalSlots();
-		for (buff_slot = 0; buff_slot < buff_max; buff_slot++) {
+		for (int buff_slot : m_focus_index->buff_slots[type]) {
 			focusspellid = buffs[buff_slot].spellid;
 			if (focusspellid == 0 || focusspellid >= SPDAT_RECORDS)
 				continue;
@@ -23,6 +23,7 @@
 #include "../common/misc_functions.h"
 #include "../common/events/player_event_logs.h"
 
+#include "bazaar_index.h"
 #include "client.h"
 #include "entity.h"
 #include "mob.h"
@@ -1720,209 +1721,52 @@ void Client::SendBazaarResults(
 	uint32 max_price
 )
 {
-	std::string search_values   = " COUNT(item_id), trader.*, items.name ";
-	std::string search_criteria = " WHERE trader.item_id = items.id ";
+	BazaarSearchCriteria criteria;
 
 	if (trader_id > 0) {
 		Client *trader = entity_list.GetClientByID(trader_id);
 
 		if (trader) {
-			search_criteria.append(StringFormat(" AND trader.char_id = %i", trader->CharacterID()));
+			criteria.trader_char_id = trader->CharacterID();
 		}
 	}
 
-	if (min_price != 0) {
-		search_criteria.append(StringFormat(" AND trader.item_cost >= %i", min_price));
-	}
-
-	if (max_price != 0) {
-		search_criteria.append(StringFormat(" AND trader.item_cost <= %i", max_price));
-	}
-
-	if (strlen(item_name) > 0) {
-		char *safeName = RemoveApostrophes(item_name);
-		search_criteria.append(StringFormat(" AND items.name LIKE '%%%s%%'", safeName));
-		safe_delete_array(safeName);
-	}
-
-	if (in_class != 0xFFFFFFFF) {
-		search_criteria.append(StringFormat(" AND MID(REVERSE(BIN(items.classes)), %i, 1) = 1", in_class));
-	}
-
-	if (in_race != 0xFFFFFFFF) {
-		search_criteria.append(StringFormat(" AND MID(REVERSE(BIN(items.races)), %i, 1) = 1", in_race));
-	}
-
-	if (item_slot != 0xFFFFFFFF) {
-		search_criteria.append(StringFormat(" AND MID(REVERSE(BIN(items.slots)), %i, 1) = 1", item_slot + 1));
-	}
-
-	switch (item_type) {
-		case 0xFFFFFFFF:
-			break;
-		case 0:
-			// 1H Slashing
-			search_criteria.append(" AND items.itemtype = 0 AND damage > 0");
-			break;
-		case 31:
-			search_criteria.append(" AND items.itemclass = 2");
-			break;
-		case 46:
-			search_criteria.append(" AND items.scrolleffect > 0 AND items.scrolleffect < 65000");
-			break;
-		case 47:
-			search_criteria.append(" AND items.worneffect = 998");
-			break;
-		case 48:
-			search_criteria.append(" AND items.worneffect >= 1298 AND items.worneffect <= 1307");
-			break;
-		case 49:
-			search_criteria.append(" AND items.focuseffect > 0");
-			break;
-
-		default:
-			search_criteria.append(StringFormat(" AND items.itemtype = %i", item_type));
-	}
-
-	switch (item_stat) {
-
-		case STAT_AC:
-			search_criteria.append(" AND items.ac > 0");
-			search_values.append(", items.ac");
-			break;
-
-		case STAT_AGI:
-			search_criteria.append(" AND items.aagi > 0");
-			search_values.append(", items.aagi");
-			break;
-
-		case STAT_CHA:
-			search_criteria.append(" AND items.acha > 0");
-			search_values.append(", items.acha");
-			break;
-
-		case STAT_DEX:
-			search_criteria.append(" AND items.adex > 0");
-			search_values.append(", items.adex");
-			break;
-
-		case STAT_INT:
-			search_criteria.append(" AND items.aint > 0");
-			search_values.append(", items.aint");
-			break;
-
-		case STAT_STA:
-			search_criteria.append(" AND items.asta > 0");
-			search_values.append(", items.asta");
-			break;
-
-		case STAT_STR:
-			search_criteria.append(" AND items.astr > 0");
-			search_values.append(", items.astr");
-			break;
-
-		case STAT_WIS:
-			search_criteria.append(" AND items.awis > 0");
-			search_values.append(", items.awis");
-			break;
-
-		case STAT_COLD:
-			search_criteria.append(" AND items.cr > 0");
-			search_values.append(", items.cr");
-			break;
-
-		case STAT_DISEASE:
-			search_criteria.append(" AND items.dr > 0");
-			search_values.append(", items.dr");
-			break;
-
-		case STAT_FIRE:
-			search_criteria.append(" AND items.fr > 0");
-			search_values.append(", items.fr");
-			break;
-
-		case STAT_MAGIC:
-			search_criteria.append(" AND items.mr > 0");
-			search_values.append(", items.mr");
-			break;
-
-		case STAT_POISON:
-			search_criteria.append(" AND items.pr > 0");
-			search_values.append(", items.pr");
-			break;
-
-		case STAT_HP:
-			search_criteria.append(" AND items.hp > 0");
-			search_values.append(", items.hp");
-			break;
-
-		case STAT_MANA:
-			search_criteria.append(" AND items.mana > 0");
-			search_values.append(", items.mana");
-			break;
-
-		case STAT_ENDURANCE:
-			search_criteria.append(" AND items.endur > 0");
-			search_values.append(", items.endur");
-			break;
-
-		case STAT_ATTACK:
-			search_criteria.append(" AND items.attack > 0");
-			search_values.append(", items.attack");
-			break;
-
-		case STAT_HP_REGEN:
-			search_criteria.append(" AND items.regen > 0");
-			search_values.append(", items.regen");
-			break;
-
-		case STAT_MANA_REGEN:
-			search_criteria.append(" AND items.manaregen > 0");
-			search_values.append(", items.manaregen");
-			break;
-
-		case STAT_HASTE:
-			search_criteria.append(" AND items.haste > 0");
-			search_values.append(", items.haste");
-			break;
-
-		case STAT_DAMAGE_SHIELD:
-			search_criteria.append(" AND items.damageshield > 0");
-			search_values.append(", items.damageshield");
-			break;
-
-		default:
-			search_values.append(", 0");
-			break;
-	}
-
-	std::string query = StringFormat(
-		"SELECT %s, SUM(charges), items.stackable "
-		"FROM trader, items %s GROUP BY items.id, charges, char_id LIMIT %i",
-		search_values.c_str(),
-		search_criteria.c_str(),
-		RuleI(Bazaar, MaxSearchResults)
+	criteria.in_class    = in_class;
+	criteria.in_race     = in_race;
+	criteria.item_stat   = item_stat;
+	criteria.item_slot   = item_slot;
+	criteria.item_type   = item_type;
+	criteria.item_name   = std::string(item_name, strnlen(item_name, 64));
+	criteria.min_price   = min_price;
+	criteria.max_price   = max_price;
+	criteria.max_results = RuleI(Bazaar, MaxSearchResults);
+
+	auto results = bazaar_index.Search(criteria);
+
+	LogTrading(
+		"SRCH: name [{}] class [{}] race [{}] stat [{}] slot [{}] type [{}] price [{}-{}] results [{}]",
+		criteria.item_name,
+		in_class,
+		in_race,
+		item_stat,
+		item_slot,
+		item_type,
+		min_price,
+		max_price,
+		results.size()
 	);
 
-	auto results = database.QueryDatabase(query);
-
-	if (!results.Success()) {
-		return;
-	}
-
-	LogTrading("SRCH: [{}]", query.c_str());
-
 	int    Size = 0;
 	uint32 ID   = 0;
 
-	if (results.RowCount() == static_cast<unsigned long>(RuleI(Bazaar, MaxSearchResults))) {
+	if (results.size() == static_cast<size_t>(RuleI(Bazaar, MaxSearchResults))) {
 		Message(
 			Chat::Yellow,
 			"Your search reached the limit of %i results. Please narrow your search down by selecting more options.",
 			RuleI(Bazaar, MaxSearchResults));
 	}
 
-	if (results.RowCount() == 0) {
+	if (results.empty()) {
 		auto                    outapp2 = new EQApplicationPacket(OP_BazaarSearch, sizeof(BazaarReturnDone_Struct));
 		BazaarReturnDone_Struct *brds   = (BazaarReturnDone_Struct *) outapp2->pBuffer;
 		brds->TraderID   = ID;
@@ -1935,44 +1779,34 @@ void Client::SendBazaarResults(
 		return;
 	}
 
-	Size = results.RowCount() * sizeof(BazaarSearchResults_Struct);
+	Size = results.size() * sizeof(BazaarSearchResults_Struct);
 	auto  buffer  = new uchar[Size];
 	uchar *bufptr = buffer;
 	memset(buffer, 0, Size);
 
 	int    Action          = BazaarSearchResults;
-	uint32 Cost            = 0;
-	int32  SerialNumber    = 0;
 	char   temp_buffer[64] = {0};
-	int    Count           = 0;
-	uint32 StatValue       = 0;
 
-	for (auto row = results.begin(); row != results.end(); ++row) {
+	for (auto &r : results) {
 		VARSTRUCT_ENCODE_TYPE(uint32, bufptr, Action);
-		Count = Strings::ToInt(row[0]);
-		VARSTRUCT_ENCODE_TYPE(uint32, bufptr, Count);
-		SerialNumber = Strings::ToInt(row[3]);
-		VARSTRUCT_ENCODE_TYPE(int32, bufptr, SerialNumber);
-		Client *Trader2 = entity_list.GetClientByCharID(Strings::ToInt(row[1]));
+		VARSTRUCT_ENCODE_TYPE(uint32, bufptr, r.count);
+		VARSTRUCT_ENCODE_TYPE(int32, bufptr, r.serial_number);
+		Client *Trader2 = entity_list.GetClientByCharID(r.char_id);
 		if (Trader2) {
 			ID = Trader2->GetID();
 			VARSTRUCT_ENCODE_TYPE(uint32, bufptr, ID);
 		}
 		else {
-			LogTrading("Unable to find trader: [{}]\n", Strings::ToInt(row[1]));
+			LogTrading("Unable to find trader: [{}]\n", r.char_id);
 			VARSTRUCT_ENCODE_TYPE(uint32, bufptr, 0);
 		}
-		Cost = Strings::ToInt(row[5]);
-		VARSTRUCT_ENCODE_TYPE(uint32, bufptr, Cost);
-		StatValue = Strings::ToInt(row[8]);
-		VARSTRUCT_ENCODE_TYPE(uint32, bufptr, StatValue);
-		bool Stackable = Strings::ToInt(row[10]);
-		if (Stackable) {
-			int Charges = Strings::ToInt(row[9]);
-			sprintf(temp_buffer, "%s(%i)", row[7], Charges);
+		VARSTRUCT_ENCODE_TYPE(uint32, bufptr, r.item_cost);
+		VARSTRUCT_ENCODE_TYPE(uint32, bufptr, r.stat_value);
+		if (r.stackable) {
+			snprintf(temp_buffer, sizeof(temp_buffer), "%s(%i)", r.item_name.c_str(), r.total_charges);
 		}
 		else {
-			sprintf(temp_buffer, "%s(%i)", row[7], Count);
+			snprintf(temp_buffer, sizeof(temp_buffer), "%s(%i)", r.item_name.c_str(), r.count);
 		}
 
 		memcpy(bufptr, &temp_buffer, strlen(temp_buffer));
@@ -1982,17 +1816,17 @@ void Client::SendBazaarResults(
 		// Extra fields for SoD+
 		//
 		if (Trader2) {
-			sprintf(temp_buffer, "%s", Trader2->GetName());
+			snprintf(temp_buffer, sizeof(temp_buffer), "%s", Trader2->GetName());
 		}
 		else {
-			sprintf(temp_buffer, "Unknown");
+			snprintf(temp_buffer, sizeof(temp_buffer), "Unknown");
 		}
 
 		memcpy(bufptr, &temp_buffer, strlen(temp_buffer));
 
 		bufptr += 64;
 
-		VARSTRUCT_ENCODE_TYPE(uint32, bufptr, Strings::ToInt(row[1])); // ItemID
+		VARSTRUCT_ENCODE_TYPE(uint32, bufptr, r.char_id); // ItemID
 	}
 
 	auto outapp = new EQApplicationPacket(OP_BazaarSearch, Size);
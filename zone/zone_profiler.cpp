@@ -0,0 +1,320 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2016 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "zone_profiler.h"
+
+#include <algorithm>
+#include <fmt/format.h>
+
+#ifdef EMBPERL
+extern const char *QuestEventSubroutines[_LargestEventID];
+#elif defined(LUA_EQEMU)
+extern const char *LuaEvents[_LargestEventID];
+#endif
+
+static const char *section_names[ZoneProfiler::MaxSection] = {
+	"tick",
+	"stream_identify",
+	"group_process",
+	"door_process",
+	"object_process",
+	"corpse_process",
+	"trap_process",
+	"raid_process",
+	"client_packets",
+	"mob_process",
+	"npc_process",
+	"client_process",
+	"beacon_process",
+	"encounter_process",
+	"event_scheduler",
+	"zone_process",
+	"quest_timers",
+	"character_saves",
+	"ai_think"
+};
+
+static const char *quest_source_names[] = {
+	"npc",
+	"player",
+	"item",
+	"spell",
+	"encounter",
+	"bot"
+};
+
+ZoneProfiler::ZoneProfiler()
+{
+	m_stack.fill(Frame{});
+}
+
+void ZoneProfiler::Init()
+{
+	// constructing a timer runs the one time clock rate calibration
+	RDTSC_Timer calibrate;
+
+	m_ticks_per_us = std::max(1.0, static_cast<double>(RDTSC_Timer::ticksPerMS()) / 1000.0);
+	m_initialized  = true;
+}
+
+void ZoneProfiler::Reset()
+{
+	// the frame stack is left alone, a reset can be requested from inside an open frame
+	m_histograms.fill(Histogram{});
+	m_folded.clear();
+	m_overruns.clear();
+	m_tick_count     = 0;
+	m_overrun_count  = 0;
+	m_dropped_frames = 0;
+}
+
+void ZoneProfiler::BeginTick(bool enabled, uint32 overrun_ms)
+{
+	m_enabled       = enabled && m_initialized;
+	m_overrun_ms    = overrun_ms;
+	m_overrun_ticks = static_cast<uint64>(overrun_ms * 1000 * m_ticks_per_us);
+	m_depth         = 0;
+
+	m_tick_sections.fill(0);
+	m_tick_worst_mob         = WorstMob{};
+	m_tick_worst_quest_event = WorstQuestEvent{};
+}
+
+void ZoneProfiler::EndTick()
+{
+	if (!m_enabled) {
+		return;
+	}
+
+	m_tick_count++;
+
+	const uint64 tick_ticks = m_tick_sections[Tick];
+	if (m_overrun_ticks == 0 || tick_ticks <= m_overrun_ticks) {
+		return;
+	}
+
+	m_overrun_count++;
+
+	Overrun o;
+	o.tick_number       = m_tick_count;
+	o.tick_ticks        = tick_ticks;
+	o.section_ticks     = m_tick_sections;
+	o.worst_mob         = m_tick_worst_mob;
+	o.worst_quest_event = m_tick_worst_quest_event;
+
+	m_overruns.emplace_back(std::move(o));
+	if (m_overruns.size() > MAX_OVERRUNS) {
+		m_overruns.pop_front();
+	}
+}
+
+bool ZoneProfiler::Enter(uint16 frame_id)
+{
+	if (!m_enabled || frame_id >= MAX_FRAMES) {
+		return false;
+	}
+
+	if (m_depth == MAX_DEPTH) {
+		m_dropped_frames++;
+		return false;
+	}
+
+	auto &f = m_stack[m_depth];
+	f.id          = frame_id;
+	f.key         = (m_depth > 0 ? m_stack[m_depth - 1].key << 8 : 0) | static_cast<uint64>(frame_id + 1);
+	f.child_ticks = 0;
+	m_depth++;
+
+	// read the counter last so the bookkeeping above is charged to the parent
+	f.start = RDTSC_Timer::rdtsc();
+
+	return true;
+}
+
+uint64 ZoneProfiler::Leave()
+{
+	const int64 now = RDTSC_Timer::rdtsc();
+
+	if (m_depth == 0) {
+		return 0;
+	}
+
+	auto         &f    = m_stack[--m_depth];
+	const uint64 ticks = now > f.start ? static_cast<uint64>(now - f.start) : 0;
+
+	m_folded[f.key] += ticks > f.child_ticks ? ticks - f.child_ticks : 0;
+
+	if (m_depth > 0) {
+		m_stack[m_depth - 1].child_ticks += ticks;
+	}
+
+	if (f.id < MaxSection) {
+		m_tick_sections[f.id] += ticks;
+	}
+
+	Record(f.id, ticks);
+
+	return ticks;
+}
+
+void ZoneProfiler::Record(uint16 frame_id, uint64 ticks)
+{
+	auto &h = m_histograms[frame_id];
+	h.count++;
+	h.total_ticks += ticks;
+	h.max_ticks = std::max(h.max_ticks, ticks);
+
+	// bucket 0 is under 1us, bucket n covers [2^(n-1), 2^n) us, the last bucket is open ended
+	uint64 us     = static_cast<uint64>(ticks / m_ticks_per_us);
+	uint32 bucket = 0;
+	while (us > 0 && bucket < HISTOGRAM_BUCKETS - 1) {
+		us >>= 1;
+		bucket++;
+	}
+
+	h.buckets[bucket]++;
+}
+
+void ZoneProfiler::NoteMob(uint64 ticks, uint32 npc_type_id, const char *name)
+{
+	if (ticks <= m_tick_worst_mob.ticks) {
+		return;
+	}
+
+	m_tick_worst_mob.ticks       = ticks;
+	m_tick_worst_mob.npc_type_id = npc_type_id;
+	m_tick_worst_mob.name        = name ? name : "";
+}
+
+void ZoneProfiler::NoteQuestEvent(uint64 ticks, QuestEventID event_id, QuestSource source, uint32 source_id)
+{
+	if (ticks <= m_tick_worst_quest_event.ticks) {
+		return;
+	}
+
+	m_tick_worst_quest_event.ticks     = ticks;
+	m_tick_worst_quest_event.event_id  = static_cast<uint16>(event_id);
+	m_tick_worst_quest_event.source    = source;
+	m_tick_worst_quest_event.source_id = source_id;
+}
+
+double ZoneProfiler::TicksToMicroseconds(uint64 ticks) const
+{
+	return static_cast<double>(ticks) / m_ticks_per_us;
+}
+
+std::vector<std::pair<std::string, uint64>> ZoneProfiler::GetFoldedStacks() const
+{
+	std::vector<std::pair<std::string, uint64>> stacks;
+	stacks.reserve(m_folded.size());
+
+	std::vector<uint16> path;
+	for (auto &e : m_folded) {
+		path.clear();
+		for (uint64 key = e.first; key != 0; key >>= 8) {
+			path.push_back(static_cast<uint16>((key & 0xFF) - 1));
+		}
+
+		std::string name;
+		for (auto it = path.rbegin(); it != path.rend(); ++it) {
+			if (!name.empty()) {
+				name += ";";
+			}
+
+			name += GetFrameName(*it);
+		}
+
+		stacks.emplace_back(std::move(name), e.second);
+	}
+
+	std::sort(
+		stacks.begin(),
+		stacks.end(),
+		[](const std::pair<std::string, uint64> &a, const std::pair<std::string, uint64> &b) {
+			return a.second > b.second;
+		}
+	);
+
+	return stacks;
+}
+
+std::string ZoneProfiler::GetFrameName(uint16 frame_id)
+{
+	if (frame_id < MaxSection) {
+		return section_names[frame_id];
+	}
+
+	const uint16 event_id = frame_id - QUEST_EVENT_FRAME_BASE;
+	if (event_id >= _LargestEventID) {
+		return "unknown";
+	}
+
+#ifdef EMBPERL
+	return QuestEventSubroutines[event_id];
+#elif defined(LUA_EQEMU)
+	return LuaEvents[event_id];
+#else
+	return fmt::format("event_{}", event_id);
+#endif
+}
+
+std::string ZoneProfiler::GetQuestSourceName(uint8 source)
+{
+	if (source >= sizeof(quest_source_names) / sizeof(quest_source_names[0])) {
+		return "unknown";
+	}
+
+	return quest_source_names[source];
+}
+
+uint64 ZoneProfiler::GetBucketUpperMicroseconds(uint32 bucket)
+{
+	if (bucket >= HISTOGRAM_BUCKETS - 1) {
+		return 0;
+	}
+
+	return static_cast<uint64>(1) << bucket;
+}
+
+ZoneProfileScope::ZoneProfileScope(uint16 frame_id)
+{
+	m_active = zone_profiler.Enter(frame_id);
+}
+
+ZoneProfileScope::~ZoneProfileScope()
+{
+	if (m_active) {
+		zone_profiler.Leave();
+	}
+}
+
+ZoneProfileQuestScope::ZoneProfileQuestScope(
+	QuestEventID event_id,
+	ZoneProfiler::QuestSource source,
+	uint32 source_id
+) : m_event_id(event_id), m_source(source), m_source_id(source_id)
+{
+	m_active = event_id < _LargestEventID && zone_profiler.Enter(ZoneProfiler::QuestEventFrame(event_id));
+}
+
+ZoneProfileQuestScope::~ZoneProfileQuestScope()
+{
+	if (m_active) {
+		zone_profiler.NoteQuestEvent(zone_profiler.Leave(), m_event_id, m_source, m_source_id);
+	}
+}
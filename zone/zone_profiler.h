@@ -0,0 +1,212 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2016 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+#ifndef ZONE_PROFILER_H
+#define ZONE_PROFILER_H
+
+#include <array>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../common/types.h"
+#include "../common/rdtsc.h"
+#include "event_codes.h"
+
+/**
+ * Always-on scoped timers for the zone main loop
+ *
+ * Every frame (a loop section or a quest event) is timed with rdtsc and folded into a
+ * log2 microsecond histogram. Frames nest, so self time is also accumulated per call path
+ * which gives a flame graph in folded-stack form. Ticks that run past the overrun budget
+ * keep a snapshot of their section breakdown and the slowest mob and quest event seen
+ */
+class ZoneProfiler {
+public:
+	enum Section : uint8 {
+		Tick = 0,
+		StreamIdentify,
+		GroupProcess,
+		DoorProcess,
+		ObjectProcess,
+		CorpseProcess,
+		TrapProcess,
+		RaidProcess,
+		ClientPackets,
+		MobProcess,
+		NPCProcess,
+		ClientProcess,
+		BeaconProcess,
+		EncounterProcess,
+		EventScheduler,
+		ZoneProcess,
+		QuestTimers,
+		CharacterSaves,
+		AIThink,
+		MaxSection
+	};
+
+	static constexpr uint16 QUEST_EVENT_FRAME_BASE = MaxSection;
+	static constexpr uint16 MAX_FRAMES             = QUEST_EVENT_FRAME_BASE + _LargestEventID;
+	static constexpr uint32 HISTOGRAM_BUCKETS      = 20;
+	static constexpr uint32 MAX_DEPTH              = 8;
+	static constexpr uint32 MAX_OVERRUNS           = 16;
+
+	// call paths are packed 8 bits per level into a 64 bit key
+	static_assert(MAX_FRAMES < 255, "frame ids must fit in a byte");
+
+	enum QuestSource : uint8 {
+		QuestSourceNPC = 0,
+		QuestSourcePlayer,
+		QuestSourceItem,
+		QuestSourceSpell,
+		QuestSourceEncounter,
+		QuestSourceBot
+	};
+
+	struct Histogram {
+		uint64                                count       = 0;
+		uint64                                total_ticks = 0;
+		uint64                                max_ticks   = 0;
+		std::array<uint64, HISTOGRAM_BUCKETS> buckets{};
+	};
+
+	struct WorstMob {
+		uint64      ticks       = 0;
+		uint32      npc_type_id = 0;
+		std::string name;
+	};
+
+	struct WorstQuestEvent {
+		uint64 ticks     = 0;
+		uint16 event_id  = 0;
+		uint8  source    = QuestSourceNPC;
+		uint32 source_id = 0;
+	};
+
+	struct Overrun {
+		uint64                         tick_number = 0;
+		uint64                         tick_ticks  = 0;
+		std::array<uint64, MaxSection> section_ticks{};
+		WorstMob                       worst_mob;
+		WorstQuestEvent                worst_quest_event;
+	};
+
+	ZoneProfiler();
+
+	// calibrates the tick counter, nothing is recorded until this has run
+	void Init();
+	void Reset();
+
+	void BeginTick(bool enabled, uint32 overrun_ms);
+	void EndTick();
+
+	bool Enter(uint16 frame_id);
+	uint64 Leave();
+
+	void NoteMob(uint64 ticks, uint32 npc_type_id, const char *name);
+	void NoteQuestEvent(uint64 ticks, QuestEventID event_id, QuestSource source, uint32 source_id);
+
+	inline bool IsEnabled() const { return m_enabled; }
+	inline uint64 GetTickCount() const { return m_tick_count; }
+	inline uint64 GetOverrunCount() const { return m_overrun_count; }
+	inline uint64 GetDroppedFrameCount() const { return m_dropped_frames; }
+	inline uint32 GetOverrunBudgetMS() const { return m_overrun_ms; }
+	inline const Histogram &GetHistogram(uint16 frame_id) const { return m_histograms[frame_id]; }
+	inline const std::deque<Overrun> &GetOverruns() const { return m_overruns; }
+
+	double TicksToMicroseconds(uint64 ticks) const;
+
+	// folded stack ("tick;mob_process;npc_process") and accumulated self time in ticks
+	std::vector<std::pair<std::string, uint64>> GetFoldedStacks() const;
+
+	static std::string GetFrameName(uint16 frame_id);
+	static std::string GetQuestSourceName(uint8 source);
+	static uint64 GetBucketUpperMicroseconds(uint32 bucket);
+
+	static inline uint16 QuestEventFrame(QuestEventID event_id)
+	{
+		return static_cast<uint16>(QUEST_EVENT_FRAME_BASE + event_id);
+	}
+
+private:
+	struct Frame {
+		uint16 id;
+		uint64 key;
+		int64  start;
+		uint64 child_ticks;
+	};
+
+	void Record(uint16 frame_id, uint64 ticks);
+
+	bool   m_initialized    = false;
+	bool   m_enabled        = false;
+	double m_ticks_per_us   = 1.0;
+	uint32 m_overrun_ms     = 32;
+	uint64 m_overrun_ticks  = 0;
+	uint64 m_tick_count     = 0;
+	uint64 m_overrun_count  = 0;
+	uint64 m_dropped_frames = 0;
+
+	std::array<Frame, MAX_DEPTH>       m_stack{};
+	uint32                             m_depth = 0;
+	std::array<Histogram, MAX_FRAMES>  m_histograms{};
+	std::unordered_map<uint64, uint64> m_folded;
+	std::array<uint64, MaxSection>     m_tick_sections{};
+	WorstMob                           m_tick_worst_mob;
+	WorstQuestEvent                    m_tick_worst_quest_event;
+	std::deque<Overrun>                m_overruns;
+};
+
+/**
+ * Times the enclosing block as one profiler frame
+ */
+class ZoneProfileScope {
+public:
+	explicit ZoneProfileScope(uint16 frame_id);
+	~ZoneProfileScope();
+
+	ZoneProfileScope(const ZoneProfileScope &) = delete;
+	ZoneProfileScope &operator=(const ZoneProfileScope &) = delete;
+
+private:
+	bool m_active;
+};
+
+/**
+ * Times a quest event dispatch and offers it as the tick's worst quest event
+ */
+class ZoneProfileQuestScope {
+public:
+	ZoneProfileQuestScope(QuestEventID event_id, ZoneProfiler::QuestSource source, uint32 source_id);
+	~ZoneProfileQuestScope();
+
+	ZoneProfileQuestScope(const ZoneProfileQuestScope &) = delete;
+	ZoneProfileQuestScope &operator=(const ZoneProfileQuestScope &) = delete;
+
+private:
+	bool                      m_active;
+	QuestEventID              m_event_id;
+	ZoneProfiler::QuestSource m_source;
+	uint32                    m_source_id;
+};
+
+extern ZoneProfiler zone_profiler;
+
+#endif
@@ -11,6 +11,7 @@
 #include "zone.h"
 #include "zonedb.h"
 #include "aura.h"
+#include "bazaar_index.h"
 #include "../common/repositories/character_tribute_repository.h"
 #include "../common/repositories/character_disciplines_repository.h"
 #include "../common/repositories/npc_types_repository.h"
@@ -20,6 +21,7 @@
 #include "../common/repositories/character_pet_info_repository.h"
 #include "../common/repositories/character_buffs_repository.h"
 
+#include <algorithm>
 #include <ctime>
 #include <iostream>
 #include <fmt/format.h>
@@ -397,6 +399,7 @@ void ZoneDatabase::SaveTraderItem(uint32 CharID, uint32 ItemID, uint32 SerialNum
     if (!results.Success())
         LogDebug("[CLIENT] Failed to save trader item: [{}] for char_id: [{}], the error was: [{}]\n", ItemID, CharID, results.ErrorMessage().c_str());
 
+	bazaar_index.SaveItem(CharID, ItemID, SerialNumber, Charges, ItemCost, Slot);
 }
 
 void ZoneDatabase::UpdateTraderItemCharges(int CharID, uint32 SerialNumber, int32 Charges) {
@@ -408,6 +411,7 @@ void ZoneDatabase::UpdateTraderItemCharges(int CharID, uint32 SerialNumber, int3
     if (!results.Success())
 		LogDebug("[CLIENT] Failed to update charges for trader item: [{}] for char_id: [{}], the error was: [{}]\n", SerialNumber, CharID, results.ErrorMessage().c_str());
 
+	bazaar_index.UpdateCharges(CharID, SerialNumber, Charges);
 }
 
 void ZoneDatabase::UpdateTraderItemPrice(int CharID, uint32 ItemID, uint32 Charges, uint32 NewPrice) {
@@ -419,6 +423,8 @@ void ZoneDatabase::UpdateTraderItemPrice(int CharID, uint32 ItemID, uint32 Charg
 	if(!item)
 		return;
 
+	bazaar_index.UpdatePrice(CharID, ItemID, Charges, NewPrice);
+
 	if(NewPrice == 0) {
 		LogTrading("Removing Trader items from the DB for CharID [{}], ItemID [{}]", CharID, ItemID);
 
@@ -451,6 +457,8 @@ void ZoneDatabase::UpdateTraderItemPrice(int CharID, uint32 ItemID, uint32 Charg
 
 void ZoneDatabase::DeleteTraderItem(uint32 char_id){
 
+	bazaar_index.RemoveTrader(char_id);
+
 	if(char_id==0) {
         const std::string query = "DELETE FROM trader";
         auto results = QueryDatabase(query);
@@ -468,6 +476,8 @@ void ZoneDatabase::DeleteTraderItem(uint32 char_id){
 }
 void ZoneDatabase::DeleteTraderItem(uint32 CharID,uint16 SlotID) {
 
+	bazaar_index.RemoveItem(CharID, SlotID);
+
 	std::string query = StringFormat("DELETE FROM trader WHERE char_id = %i And slot_id = %i", CharID, SlotID);
 	auto results = QueryDatabase(query);
 	if (!results.Success())
@@ -1031,7 +1041,12 @@ bool ZoneDatabase::LoadCharacterBindPoint(uint32 character_id, PlayerProfile_Str
 }
 
 bool ZoneDatabase::SaveCharacterLanguage(uint32 character_id, uint32 lang_id, uint32 value){
-	std::string query = StringFormat("REPLACE INTO `character_languages` (id, lang_id, value) VALUES (%u, %u, %u)", character_id, lang_id, value); QueryDatabase(query);
+	QueueCharacterSave(
+		"character_languages",
+		"id, lang_id, value",
+		fmt::format("{}:{}", character_id, lang_id),
+		fmt::format("{}, {}, {}", character_id, lang_id, value)
+	);
 	LogDebug("ZoneDatabase::SaveCharacterLanguage for character ID: [{}], lang_id:[{}] value:[{}] done", character_id, lang_id, value);
 	return true;
 }
@@ -1047,7 +1062,12 @@ bool ZoneDatabase::SaveCharacterMaterialColor(uint32 character_id, uint32 slot_i
 }
 
 bool ZoneDatabase::SaveCharacterSkill(uint32 character_id, uint32 skill_id, uint32 value){
-	std::string query = StringFormat("REPLACE INTO `character_skills` (id, skill_id, value) VALUES (%u, %u, %u)", character_id, skill_id, value); auto results = QueryDatabase(query);
+	QueueCharacterSave(
+		"character_skills",
+		"id, skill_id, value",
+		fmt::format("{}:{}", character_id, skill_id),
+		fmt::format("{}, {}, {}", character_id, skill_id, value)
+	);
 	LogDebug("ZoneDatabase::SaveCharacterSkill for character ID: [{}], skill_id:[{}] value:[{}] done", character_id, skill_id, value);
 	return true;
 }
@@ -1094,19 +1114,62 @@ bool ZoneDatabase::SaveCharacterBandolier(uint32 character_id, uint8 bandolier_i
 {
 	char bandolier_name_esc[64];
 	DoEscapeString(bandolier_name_esc, bandolier_name, strlen(bandolier_name));
-	std::string query = StringFormat("REPLACE INTO `character_bandolier` (id, bandolier_id, bandolier_slot, item_id, icon, bandolier_name) VALUES (%u, %u, %u, %u, %u,'%s')", character_id, bandolier_id, bandolier_slot, item_id, icon, bandolier_name_esc);
-	auto results = QueryDatabase(query);
+	QueueCharacterSave(
+		"character_bandolier",
+		"id, bandolier_id, bandolier_slot, item_id, icon, bandolier_name",
+		fmt::format("{}:{}:{}", character_id, bandolier_id, bandolier_slot),
+		fmt::format("{}, {}, {}, {}, {}, '{}'", character_id, bandolier_id, bandolier_slot, item_id, icon, bandolier_name_esc)
+	);
 	LogDebug("ZoneDatabase::SaveCharacterBandolier for character ID: [{}], bandolier_id: [{}], bandolier_slot: [{}] item_id: [{}], icon:[{}] band_name:[{}]  done", character_id, bandolier_id, bandolier_slot, item_id, icon, bandolier_name);
 	return true;
 }
 
 bool ZoneDatabase::SaveCharacterPotionBelt(uint32 character_id, uint8 potion_id, uint32 item_id, uint32 icon)
 {
-	std::string query = StringFormat("REPLACE INTO `character_potionbelt` (id, potion_id, item_id, icon) VALUES (%u, %u, %u, %u)", character_id, potion_id, item_id, icon);
-	auto results = QueryDatabase(query);
+	QueueCharacterSave(
+		"character_potionbelt",
+		"id, potion_id, item_id, icon",
+		fmt::format("{}:{}", character_id, potion_id),
+		fmt::format("{}, {}, {}, {}", character_id, potion_id, item_id, icon)
+	);
 	return true;
 }
 
+void ZoneDatabase::QueueCharacterSave(
+	const std::string& table,
+	const std::string& columns,
+	const std::string& key,
+	const std::string& values
+)
+{
+	if (RuleI(Character, SaveBatchIntervalMS) <= 0) {
+		QueryDatabase(fmt::format("REPLACE INTO `{}` ({}) VALUES ({})", table, columns, values));
+		return;
+	}
+
+	m_character_save_batcher.Queue(table, columns, key, values);
+
+	const int max_rows = RuleI(Character, SaveBatchMaxRows);
+	if (max_rows > 0 && m_character_save_batcher.GetPendingRowCount() >= static_cast<uint32>(max_rows)) {
+		FlushCharacterSaveBatch();
+	}
+}
+
+void ZoneDatabase::ProcessCharacterSaveBatch()
+{
+	if (m_character_save_batcher.ShouldFlush(
+		static_cast<uint32>(std::max(RuleI(Character, SaveBatchIntervalMS), 0)),
+		static_cast<uint32>(std::max(RuleI(Character, SaveBatchMaxRows), 0))
+	)) {
+		FlushCharacterSaveBatch();
+	}
+}
+
+void ZoneDatabase::FlushCharacterSaveBatch()
+{
+	m_character_save_batcher.Flush(*this);
+}
+
 bool ZoneDatabase::SaveCharacterLeadershipAA(uint32 character_id, PlayerProfile_Struct* pp){
 	uint8 first_entry = 0; std::string query = "";
 	for (int i = 0; i < MAX_LEADERSHIP_AA_ARRAY; i++){
@@ -1453,30 +1516,34 @@ bool ZoneDatabase::SaveCharacterCurrency(uint32 character_id, PlayerProfile_Stru
 	if (pp->gold_cursor < 0) { pp->gold_cursor = 0; }
 	if (pp->silver_cursor < 0) { pp->silver_cursor = 0; }
 	if (pp->copper_cursor < 0) { pp->copper_cursor = 0; }
-	std::string query = StringFormat(
-		"REPLACE INTO `character_currency` (id, platinum, gold, silver, copper,"
-		"platinum_bank, gold_bank, silver_bank, copper_bank,"
+	QueueCharacterSave(
+		"character_currency",
+		"id, platinum, gold, silver, copper, "
+		"platinum_bank, gold_bank, silver_bank, copper_bank, "
 		"platinum_cursor, gold_cursor, silver_cursor, copper_cursor, "
-		"radiant_crystals, career_radiant_crystals, ebon_crystals, career_ebon_crystals)"
-		"VALUES (%u, %u, %u, %u, %u, %u, %u, %u, %u, %u, %u, %u, %u, %u, %u, %u, %u)",
-		character_id,
-		pp->platinum,
-		pp->gold,
-		pp->silver,
-		pp->copper,
-		pp->platinum_bank,
-		pp->gold_bank,
-		pp->silver_bank,
-		pp->copper_bank,
-		pp->platinum_cursor,
-		pp->gold_cursor,
-		pp->silver_cursor,
-		pp->copper_cursor,
-		pp->currentRadCrystals,
-		pp->careerRadCrystals,
-		pp->currentEbonCrystals,
-		pp->careerEbonCrystals);
-	auto results = database.QueryDatabase(query);
+		"radiant_crystals, career_radiant_crystals, ebon_crystals, career_ebon_crystals",
+		std::to_string(character_id),
+		fmt::format(
+			"{}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}",
+			character_id,
+			static_cast<uint32>(pp->platinum),
+			static_cast<uint32>(pp->gold),
+			static_cast<uint32>(pp->silver),
+			static_cast<uint32>(pp->copper),
+			static_cast<uint32>(pp->platinum_bank),
+			static_cast<uint32>(pp->gold_bank),
+			static_cast<uint32>(pp->silver_bank),
+			static_cast<uint32>(pp->copper_bank),
+			static_cast<uint32>(pp->platinum_cursor),
+			static_cast<uint32>(pp->gold_cursor),
+			static_cast<uint32>(pp->silver_cursor),
+			static_cast<uint32>(pp->copper_cursor),
+			pp->currentRadCrystals,
+			pp->careerRadCrystals,
+			pp->currentEbonCrystals,
+			pp->careerEbonCrystals
+		)
+	);
 	LogDebug("Saving Currency for character ID: [{}], done", character_id);
 	return true;
 }
@@ -1517,6 +1584,9 @@ bool ZoneDatabase::DeleteCharacterDisc(uint32 character_id, uint32 slot_id){
 }
 
 bool ZoneDatabase::DeleteCharacterBandolier(uint32 character_id, uint32 band_id){
+	// pending bandolier rows would otherwise be written back after the delete
+	FlushCharacterSaveBatch();
+
 	std::string query = StringFormat("DELETE FROM `character_bandolier` WHERE `bandolier_id` = %u AND `id` = %u", band_id, character_id);
 	QueryDatabase(query);
 	return true;
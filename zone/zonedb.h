@@ -14,6 +14,7 @@
 #include "../common/races.h"
 
 #include "bot_database.h"
+#include "character_save_batcher.h"
 
 #define WOLF 42
 
@@ -457,6 +458,12 @@ public:
 	bool SaveCharacterSkill(uint32 character_id, uint32 skill_id, uint32 value);
 	bool SaveCharacterSpell(uint32 character_id, uint32 spell_id, uint32 slot_id);
 
+	/* Character Save Batching */
+	void QueueCharacterSave(const std::string& table, const std::string& columns, const std::string& key, const std::string& values);
+	void ProcessCharacterSaveBatch();
+	void FlushCharacterSaveBatch();
+	inline const CharacterSaveBatcher& GetCharacterSaveBatcher() const { return m_character_save_batcher; }
+
 	double GetAAEXPModifier(uint32 character_id, uint32 zone_id, int16 instance_version = -1) const;
 	double GetEXPModifier(uint32 character_id, uint32 zone_id, int16 instance_version = -1) const;
 	void SetAAEXPModifier(uint32 character_id, uint32 zone_id, double aa_modifier, int16 instance_version = -1);
@@ -669,6 +676,8 @@ public:
 protected:
 	void ZDBInitVars();
 
+	CharacterSaveBatcher m_character_save_batcher;
+
 	uint32				max_faction;
 	Faction**			faction_array;
 	uint32 npc_spellseffects_maxid;